@@ -20,6 +20,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzFramework/Visibility/VisibilityEntryBounds.h>
 
 namespace AzFramework
 {
@@ -60,9 +61,20 @@ namespace AzFramework
         {
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
+            //! Optional structure-of-arrays copy of the entry bounding volumes, in the same order as m_entries.
+            //! May be nullptr if the scene implementation does not maintain one.
+            const VisibilityEntryBounds* m_entryBounds = nullptr;
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! Bitmask with one bit per frustum passed to the multi-frustum Enumerate.
+        using FrustumMask = uint32_t;
+        //! The maximum number of frustums that can be intersected by a single multi-frustum Enumerate.
+        static constexpr uint32_t MaxEnumerateFrustums = 32;
+        //! @param overlapMask bit i is set for each frustum that overlaps the node
+        //! @param containedMask bit i is set for each frustum that fully contains the node, always a subset of overlapMask
+        using MultiFrustumEnumerateCallback = AZStd::function<void(const NodeData&, FrustumMask overlapMask, FrustumMask containedMask)>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -111,6 +123,14 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects several frustums against the visibility system in a single traversal.
+        //! Each node is only tested against the frustums that overlap its parent, and frustums that fully contain a node are not retested for its children.
+        //! This is useful when many views (shadow cascades, cubemap faces) are culled against the same scene each frame.
+        //! @param frustums an array of frustumCount frustums to test against
+        //! @param frustumCount the number of frustums, must not exceed MaxEnumerateFrustums
+        //! @param callback the callback to invoke when a node is visible to at least one of the frustums
+        virtual void Enumerate(const AZ::Frustum* frustums, uint32_t frustumCount, const MultiFrustumEnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -35,6 +36,7 @@ namespace AzFramework
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_entryBounds(AZStd::move(rhs.m_entryBounds))
     {
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -49,6 +51,7 @@ namespace AzFramework
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_entryBounds = AZStd::move(rhs.m_entryBounds);
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -88,6 +91,7 @@ namespace AzFramework
         else
         {
             m_entries.push_back(entry);
+            m_entryBounds.PushBack(entry->m_boundingVolume);
             entry->m_internalNode = this;
             entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
         }
@@ -103,6 +107,7 @@ namespace AzFramework
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            m_entryBounds.Set(entry->m_internalNodeIndex, boundingVolume);
             return;
         }
 
@@ -138,6 +143,7 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+        m_entryBounds.SwapRemove(removeIndex);
 
         if (m_parent != nullptr)
         {
@@ -192,7 +198,7 @@ namespace AzFramework
             // Invoke the callback for the current node
             if (!m_entries.empty())
             {
-                callback({ m_bounds, m_entries });
+                callback({ m_bounds, m_entries, &m_entryBounds });
             }
 
             if (m_children != nullptr)
@@ -207,12 +213,60 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::Enumerate(
+        const AZ::Frustum* frustums,
+        IVisibilityScene::FrustumMask testMask,
+        IVisibilityScene::FrustumMask containedMask,
+        const IVisibilityScene::MultiFrustumEnumerateCallback& callback) const
+    {
+        // Frustums that contain the parent also contain this node, only the partially overlapping ones need testing
+        IVisibilityScene::FrustumMask overlapMask = containedMask;
+        for (IVisibilityScene::FrustumMask remaining = testMask & ~containedMask; remaining != 0; remaining &= remaining - 1)
+        {
+            const uint32_t frustumIndex = az_ctz_u32(remaining);
+            const IVisibilityScene::FrustumMask frustumBit = 1u << frustumIndex;
+            switch (frustums[frustumIndex].IntersectAabb(m_bounds))
+            {
+            case AZ::IntersectResult::Interior:
+                containedMask |= frustumBit;
+                overlapMask |= frustumBit;
+                break;
+            case AZ::IntersectResult::Overlaps:
+                overlapMask |= frustumBit;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (overlapMask == 0)
+        {
+            return;
+        }
+
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({ m_bounds, m_entries, &m_entryBounds }, overlapMask, containedMask);
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].Enumerate(frustums, overlapMask, containedMask, callback);
+            }
+        }
+    }
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({ m_bounds, m_entries, &m_entryBounds });
         }
 
         if (m_children != nullptr)
@@ -231,6 +285,11 @@ namespace AzFramework
         return m_entries;
     }
 
+    const VisibilityEntryBounds& OctreeNode::GetEntryBounds() const
+    {
+        return m_entryBounds;
+    }
+
     OctreeNode* OctreeNode::GetChildren() const
     {
         return m_children;
@@ -276,7 +335,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({ m_bounds, m_entries, &m_entryBounds });
         }
 
         if (m_children != nullptr)
@@ -334,6 +393,7 @@ namespace AzFramework
 
         // Re-partition our entry set across ourself and our child nodes
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
+        m_entryBounds.Clear();
         for (VisibilityEntry* entry : entrySet)
         {
             entry->m_internalNode = nullptr;
@@ -355,8 +415,10 @@ namespace AzFramework
                 childEntry->m_internalNode = this;
                 childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
                 m_entries.push_back(childEntry);
+                m_entryBounds.PushBack(childEntry->m_boundingVolume);
             }
             m_children[child].m_entries.clear();
+            m_children[child].m_entryBounds.Clear();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
@@ -446,6 +508,19 @@ namespace AzFramework
         m_root.Enumerate(includeFrustum, excludeFrustum, callback);
     }
 
+    void OctreeScene::Enumerate(const AZ::Frustum* frustums, uint32_t frustumCount, const MultiFrustumEnumerateCallback& callback) const
+    {
+        AZ_Assert(frustumCount <= MaxEnumerateFrustums, "Multi-frustum Enumerate supports at most %u frustums, %u were provided", MaxEnumerateFrustums, frustumCount);
+        if (frustumCount == 0)
+        {
+            return;
+        }
+
+        const FrustumMask testMask = (frustumCount >= MaxEnumerateFrustums) ? ~FrustumMask(0) : ((FrustumMask(1) << frustumCount) - 1);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.Enumerate(frustums, testMask, 0, callback);
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -58,12 +58,24 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect at least one of the frustums.
+        //! @param testMask the frustums that overlap the parent node and need to be tested
+        //! @param containedMask the frustums that fully contain the parent node, these are not retested
+        void Enumerate(
+            const AZ::Frustum* frustums,
+            IVisibilityScene::FrustumMask testMask,
+            IVisibilityScene::FrustumMask containedMask,
+            const IVisibilityScene::MultiFrustumEnumerateCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
+        //! Returns the structure-of-arrays bounding volumes of the entries bound to this node, in the same order as GetEntries().
+        const VisibilityEntryBounds& GetEntryBounds() const;
+
         //! Returns the array of child nodes for this OctreeNode, may be nullptr if this OctreeNode is a leaf node.
         OctreeNode* GetChildren() const;
 
@@ -88,6 +100,7 @@ namespace AzFramework
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        VisibilityEntryBounds m_entryBounds; //< Kept in lockstep with m_entries
     };
 
     //! Implementation of the visibility system interface.
@@ -114,6 +127,7 @@ namespace AzFramework
         void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum* frustums, uint32_t frustumCount, const MultiFrustumEnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/VisibilityEntryBounds.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace AzFramework
+{
+    namespace
+    {
+        // Pointers to four consecutive values of each of the six bound arrays
+        struct BoundsLanes
+        {
+            const float* m_min[3];
+            const float* m_max[3];
+        };
+
+        void ClassifyLanes(const AZ::Frustum& frustum, const BoundsLanes& lanes, int32_t* exteriorOut, int32_t* overlapsOut)
+        {
+            using namespace AZ::Simd;
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            Vec4::FloatType exterior = zero;
+            Vec4::FloatType overlaps = zero;
+
+            for (AZ::Frustum::PlaneId i = AZ::Frustum::PlaneId::Near; i < AZ::Frustum::PlaneId::MAX; ++i)
+            {
+                const AZ::Plane plane = frustum.GetPlane(i);
+                const AZ::Vector3 normal = plane.GetNormal();
+
+                // Same support points as Frustum::IntersectAabb, the normal is uniform across all lanes so the min/max choice is made once per plane
+                Vec4::FloatType disjointDistance = Vec4::Splat(plane.GetDistance());
+                Vec4::FloatType intersectDistance = disjointDistance;
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    const float component = normal.GetElement(axis);
+                    const Vec4::FloatType splatComponent = Vec4::Splat(component);
+                    const bool positive = component > 0.0f;
+                    const Vec4::FloatType disjointSupport = Vec4::LoadUnaligned(positive ? lanes.m_max[axis] : lanes.m_min[axis]);
+                    const Vec4::FloatType intersectSupport = Vec4::LoadUnaligned(positive ? lanes.m_min[axis] : lanes.m_max[axis]);
+                    disjointDistance = Vec4::Madd(splatComponent, disjointSupport, disjointDistance);
+                    intersectDistance = Vec4::Madd(splatComponent, intersectSupport, intersectDistance);
+                }
+
+                exterior = Vec4::Or(exterior, Vec4::CmpLt(disjointDistance, zero));
+                overlaps = Vec4::Or(overlaps, Vec4::CmpLt(intersectDistance, zero));
+            }
+
+            Vec4::StoreUnaligned(exteriorOut, Vec4::CastToInt(exterior));
+            Vec4::StoreUnaligned(overlapsOut, Vec4::CastToInt(overlaps));
+        }
+
+        AZ::IntersectResult ToIntersectResult(int32_t exterior, int32_t overlaps)
+        {
+            if (exterior != 0)
+            {
+                return AZ::IntersectResult::Exterior;
+            }
+            return (overlaps != 0) ? AZ::IntersectResult::Overlaps : AZ::IntersectResult::Interior;
+        }
+    }
+
+    void VisibilityEntryBounds::PushBack(const AZ::Aabb& aabb)
+    {
+        m_minX.push_back(aabb.GetMin().GetX());
+        m_minY.push_back(aabb.GetMin().GetY());
+        m_minZ.push_back(aabb.GetMin().GetZ());
+        m_maxX.push_back(aabb.GetMax().GetX());
+        m_maxY.push_back(aabb.GetMax().GetY());
+        m_maxZ.push_back(aabb.GetMax().GetZ());
+    }
+
+    void VisibilityEntryBounds::Set(size_t index, const AZ::Aabb& aabb)
+    {
+        AZ_Assert(index < GetSize(), "VisibilityEntryBounds index %zu out of range", index);
+        m_minX[index] = aabb.GetMin().GetX();
+        m_minY[index] = aabb.GetMin().GetY();
+        m_minZ[index] = aabb.GetMin().GetZ();
+        m_maxX[index] = aabb.GetMax().GetX();
+        m_maxY[index] = aabb.GetMax().GetY();
+        m_maxZ[index] = aabb.GetMax().GetZ();
+    }
+
+    void VisibilityEntryBounds::SwapRemove(size_t index)
+    {
+        AZ_Assert(index < GetSize(), "VisibilityEntryBounds index %zu out of range", index);
+        for (AZStd::vector<float>* values : { &m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ })
+        {
+            (*values)[index] = values->back();
+            values->pop_back();
+        }
+    }
+
+    void VisibilityEntryBounds::Clear()
+    {
+        m_minX.clear();
+        m_minY.clear();
+        m_minZ.clear();
+        m_maxX.clear();
+        m_maxY.clear();
+        m_maxZ.clear();
+    }
+
+    size_t VisibilityEntryBounds::GetSize() const
+    {
+        return m_minX.size();
+    }
+
+    AZ::Aabb VisibilityEntryBounds::Get(size_t index) const
+    {
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(m_minX[index], m_minY[index], m_minZ[index]),
+            AZ::Vector3(m_maxX[index], m_maxY[index], m_maxZ[index]));
+    }
+
+    void VisibilityEntryBounds::ClassifyFrustum(const AZ::Frustum& frustum, size_t begin, size_t end, AZ::IntersectResult* results) const
+    {
+        AZ_Assert(begin <= end && end <= GetSize(), "VisibilityEntryBounds range [%zu, %zu) out of range", begin, end);
+
+        constexpr size_t LaneCount = AZ::Simd::Vec4::ElementCount;
+        int32_t exterior[LaneCount];
+        int32_t overlaps[LaneCount];
+
+        size_t index = begin;
+        for (; index + LaneCount <= end; index += LaneCount)
+        {
+            const BoundsLanes lanes = {
+                { &m_minX[index], &m_minY[index], &m_minZ[index] },
+                { &m_maxX[index], &m_maxY[index], &m_maxZ[index] } };
+            ClassifyLanes(frustum, lanes, exterior, overlaps);
+            for (size_t lane = 0; lane < LaneCount; ++lane)
+            {
+                *results++ = ToIntersectResult(exterior[lane], overlaps[lane]);
+            }
+        }
+
+        if (index < end)
+        {
+            // Pad the remainder out to a full set of lanes by repeating the last volume
+            float tail[6][LaneCount];
+            const AZStd::vector<float>* sources[6] = { &m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ };
+            for (size_t array = 0; array < 6; ++array)
+            {
+                for (size_t lane = 0; lane < LaneCount; ++lane)
+                {
+                    tail[array][lane] = (*sources[array])[AZStd::min(index + lane, end - 1)];
+                }
+            }
+
+            const BoundsLanes lanes = { { tail[0], tail[1], tail[2] }, { tail[3], tail[4], tail[5] } };
+            ClassifyLanes(frustum, lanes, exterior, overlaps);
+            for (size_t lane = 0; index + lane < end; ++lane)
+            {
+                *results++ = ToIntersectResult(exterior[lane], overlaps[lane]);
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AzFramework
+{
+    //! Structure-of-arrays mirror of the bounding volumes of a set of VisibilityEntries.
+    //! The OctreeNode keeps one of these in the same order as its entry list, so that culling can reject entries
+    //! several at a time without touching the VisibilityEntry or its user data.
+    class AZF_API VisibilityEntryBounds
+    {
+    public:
+        VisibilityEntryBounds() = default;
+        VisibilityEntryBounds(VisibilityEntryBounds&&) = default;
+        VisibilityEntryBounds& operator=(VisibilityEntryBounds&&) = default;
+
+        //! Appends a bounding volume to the end of the set.
+        void PushBack(const AZ::Aabb& aabb);
+
+        //! Overwrites the bounding volume at the given index.
+        void Set(size_t index, const AZ::Aabb& aabb);
+
+        //! Moves the last bounding volume into the given index and shrinks the set by one, mirroring a swap and pop of the entry list.
+        void SwapRemove(size_t index);
+
+        //! Removes all bounding volumes.
+        void Clear();
+
+        //! Returns the number of bounding volumes in the set.
+        size_t GetSize() const;
+
+        //! Returns the bounding volume at the given index.
+        AZ::Aabb Get(size_t index) const;
+
+        //! Classifies the bounding volumes in [begin, end) against the frustum, four at a time.
+        //! Produces the same result as AZ::Frustum::IntersectAabb for each volume.
+        //! @param frustum the frustum to test against
+        //! @param begin   the first index to classify
+        //! @param end     one past the last index to classify
+        //! @param results output array, must have room for (end - begin) results
+        void ClassifyFrustum(const AZ::Frustum& frustum, size_t begin, size_t end, AZ::IntersectResult* results) const;
+
+    private:
+        AZStd::vector<float> m_minX;
+        AZStd::vector<float> m_minY;
+        AZStd::vector<float> m_minZ;
+        AZStd::vector<float> m_maxX;
+        AZStd::vector<float> m_maxY;
+        AZStd::vector<float> m_maxZ;
+    };
+}
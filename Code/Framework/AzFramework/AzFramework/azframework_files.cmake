@@ -545,6 +545,8 @@ set(FILES
     Visibility/OctreeSystemComponent.h
     Visibility/VisibilityDebug.cpp
     Visibility/VisibilityDebug.h
+    Visibility/VisibilityEntryBounds.cpp
+    Visibility/VisibilityEntryBounds.h
     Visibility/VisibleGeometryBus.cpp
     Visibility/VisibleGeometryBus.h
 )
@@ -332,6 +332,57 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    // Compares classifying every entry of every visited node against the frustum one at a time with the
+    // structure-of-arrays entry bounds, which is the pre-pass the renderer uses to reject entries before touching them
+    BENCHMARK_DEFINE_F(BM_Octree, ClassifyFrustumEntriesScalar)(benchmark::State& state)
+    {
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(state.range(0));
+        InsertEntries(entryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                uint32_t visibleCount = 0;
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += (queryData.frustum.IntersectAabb(entry->m_boundingVolume) != AZ::IntersectResult::Exterior) ? 1 : 0;
+                    }
+                });
+                benchmark::DoNotOptimize(visibleCount);
+            }
+        }
+        RemoveEntries(entryCount);
+    }
+    BENCHMARK_REGISTER_F(BM_Octree, ClassifyFrustumEntriesScalar)->Arg(10000)->Arg(100000);
+
+    BENCHMARK_DEFINE_F(BM_Octree, ClassifyFrustumEntriesSoa)(benchmark::State& state)
+    {
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(state.range(0));
+        InsertEntries(entryCount);
+        AZStd::vector<AZ::IntersectResult> results;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                uint32_t visibleCount = 0;
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount, &results](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    results.resize(nodeData.m_entries.size());
+                    nodeData.m_entryBounds->ClassifyFrustum(queryData.frustum, 0, nodeData.m_entries.size(), results.data());
+                    for (AZ::IntersectResult result : results)
+                    {
+                        visibleCount += (result != AZ::IntersectResult::Exterior) ? 1 : 0;
+                    }
+                });
+                benchmark::DoNotOptimize(visibleCount);
+            }
+        }
+        RemoveEntries(entryCount);
+    }
+    BENCHMARK_REGISTER_F(BM_Octree, ClassifyFrustumEntriesSoa)->Arg(10000)->Arg(100000);
 }
 
 #endif
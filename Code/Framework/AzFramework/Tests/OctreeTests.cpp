@@ -467,4 +467,156 @@ namespace UnitTest
         }
 
     }
+
+    void ValidateEntryBoundsMatchEntries(const IVisibilityScene* visScene)
+    {
+        visScene->EnumerateNoCull([](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            ASSERT_NE(nodeData.m_entryBounds, nullptr);
+            ASSERT_EQ(nodeData.m_entryBounds->GetSize(), nodeData.m_entries.size());
+            for (size_t i = 0; i < nodeData.m_entries.size(); ++i)
+            {
+                EXPECT_EQ(nodeData.m_entryBounds->Get(i), nodeData.m_entries[i]->m_boundingVolume);
+            }
+        });
+    }
+
+    TEST_F(OctreeTests, EntryBounds_InsertUpdateRemoveSplitMerge_BoundsStayInSyncWithEntries)
+    {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unif(-0.9f, 0.8f);
+        auto randomAabb = [&rng, &unif]()
+        {
+            const AZ::Vector3 aabbMin(unif(rng), unif(rng), unif(rng));
+            return AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(0.05f));
+        };
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(64);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume = randomAabb();
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryBoundsMatchEntries(m_octreeScene);
+
+        // Move every entry, some will stay within their current node and some will be reinserted elsewhere
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume = entry.m_boundingVolume.GetTranslated(AZ::Vector3(0.01f));
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryBoundsMatchEntries(m_octreeScene);
+
+        // Removing every other entry exercises the swap and pop path as well as merges
+        for (size_t i = 0; i < visEntries.size(); i += 2)
+        {
+            m_octreeScene->RemoveEntry(visEntries[i]);
+        }
+        ValidateEntryBoundsMatchEntries(m_octreeScene);
+
+        for (size_t i = 1; i < visEntries.size(); i += 2)
+        {
+            m_octreeScene->RemoveEntry(visEntries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, EntryBounds_ClassifyFrustum_MatchesFrustumIntersectAabb)
+    {
+        std::mt19937 rng(2);
+        std::uniform_real_distribution<float> unif(-4.0f, 4.0f);
+
+        // Use a count that is not a multiple of the SIMD width so the remainder path is covered
+        AzFramework::VisibilityEntryBounds entryBounds;
+        AZStd::vector<AZ::Aabb> aabbs;
+        for (uint32_t i = 0; i < 1001; ++i)
+        {
+            const AZ::Vector3 aabbMin(unif(rng), unif(rng), unif(rng));
+            const AZ::Vector3 aabbExtents = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.25f;
+            aabbs.push_back(AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + aabbExtents));
+            entryBounds.PushBack(aabbs.back());
+        }
+
+        const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 1.0f, 0.0f).GetNormalized(), 0.3f), AZ::Vector3(0.0f, -3.0f, 0.0f));
+        const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 0.5f, 5.0f));
+
+        AZStd::vector<AZ::IntersectResult> results(aabbs.size());
+        entryBounds.ClassifyFrustum(frustum, 0, aabbs.size(), results.data());
+
+        uint32_t resultCounts[3] = {};
+        for (size_t i = 0; i < aabbs.size(); ++i)
+        {
+            EXPECT_EQ(results[i], frustum.IntersectAabb(aabbs[i]));
+            ++resultCounts[static_cast<uint32_t>(results[i])];
+        }
+
+        // Make sure the data set actually exercises all three outcomes
+        EXPECT_GT(resultCounts[static_cast<uint32_t>(AZ::IntersectResult::Interior)], 0);
+        EXPECT_GT(resultCounts[static_cast<uint32_t>(AZ::IntersectResult::Overlaps)], 0);
+        EXPECT_GT(resultCounts[static_cast<uint32_t>(AZ::IntersectResult::Exterior)], 0);
+
+        // Classifying a sub range must produce the same results as the full range
+        entryBounds.ClassifyFrustum(frustum, 3, 10, results.data());
+        for (size_t i = 3; i < 10; ++i)
+        {
+            EXPECT_EQ(results[i - 3], frustum.IntersectAabb(aabbs[i]));
+        }
+    }
+
+    TEST_F(OctreeTests, EnumerateMultipleFrustums_MasksMatchSingleFrustumEnumerate)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.1f), AZ::Vector3(0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.6f), AZ::Vector3(0.9f));
+        for (AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        // One frustum covering the whole world, one covering only the -x half and one looking away from the world
+        const AZ::Frustum frustums[] = {
+            AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, -2.0f, 0.0f)), 1.0f, 2.0f * atanf(2.0f), 0.5f, 5.0f)),
+            AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateTranslation(AZ::Vector3(-0.5f, -2.0f, 0.0f)), 1.0f, 2.0f * atanf(0.2f), 0.5f, 5.0f)),
+            AZ::Frustum(AZ::ViewFrustumAttributes(
+                AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi), AZ::Vector3(0.0f, -2.0f, 0.0f)),
+                1.0f, 2.0f * atanf(0.5f), 0.5f, 5.0f)) };
+        constexpr uint32_t FrustumCount = AZ_ARRAY_SIZE(frustums);
+
+        AZStd::vector<VisibilityEntry*> multiFrustumEntries[FrustumCount];
+        m_octreeScene->Enumerate(frustums, FrustumCount,
+            [&multiFrustumEntries](const AzFramework::IVisibilityScene::NodeData& nodeData, IVisibilityScene::FrustumMask overlapMask, IVisibilityScene::FrustumMask containedMask)
+            {
+                EXPECT_EQ(containedMask & ~overlapMask, 0u);
+                for (uint32_t i = 0; i < FrustumCount; ++i)
+                {
+                    if (overlapMask & (1u << i))
+                    {
+                        AppendEntries(multiFrustumEntries[i], nodeData);
+                    }
+                }
+            });
+
+        for (uint32_t i = 0; i < FrustumCount; ++i)
+        {
+            AZStd::vector<VisibilityEntry*> singleFrustumEntries;
+            m_octreeScene->Enumerate(frustums[i], [&singleFrustumEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                AppendEntries(singleFrustumEntries, nodeData);
+            });
+
+            AZStd::sort(singleFrustumEntries.begin(), singleFrustumEntries.end());
+            AZStd::sort(multiFrustumEntries[i].begin(), multiFrustumEntries[i].end());
+            EXPECT_EQ(singleFrustumEntries, multiFrustumEntries[i]);
+        }
+
+        EXPECT_EQ(multiFrustumEntries[0].size(), 3);
+        EXPECT_TRUE(multiFrustumEntries[2].empty());
+
+        for (AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+    }
 }
@@ -94,29 +94,39 @@ namespace AzNetworking
 
     void TcpConnection::UpdateSend()
     {
-        const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
-        if (numSendBytes <= 0)
+        // Keep sending until the ringbuffer is empty or the socket would block, edge triggered socket managers won't notify us again otherwise
+        for (;;)
         {
-            return;
-        }
+            const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
+            if (numSendBytes <= 0)
+            {
+                return;
+            }
 
-        uint8_t* sendData = m_sendRingbuffer.GetReadBufferData();
-        const int32_t sentBytes = m_socket->Send(sendData, numSendBytes);
-        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
-        if (disconnectReason != DisconnectReason::MAX)
-        {
-            Disconnect(disconnectReason, TerminationEndpoint::Remote);
-            return;
-        }
+            uint8_t* sendData = m_sendRingbuffer.GetReadBufferData();
+            const int32_t sentBytes = m_socket->Send(sendData, numSendBytes);
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                return;
+            }
 
-        m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
-        m_networkInterface.GetMetrics().m_sendBytes += numSendBytes;
-        m_networkInterface.GetMetrics().m_sendBytesUncompressed += numSendBytes;
+            m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
+            m_networkInterface.GetMetrics().m_sendBytes += numSendBytes;
+            m_networkInterface.GetMetrics().m_sendBytesUncompressed += numSendBytes;
 
-        if (m_socket->IsEncrypted() && sentBytes > 0)
-        {
-            m_networkInterface.GetMetrics().m_sendBytesEncryptionInflation += (aznumeric_cast<uint32_t>(sentBytes) - numSendBytes);
-            m_networkInterface.GetMetrics().m_sendPacketsEncrypted++;
+            if (m_socket->IsEncrypted() && sentBytes > 0)
+            {
+                m_networkInterface.GetMetrics().m_sendBytesEncryptionInflation += (aznumeric_cast<uint32_t>(sentBytes) - numSendBytes);
+                m_networkInterface.GetMetrics().m_sendPacketsEncrypted++;
+            }
+
+            if (aznumeric_cast<uint32_t>(sentBytes) < numSendBytes)
+            {
+                // Socket send buffer is full, we'll be notified once it drains
+                return;
+            }
         }
     }
 
@@ -125,62 +135,71 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Edge triggered socket managers only notify once per readiness change, so keep reading until the socket is drained
+        // Packets are processed between reads so a fast sender can't fill the receive ringbuffer
+        bool socketDrained = false;
+        while (!socketDrained && (m_state != ConnectionState::Disconnected))
         {
-            uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
-            if (srcData == nullptr)
+            // Read new data off the input socket
             {
-                AZLOG_ERROR("Receive ringbuffer full, dropped connection");
-                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                return false;
-            }
-
-            const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
-            if (receivedBytes == 0)
-            {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
-            }
+                uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
+                if (srcData == nullptr)
+                {
+                    AZLOG_ERROR("Receive ringbuffer full, dropped connection");
+                    Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                    return false;
+                }
 
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                Disconnect(disconnectReason, TerminationEndpoint::Remote);
-                return true;
-            }
-            m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
-            m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
-            m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
-        }
+                const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
+                if (receivedBytes == 0)
+                {
+                    // No data on the socket, can happen if we're not in select or epoll mode
+                    break;
+                }
 
-        // Process received packets
-        for (;;)
-        {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
+                const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
+                if (disconnectReason != DisconnectReason::MAX)
+                {
+                    Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                    return true;
+                }
+                m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
+                m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
+                m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
-            {
-                break;
+                // A short read from a plain socket means the kernel buffer is empty, TLS reads return a single record at a time so must read until they would block
+                socketDrained = !m_socket->IsEncrypted() && (aznumeric_cast<uint32_t>(receivedBytes) < MaxPacketSize);
             }
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-            if (m_state == ConnectionState::Connecting)
+            // Process received packets
+            for (;;)
             {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
+                TcpPacketHeader header(PacketType(0), 0);
+                TcpPacketEncodingBuffer buffer;
+
+                if (!ReceivePacketInternal(header, buffer, startTimeMs))
                 {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    break;
                 }
-                else
+
+                NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+                if (m_state == ConnectionState::Connecting)
                 {
-                    m_state = ConnectionState::Connected;
+                    const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                    if (connectResult == ConnectResult::Rejected)
+                    {
+                        Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    }
+                    else
+                    {
+                        m_state = ConnectionState::Connected;
+                    }
                 }
-            }
 
-            if (m_state == ConnectionState::Connected)
-            {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                if (m_state == ConnectionState::Connected)
+                {
+                    m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                }
             }
         }
 
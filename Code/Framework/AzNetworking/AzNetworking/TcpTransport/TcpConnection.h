@@ -76,10 +76,10 @@ namespace AzNetworking
         //! @return boolean true on success
         bool Connect(uint16_t localPort);
 
-        //! Handles any new outgoing network traffic.
+        //! Handles any new outgoing network traffic, sending until the send ringbuffer is empty or the socket would block.
         void UpdateSend();
 
-        //! Handles any new incoming network traffic.
+        //! Handles any new incoming network traffic, reading until the socket would block.
         //! @return boolean true if the socket is still active, false if it has been remotely terminated
         bool UpdateRecv();
 
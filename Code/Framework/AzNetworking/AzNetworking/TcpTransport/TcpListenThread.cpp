@@ -125,7 +125,11 @@ namespace AzNetworking
             {
                 if (listenPort.m_listenSocket.GetSocketFd() == socketFd)
                 {
-                    HandleSocketAccept((void*)&newConnection, connectionLength, listenPort);
+                    // Accept everything pending, edge triggered socket managers only report the listen socket as readable once
+                    while ((listenPort.m_tcpNetworkInterface != nullptr) && HandleSocketAccept((void*)&newConnection, connectionLength, listenPort))
+                    {
+                        ;
+                    }
                 }
             };
             m_listenPorts.Visit(visitor);
@@ -175,7 +179,10 @@ namespace AzNetworking
         if (newSocketFd <= SocketFd{ 0 })
         {
             const int32_t error = GetLastNetworkError();
-            AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
+            if (!ErrorIsWouldBlock(error)) // No more pending connections
+            {
+                AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
             return false;
         }
 
@@ -29,6 +29,7 @@ namespace AzNetworking
         using SocketEventCallback = AZStd::function<void(SocketFd)>;
 
         TcpSocketManager();
+        ~TcpSocketManager();
 
         //! Adds the provided socket to the internal socket management mechanism.
         //! @param socketFd the socket file descriptor to add
@@ -41,6 +42,7 @@ namespace AzNetworking
         bool ClearSocket(SocketFd socketFd);
 
         //! Processes any pending events for the set of sockets currently managed by this instance.
+        //! Under epoll sockets are edge triggered, callbacks must drain a socket until it would block or they will not be notified again.
         //! @param maxBlockMs    the maximum milliseconds to block while gathering events
         //! @param readCallback  functor to invoke if a socket has pending data to read
         //! @param writeCallback functor to invoke if a socket is ready for writing
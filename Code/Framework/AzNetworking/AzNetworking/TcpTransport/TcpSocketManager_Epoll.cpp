@@ -11,6 +11,9 @@
 
 #if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
 
+#include <errno.h>
+#include <unistd.h>
+
 namespace AzNetworking
 {
     static constexpr uint32_t MaxEpollEvents = 256;
@@ -28,6 +31,11 @@ namespace AzNetworking
         }
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        ::close(static_cast<int32_t>(m_epollFd));
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd < SocketFd{ 0 })
@@ -35,8 +43,9 @@ namespace AzNetworking
             return false;
         }
 
+        // Edge triggered, so each readiness change is reported exactly once, consumers are expected to drain until the socket would block
         struct epoll_event fdEvents;
-        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
         fdEvents.data.fd = static_cast<int32_t>(socketFd);
 
         if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, static_cast<int32_t>(socketFd), &fdEvents) < 0)
@@ -52,6 +61,10 @@ namespace AzNetworking
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
+        // Closing a socket implicitly removes it from the epoll set, but sockets may be cleared while still open
+        // The event argument is ignored, but must be non-null on older kernels
+        struct epoll_event fdEvents = {};
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), &fdEvents);
         ClearSocketHelper(socketFd);
         return true;
     }
@@ -59,28 +72,44 @@ namespace AzNetworking
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
-        if (numEpollEvents < 0)
+        int32_t blockTimeMs = static_cast<int32_t>(maxBlockMs);
+        for (;;)
         {
-            const int32_t error = GetLastNetworkError();
-            AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
-        }
+            const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, blockTimeMs);
+            if (numEpollEvents < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (error != EINTR)
+                {
+                    AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                return;
+            }
 
-        if (numEpollEvents > 0)
-        {
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+                const uint32_t events = socketEvents[event].events;
+
+                // Errors and hangups are surfaced through the read callback, the subsequent recv reports the actual failure
+                if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
                 {
                     readCallback(socketFd);
                 }
 
-                if (socketEvents[event].events & EPOLLOUT)
+                if (events & EPOLLOUT)
                 {
                     writeCallback(socketFd);
                 }
             }
+
+            if (numEpollEvents < static_cast<int32_t>(MaxEpollEvents))
+            {
+                break;
+            }
+
+            // A full batch means more sockets may be ready, keep draining the ready list without blocking
+            blockTimeMs = 0;
         }
     }
 }
@@ -18,6 +18,11 @@ namespace AzNetworking
         ;
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        ;
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         AddSocketHelper(socketFd);
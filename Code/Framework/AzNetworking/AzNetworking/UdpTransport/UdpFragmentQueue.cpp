@@ -13,6 +13,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
 
 namespace AzNetworking
 {
@@ -22,9 +23,9 @@ namespace AzNetworking
     {
         m_timeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item)
         {
-            const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData & 0xFF);
+            const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData);
             AZLOG(NET_FragmentQueue, "Timing out unreliable fragmented packet %u", static_cast<uint32_t>(fragmentSequence));
-            m_packetFragments.erase(fragmentSequence);
+            ReleaseSequence(fragmentSequence);
             return TimeoutResult::Delete;
         });
     }
@@ -33,6 +34,10 @@ namespace AzNetworking
     {
         m_timeoutQueue.Reset();
         m_sequenceGenerator.Reset();
+        for (auto& packetFragment : m_packetFragments)
+        {
+            ReleaseSlab(AZStd::move(packetFragment.second));
+        }
         m_packetFragments.clear();
         m_latestReceivedFragmentSequence = InvalidSequenceId;
         m_deliveredFragments.Reset();
@@ -45,16 +50,155 @@ namespace AzNetworking
 
     PacketDispatchResult UdpFragmentQueue::ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer)
     {
-        AZStd::unique_ptr<CorePackets::FragmentedPacket> packet = AZStd::make_unique<CorePackets::FragmentedPacket>();
+        const bool isReliable = header.GetIsReliable();
 
-        if (!serializer.Serialize(*packet, "Packet"))
+        ChunkReader chunk{ *this };
+        if (!serializer.Serialize(chunk, "Packet"))
         {
-            AZLOG(NET_FragmentQueue, "Fragment failed serialization");
-            return PacketDispatchResult::Failure;
+            if (chunk.m_result == PacketDispatchResult::Failure)
+            {
+                AZLOG(NET_FragmentQueue, "Fragment failed serialization");
+            }
+            // Otherwise the chunk was intentionally skipped, either a duplicate or part of an already delivered packet
+            return chunk.m_result;
         }
 
-        const bool isReliable = header.GetIsReliable();
-        const SequenceId fragmentSequence = packet->GetFragmentSequence();
+        const SequenceId fragmentSequence = chunk.m_fragmentSequence;
+        ReassemblySlab* slab = chunk.m_slab;
+        if (slab->m_receivedCount < slab->m_chunkCount)
+        {
+            if (!isReliable)
+            {
+                if (slab->m_hasTimeout)
+                {
+                    // Every newly received chunk pushes the timeout back, so only packets that stop making progress are timed out
+                    if (TimeoutQueue::TimeoutItem* item = m_timeoutQueue.RetrieveItem(slab->m_timeoutId))
+                    {
+                        item->UpdateTimeoutTime(AZ::GetElapsedTimeMs());
+                    }
+                }
+                else
+                {
+                    slab->m_timeoutId = m_timeoutQueue.RegisterItem(static_cast<uint64_t>(fragmentSequence), net_UdpFragmentTimeoutMs);
+                    slab->m_hasTimeout = true;
+                }
+            }
+
+            // We haven't received all chunks required to complete this packet yet
+            return PacketDispatchResult::Success;
+        }
+
+        // We now mark this sequence as delivered, so if by some chance all the individual chunks get redelivered again we don't double deliver the reconstructed packet
+        m_deliveredFragments.SetBit(chunk.m_sequenceDelta, true);
+
+        // Detach the slab before dispatching, delivery may end up resetting this queue
+        auto iter = m_packetFragments.find(fragmentSequence);
+        AZStd::unique_ptr<ReassemblySlab> completedSlab = AZStd::move(iter->second);
+        m_packetFragments.erase(iter);
+        if (completedSlab->m_hasTimeout)
+        {
+            m_timeoutQueue.RemoveItem(completedSlab->m_timeoutId);
+        }
+
+        // All chunks were deserialized in place, so the slab already holds the original contiguous packet
+        const uint32_t totalPacketSize = (completedSlab->m_chunkCount - 1) * completedSlab->m_chunkStride + completedSlab->m_lastChunkSize;
+        NetworkOutputSerializer networkSerializer(completedSlab->m_buffer.data(), totalPacketSize);
+        PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
+        {
+            ISerializer& networkISerializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            // First, serialize out the header
+            if (!header.SerializePacketFlags(networkSerializer))
+            {
+                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
+            }
+            else if (!networkISerializer.Serialize(header, "Header"))
+            {
+                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
+            }
+            else
+            {
+                connection->GetPacketTracker().ProcessReceived(connection, header);
+                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+                {
+                    handledPacket = connection->HandleCorePacket(connectionListener, header, networkSerializer);
+                }
+                else
+                {
+                    handledPacket = connectionListener.OnPacketReceived(connection, header, networkSerializer);
+                }
+            }
+        }
+
+        ReleaseSlab(AZStd::move(completedSlab));
+        return handledPacket;
+    }
+
+    void UdpFragmentQueue::ReassemblySlab::Reset(uint32_t chunkCount)
+    {
+        m_receivedChunks.reset();
+        m_hasTimeout = false;
+        m_chunkCount = chunkCount;
+        m_receivedCount = 0;
+        m_chunkStride = 0;
+        m_lastChunkSize = 0;
+        m_lastChunkParked = false;
+    }
+
+    bool UdpFragmentQueue::ChunkReader::Serialize(ISerializer& serializer)
+    {
+        // Stands in for the ChunkBuffer member so the payload is wrapped exactly as ByteBuffer would be
+        struct ChunkBufferReader
+        {
+            bool Serialize(ISerializer& serializer)
+            {
+                return m_chunk.SerializeChunkBuffer(serializer);
+            }
+            ChunkReader& m_chunk;
+        };
+
+        ChunkBufferReader chunkBuffer{ *this };
+        serializer.Serialize(m_unfragmentedSequence, "unfragmentedSequence");
+        serializer.Serialize(m_fragmentSequence, "fragmentSequence");
+        serializer.Serialize(m_chunkIndex, "chunkIndex");
+        serializer.Serialize(m_chunkCount, "chunkCount");
+        return serializer.IsValid() && serializer.Serialize(chunkBuffer, "chunkBuffer");
+    }
+
+    bool UdpFragmentQueue::ChunkReader::SerializeChunkBuffer(ISerializer& serializer)
+    {
+        // Must match ByteBuffer<MaxUdpTransmissionUnit>::Serialize
+        using SizeType = typename AZ::SizeType<AZ::RequiredBytesForValue<MaxUdpTransmissionUnit>(), false>::Type;
+
+        SizeType size = 0;
+        if (!serializer.Serialize(size, "Size"))
+        {
+            return false;
+        }
+
+        uint8_t* destination = m_fragmentQueue.ReserveChunk(*this, static_cast<uint32_t>(size));
+        if (destination == nullptr)
+        {
+            return false;
+        }
+
+        uint32_t outSize = size;
+        if (!serializer.SerializeBytes(destination, MaxUdpTransmissionUnit, false, outSize, "Buffer") || (outSize != size))
+        {
+            m_result = PacketDispatchResult::Failure;
+            return false;
+        }
+
+        m_slab->m_receivedChunks.set(m_chunkIndex);
+        ++m_slab->m_receivedCount;
+        m_result = PacketDispatchResult::Success;
+        return true;
+    }
+
+    uint8_t* UdpFragmentQueue::ReserveChunk(ChunkReader& chunk, uint32_t chunkSize)
+    {
+        chunk.m_result = PacketDispatchResult::Failure;
+        const SequenceId fragmentSequence = chunk.m_fragmentSequence;
 
         if (SequenceMoreRecent(fragmentSequence, m_latestReceivedFragmentSequence))
         {
@@ -63,110 +207,133 @@ namespace AzNetworking
             m_deliveredFragments.PushBackBits(static_cast<uint32_t>(sequenceDelta));
         }
 
-        const SequenceId sequenceDelta = SequenceId(m_latestReceivedFragmentSequence - fragmentSequence);
+        chunk.m_sequenceDelta = static_cast<uint32_t>(SequenceId(m_latestReceivedFragmentSequence - fragmentSequence));
 
-        if (static_cast<uint32_t>(sequenceDelta) >= m_deliveredFragments.GetValidBitCount())
+        if (chunk.m_sequenceDelta >= m_deliveredFragments.GetValidBitCount())
         {
             // Too old to process
             AZLOG(NET_FragmentQueue, "Fragment sequence ID is outside our tracked window");
-            return PacketDispatchResult::Failure;
+            return nullptr;
         }
 
-        if (m_deliveredFragments.GetBit(static_cast<uint32_t>(sequenceDelta)))
+        if (m_deliveredFragments.GetBit(chunk.m_sequenceDelta))
         {
             // Received packet is a duplicate of one already forwarded to gameplay
             AZLOG(NET_FragmentQueue, "Received duplicate of fragmented packet %u, discarding", static_cast<uint32_t>(fragmentSequence));
-            return PacketDispatchResult::Success;
+            chunk.m_result = PacketDispatchResult::Success;
+            return nullptr;
         }
 
-        const uint32_t chunkCount = packet->GetChunkCount();
-        const uint32_t chunkIndex = packet->GetChunkIndex();
-
-        // If this is the first time we've heard about this sequence, resize the vector appropriately
-        const bool isNewPacketFragment = m_packetFragments.find(fragmentSequence) == m_packetFragments.end();
-        PacketFragments& packetFragments = m_packetFragments[fragmentSequence];
+        const uint32_t chunkCount = chunk.m_chunkCount;
+        const uint32_t chunkIndex = chunk.m_chunkIndex;
 
-        if (isNewPacketFragment)
+        ReassemblySlab* slab = nullptr;
+        auto iter = m_packetFragments.find(fragmentSequence);
+        if (iter == m_packetFragments.end())
+        {
+            slab = (chunkCount > 0) ? AcquireSlab(fragmentSequence, chunkCount) : nullptr;
+        }
+        else
         {
-            packetFragments.resize(chunkCount);
+            slab = iter->second.get();
         }
 
-        if ((chunkCount != packetFragments.size()) || (chunkIndex >= chunkCount))
+        if ((slab == nullptr) || (chunkCount != slab->m_chunkCount) || (chunkIndex >= chunkCount) || (chunkSize > MaxUdpTransmissionUnit))
         {
             // Either we disagree on the number of chunks, or chunkIndex is bigger than the expected size, bail and disconnect
-            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.size()));
-            return PacketDispatchResult::Failure;
+            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, chunkSize %u", chunkIndex, chunkCount, chunkSize);
+            return nullptr;
         }
 
-        packetFragments[chunkIndex] = AZStd::move(packet);
+        if (slab->m_receivedChunks.test(chunkIndex))
+        {
+            // Redelivered chunk, the payload we already hold is identical
+            chunk.m_result = PacketDispatchResult::Success;
+            return nullptr;
+        }
 
-        uint32_t totalPacketSize = 0;
-        for (uint32_t index = 0; index < packetFragments.size(); ++index)
+        // Every chunk except the last is the same size, so the stride learned from any non-final chunk positions all of them
+        const uint32_t lastChunkIndex = chunkCount - 1;
+        uint32_t chunkOffset = 0;
+        if (chunkIndex == lastChunkIndex)
         {
-            if (packetFragments[index] == nullptr)
+            slab->m_lastChunkSize = chunkSize;
+            if ((lastChunkIndex == 0) || (slab->m_chunkStride > 0))
             {
-                if (!isReliable)
-                {
-                    m_timeoutQueue.RegisterItem(static_cast<uint64_t>(fragmentSequence), net_UdpFragmentTimeoutMs);
-                }
-
-                // We haven't received all chunks required to complete this packet yet
-                return PacketDispatchResult::Success;
+                chunkOffset = lastChunkIndex * slab->m_chunkStride;
+            }
+            else
+            {
+                // Offset isn't known yet, park the chunk in the slack at the end of the slab until it is
+                chunkOffset = MaxPacketSize;
+                slab->m_lastChunkParked = true;
             }
-
-            totalPacketSize += static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
         }
+        else
+        {
+            if (slab->m_chunkStride == 0)
+            {
+                slab->m_chunkStride = chunkSize;
+            }
 
-        // We now mark this sequence as delivered, so if by some chance all the individual chunks get redelivered again we don't double deliver the reconstructed packet
-        m_deliveredFragments.SetBit(static_cast<uint32_t>(sequenceDelta), true);
+            if ((chunkSize == 0) || (chunkSize != slab->m_chunkStride))
+            {
+                AZLOG(NET_FragmentQueue, "Mismatched chunk size in fragmented packet, chunkIndex %u, chunkSize %u, expected %u", chunkIndex, chunkSize, slab->m_chunkStride);
+                return nullptr;
+            }
+            chunkOffset = chunkIndex * slab->m_chunkStride;
+        }
 
-        // All chunks have been received, reconstruct the original packet and deliver to the connection listener
-        UdpPacketEncodingBuffer buffer;
-        if (!buffer.Resize(totalPacketSize))
+        if (lastChunkIndex * slab->m_chunkStride + slab->m_lastChunkSize > MaxPacketSize)
         {
             AZLOG_ERROR("Fragmented packet is too large to fit in UdpPacketEncodingBuffer");
-            return PacketDispatchResult::Failure;
+            return nullptr;
         }
 
-        uint8_t* bufferPointer = buffer.GetBuffer();
-        for (uint32_t index = 0; index < packetFragments.size(); ++index)
+        if (slab->m_lastChunkParked && (slab->m_chunkStride > 0))
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
-            memcpy(bufferPointer, packetFragments[index]->GetChunkBuffer().GetBuffer(), chunkSize);
-            bufferPointer += chunkSize;
+            memmove(slab->m_buffer.data() + lastChunkIndex * slab->m_chunkStride, slab->m_buffer.data() + MaxPacketSize, slab->m_lastChunkSize);
+            slab->m_lastChunkParked = false;
         }
 
-        // We can erase all the chunks now, packet is completed
-        m_packetFragments.erase(fragmentSequence);
+        chunk.m_slab = slab;
+        return slab->m_buffer.data() + chunkOffset;
+    }
 
-        NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+    UdpFragmentQueue::ReassemblySlab* UdpFragmentQueue::AcquireSlab(SequenceId fragmentSequence, uint32_t chunkCount)
+    {
+        AZStd::unique_ptr<ReassemblySlab> slab;
+        if (m_slabPool.empty())
         {
-            ISerializer& networkISerializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
-
-            // First, serialize out the header
-            if (!header.SerializePacketFlags(networkSerializer))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
-                return PacketDispatchResult::Failure;
-            }
-
-            if (!networkISerializer.Serialize(header, "Header"))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
-                return PacketDispatchResult::Failure;
-            }
+            slab = AZStd::make_unique<ReassemblySlab>();
         }
-        connection->GetPacketTracker().ProcessReceived(connection, header);
-        PacketDispatchResult handledPacket;
-        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+        else
         {
-            handledPacket = connection->HandleCorePacket(connectionListener, header, networkSerializer);
+            slab = AZStd::move(m_slabPool.back());
+            m_slabPool.pop_back();
         }
-        else
+
+        slab->Reset(chunkCount);
+        ReassemblySlab* result = slab.get();
+        m_packetFragments.emplace(fragmentSequence, AZStd::move(slab));
+        return result;
+    }
+
+    void UdpFragmentQueue::ReleaseSlab(AZStd::unique_ptr<ReassemblySlab> slab)
+    {
+        if ((slab != nullptr) && (m_slabPool.size() < MaxPooledSlabs))
         {
-            handledPacket = connectionListener.OnPacketReceived(connection, header, networkSerializer);
+            m_slabPool.push_back(AZStd::move(slab));
         }
+    }
 
-        return handledPacket;
+    void UdpFragmentQueue::ReleaseSequence(SequenceId fragmentSequence)
+    {
+        auto iter = m_packetFragments.find(fragmentSequence);
+        if (iter != m_packetFragments.end())
+        {
+            ReleaseSlab(AZStd::move(iter->second));
+            m_packetFragments.erase(iter);
+        }
     }
 }
@@ -15,7 +15,11 @@
 #include <AzNetworking/DataStructures/RingBufferBitset.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/bitset.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
@@ -25,6 +29,8 @@ namespace AzNetworking
 
     //! @class UdpFragmentQueue
     //! @brief Class for reconstructing packet chunks into the original unsegmented packet.
+    //! Chunk payloads are deserialized directly into their final offset within a pooled reassembly slab,
+    //! and the completed packet is dispatched straight out of that slab without any intermediate copies.
     class UdpFragmentQueue
     {
 
@@ -50,11 +56,59 @@ namespace AzNetworking
 
     private:
 
+        static constexpr uint32_t MaxChunkCount = 256; // FragmentedPacket chunk indices are 8 bits
+        static constexpr uint32_t MaxPooledSlabs = 8; // Number of idle reassembly slabs retained for reuse
+
+        //! Reassembly storage for a single fragmented sequence.
+        //! Every chunk but the last shares the same size, so a chunk's final offset is known as soon as any non-final chunk has been seen.
+        struct ReassemblySlab
+        {
+            void Reset(uint32_t chunkCount);
+
+            // Chunk data is bounds checked against the ChunkBuffer capacity rather than its actual size before it is written,
+            // the trailing MTU of slack absorbs that and doubles as the parking space for a final chunk that arrives before its offset is known
+            AZStd::array<uint8_t, MaxPacketSize + MaxUdpTransmissionUnit> m_buffer;
+            AZStd::bitset<MaxChunkCount> m_receivedChunks;
+            TimeoutId m_timeoutId = TimeoutId{ 0 };
+            bool m_hasTimeout = false;
+            uint32_t m_chunkCount = 0;
+            uint32_t m_receivedCount = 0;
+            uint32_t m_chunkStride = 0; // Size of every non-final chunk, zero until one has been received
+            uint32_t m_lastChunkSize = 0;
+            bool m_lastChunkParked = false;
+        };
+
+        //! Mirrors the serialization layout of CorePackets::FragmentedPacket, but resolves the chunk payload destination after the chunk metadata has been read.
+        struct ChunkReader
+        {
+            bool Serialize(ISerializer& serializer);
+            bool SerializeChunkBuffer(ISerializer& serializer);
+
+            UdpFragmentQueue& m_fragmentQueue;
+            SequenceId m_unfragmentedSequence = InvalidSequenceId;
+            SequenceId m_fragmentSequence = InvalidSequenceId;
+            uint8_t m_chunkIndex = 0;
+            uint8_t m_chunkCount = 0;
+            ReassemblySlab* m_slab = nullptr;
+            uint32_t m_sequenceDelta = 0;
+            PacketDispatchResult m_result = PacketDispatchResult::Failure;
+        };
+
+        //! Validates chunk metadata and returns the location the chunk payload should be deserialized to.
+        //! @param chunk     the partially deserialized chunk
+        //! @param chunkSize the serialized payload size of the chunk
+        //! @return pointer to the chunk destination, or nullptr if the payload should not be read, in which case chunk.m_result holds the outcome
+        uint8_t* ReserveChunk(ChunkReader& chunk, uint32_t chunkSize);
+
+        ReassemblySlab* AcquireSlab(SequenceId fragmentSequence, uint32_t chunkCount);
+        void ReleaseSlab(AZStd::unique_ptr<ReassemblySlab> slab);
+        void ReleaseSequence(SequenceId fragmentSequence);
+
         TimeoutQueue m_timeoutQueue;
         SequenceGenerator m_sequenceGenerator;
 
-        using PacketFragments = AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>>;
-        AZStd::unordered_map<SequenceId, PacketFragments> m_packetFragments;
+        AZStd::unordered_map<SequenceId, AZStd::unique_ptr<ReassemblySlab>> m_packetFragments;
+        AZStd::vector<AZStd::unique_ptr<ReassemblySlab>> m_slabPool;
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
@@ -555,12 +555,16 @@ namespace AzNetworking
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+            // A single fragment is reused for every chunk, so each chunk is only copied once into the fragment before being serialized for send
+            CorePackets::FragmentedPacket fragmentedPacket;
+            fragmentedPacket.SetUnfragmentedSequence(ToSequenceId(localPacketId));
+            fragmentedPacket.SetFragmentSequence(fragmentedSequence);
+            fragmentedPacket.SetChunkCount(aznumeric_cast<uint8_t>(numChunks));
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
                 const SequenceId chunkReliableId = (net_FragmentsAlwaysReliable || reliabilityType == ReliabilityType::Reliable)
                     ? connection.m_reliableQueue.GetNextSequenceId()
                     : InvalidSequenceId;
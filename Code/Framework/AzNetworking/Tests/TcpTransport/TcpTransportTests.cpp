@@ -7,6 +7,9 @@
  */
 
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/TcpTransport/TcpSocket.h>
+#include <AzNetworking/TcpTransport/TcpSocketManager.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
@@ -190,4 +193,93 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(TcpTransportTests, TestPendingConnectionsAreDrainedInOneWakeup)
+    {
+        constexpr uint16_t ListenPort = 12346;
+        constexpr uint32_t NumTestClients = 8;
+
+        TcpSocket listenSocket;
+        ASSERT_TRUE(listenSocket.Listen(ListenPort));
+        TcpSocketManager tcpSocketManager;
+        ASSERT_TRUE(tcpSocketManager.AddSocket(listenSocket.GetSocketFd()));
+
+        // Connect blocks until the handshake completes, so every connection is pending in the backlog before the first wakeup
+        TcpSocket clientSockets[NumTestClients];
+        for (TcpSocket& clientSocket : clientSockets)
+        {
+            ASSERT_TRUE(clientSocket.Connect(IpAddress(127, 0, 0, 1, ListenPort), 0));
+        }
+
+        uint32_t numWakeups = 0;
+        AZStd::vector<AZStd::unique_ptr<TcpSocket>> acceptedSockets;
+        auto readCallback = [&numWakeups, &acceptedSockets, &listenSocket](SocketFd socketFd)
+        {
+            EXPECT_EQ(socketFd, listenSocket.GetSocketFd());
+            ++numWakeups;
+
+            // Accept until the listen socket would block, the same way TcpListenThread does
+            for (;;)
+            {
+                const SocketFd newSocketFd = aznumeric_cast<SocketFd>(::accept(aznumeric_cast<int32_t>(socketFd), nullptr, nullptr));
+                if (newSocketFd <= SocketFd{ 0 })
+                {
+                    EXPECT_TRUE(ErrorIsWouldBlock(GetLastNetworkError()));
+                    break;
+                }
+                acceptedSockets.emplace_back(AZStd::make_unique<TcpSocket>(newSocketFd));
+            }
+        };
+        auto writeCallback = [](SocketFd) {};
+
+        tcpSocketManager.ProcessEvents(AZ::TimeMs{ 1000 }, readCallback, writeCallback);
+        EXPECT_EQ(numWakeups, 1u);
+        EXPECT_EQ(acceptedSockets.size(), NumTestClients);
+
+        // Nothing is left pending, so the listen socket must not be reported again
+        tcpSocketManager.ProcessEvents(AZ::TimeMs{ 10 }, readCallback, writeCallback);
+        EXPECT_EQ(numWakeups, 1u);
+        EXPECT_EQ(acceptedSockets.size(), NumTestClients);
+    }
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(TcpTransportTests, DISABLED_TestSimultaneousConnectionsAreAllAccepted)
+    #else
+    TEST_F(TcpTransportTests, SUITE_sandbox_TestSimultaneousConnectionsAreAllAccepted)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        constexpr uint32_t NumTestClients = 8;
+
+        TestTcpServer testServer;
+
+        // The listen thread opens its socket asynchronously, wait for the first connection to get through
+        TcpSocket clientSockets[NumTestClients];
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (!clientSockets[0].Connect(IpAddress(127, 0, 0, 1, 12345), 0))
+        {
+            ASSERT_LE(AZ::GetElapsedTimeMs() - startTimeMs, TotalIterationTimeMs);
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+        }
+
+        // The rest arrive back to back, and the listen thread has to accept all of them off a single readiness edge
+        for (uint32_t i = 1; i < NumTestClients; ++i)
+        {
+            EXPECT_TRUE(clientSockets[i].Connect(IpAddress(127, 0, 0, 1, 12345), 0));
+        }
+
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+    }
 }
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
+#include <AzNetworking/UdpTransport/UdpConnection.h>
+#include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(AZ::TimeMs, net_UdpFragmentTimeoutMs);
+}
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static constexpr PacketType TestPacketType = PacketType{ static_cast<uint16_t>(static_cast<uint16_t>(CorePackets::PacketType::MAX) + 1) };
+    static constexpr uint32_t TestPayloadValueCount = 250; // 1000 bytes of payload, split into three chunks
+    static constexpr uint32_t TestChunkSize = 400;
+    static constexpr uint32_t TestChunkCount = 3;
+
+    class FragmentQueueConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            EXPECT_EQ(packetHeader.GetPacketType(), TestPacketType);
+            for (uint32_t i = 0; i < TestPayloadValueCount; ++i)
+            {
+                uint32_t value = 0;
+                EXPECT_TRUE(serializer.Serialize(value, "Value"));
+                EXPECT_EQ(value, i);
+            }
+            ++m_receivedPackets;
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ;
+        }
+
+        uint32_t m_receivedPackets = 0;
+    };
+
+    class UdpFragmentQueueTests
+        : public LeakDetectionFixture
+    {
+    public:
+
+        void SetUp() override
+        {
+            AZ::NameDictionary::Create();
+            m_name = AZ::Name(AZStd::string_view("FragmentQueueTest"));
+
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_networkingSystemComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
+
+            INetworkInterface* networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+                m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_connectionListener);
+            m_connection = AZStd::make_unique<UdpConnection>(
+                ConnectionId{ 0 }, IpAddress(127, 0, 0, 1, 12345), *static_cast<UdpNetworkInterface*>(networkInterface), ConnectionRole::Acceptor);
+            m_fragmentQueue = AZStd::make_unique<UdpFragmentQueue>();
+
+            BuildChunks();
+        }
+
+        void TearDown() override
+        {
+            m_fragmentQueue.reset();
+            m_connection.reset();
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_name);
+
+            m_networkingSystemComponent.reset();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+
+            m_name = AZ::Name();
+
+            AZ::NameDictionary::Destroy();
+        }
+
+        //! Serializes a test packet exactly as UdpNetworkInterface::SendPacket would, then splits it into fragment chunks.
+        void BuildChunks()
+        {
+            UdpPacketEncodingBuffer buffer;
+            buffer.Resize(buffer.GetCapacity());
+            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            UdpPacketHeader header(TestPacketType, SequenceId{ 1 }, InvalidSequenceId, InvalidSequenceId, 0, SequenceRolloverCount{ 0 });
+            EXPECT_TRUE(header.SerializePacketFlags(serializer));
+            EXPECT_TRUE(serializer.Serialize(header, "Header"));
+            for (uint32_t i = 0; i < TestPayloadValueCount; ++i)
+            {
+                uint32_t value = i;
+                EXPECT_TRUE(serializer.Serialize(value, "Value"));
+            }
+
+            const uint32_t packetSize = networkSerializer.GetSize();
+            ASSERT_EQ(AZ::DivideAndRoundUp(packetSize, TestChunkSize), TestChunkCount);
+
+            for (uint32_t chunkIndex = 0; chunkIndex < TestChunkCount; ++chunkIndex)
+            {
+                const uint32_t chunkOffset = chunkIndex * TestChunkSize;
+                CorePackets::FragmentedPacket& chunk = m_chunks[chunkIndex];
+                chunk.SetUnfragmentedSequence(SequenceId{ 1 });
+                chunk.SetFragmentSequence(SequenceId{ 1 });
+                chunk.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                chunk.SetChunkCount(aznumeric_cast<uint8_t>(TestChunkCount));
+                chunk.ModifyChunkBuffer().CopyValues(buffer.GetBuffer() + chunkOffset, AZStd::min(packetSize - chunkOffset, TestChunkSize));
+            }
+        }
+
+        //! Delivers a single unreliable chunk to the fragment queue under test.
+        PacketDispatchResult ReceiveChunk(uint32_t chunkIndex)
+        {
+            UdpPacketEncodingBuffer buffer;
+            buffer.Resize(buffer.GetCapacity());
+            NetworkInputSerializer inputSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            ISerializer& serializer = inputSerializer; // To get the default typeinfo parameters in ISerializer
+            EXPECT_TRUE(serializer.Serialize(m_chunks[chunkIndex], "Packet"));
+
+            UdpPacketHeader header(aznumeric_cast<PacketType>(CorePackets::PacketType::FragmentedPacket),
+                SequenceId{ static_cast<uint16_t>(chunkIndex + 1) }, InvalidSequenceId, InvalidSequenceId, 0, SequenceRolloverCount{ 0 });
+            NetworkOutputSerializer outputSerializer(buffer.GetBuffer(), inputSerializer.GetSize());
+            return m_fragmentQueue->ProcessReceivedChunk(m_connection.get(), m_connectionListener, header, outputSerializer);
+        }
+
+        void SetElapsedTimeMs(AZ::TimeMs timeMs)
+        {
+            AZ::Interface<AZ::ITime>::Get()->SetElapsedTimeMsDebug(timeMs);
+        }
+
+        AZ::Name m_name;
+        FragmentQueueConnectionListener m_connectionListener;
+        AZStd::array<CorePackets::FragmentedPacket, TestChunkCount> m_chunks;
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_networkingSystemComponent;
+        AZStd::unique_ptr<UdpConnection> m_connection;
+        AZStd::unique_ptr<UdpFragmentQueue> m_fragmentQueue;
+    };
+
+    TEST_F(UdpFragmentQueueTests, InOrderChunksAreReassembled)
+    {
+        EXPECT_EQ(ReceiveChunk(0), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 0);
+        EXPECT_EQ(ReceiveChunk(2), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 1);
+    }
+
+    TEST_F(UdpFragmentQueueTests, OutOfOrderChunksAreReassembled)
+    {
+        // The final chunk arrives before its offset is known and must be relocated once the chunk stride is learned
+        EXPECT_EQ(ReceiveChunk(2), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(0), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 0);
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 1);
+    }
+
+    TEST_F(UdpFragmentQueueTests, DuplicateChunksAreDeliveredOnce)
+    {
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(0), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 0);
+        EXPECT_EQ(ReceiveChunk(2), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 1);
+
+        // Chunks redelivered after the packet completed must not deliver it a second time
+        EXPECT_EQ(ReceiveChunk(0), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(2), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 1);
+    }
+
+    TEST_F(UdpFragmentQueueTests, StalledPacketTimesOut)
+    {
+        SetElapsedTimeMs(AZ::TimeMs{ 1000 });
+        EXPECT_EQ(ReceiveChunk(0), PacketDispatchResult::Success);
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+
+        SetElapsedTimeMs(AZ::TimeMs{ 1000 } + net_UdpFragmentTimeoutMs + AZ::TimeMs{ 1000 });
+        m_fragmentQueue->Update();
+
+        // The partial packet was discarded, so the final chunk alone can't complete it
+        EXPECT_EQ(ReceiveChunk(2), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 0);
+    }
+
+    TEST_F(UdpFragmentQueueTests, ReceivingChunksRefreshesTimeout)
+    {
+        const AZ::TimeMs timeoutMs = net_UdpFragmentTimeoutMs;
+        SetElapsedTimeMs(AZ::TimeMs{ 1000 });
+        EXPECT_EQ(ReceiveChunk(0), PacketDispatchResult::Success);
+
+        // Each chunk arrives just inside the timeout of the previous one, so the packet is still making progress
+        SetElapsedTimeMs(AZ::TimeMs{ 1000 } + timeoutMs - AZ::TimeMs{ 100 });
+        m_fragmentQueue->Update();
+        EXPECT_EQ(ReceiveChunk(1), PacketDispatchResult::Success);
+
+        SetElapsedTimeMs(AZ::TimeMs{ 1000 } + timeoutMs + timeoutMs - AZ::TimeMs{ 200 });
+        m_fragmentQueue->Update();
+        EXPECT_EQ(ReceiveChunk(2), PacketDispatchResult::Success);
+        EXPECT_EQ(m_connectionListener.m_receivedPackets, 1);
+    }
+}
@@ -322,6 +322,7 @@ namespace AZ
             //! Returns the DrawSrg from the first DrawItem that matches @drawListTag
             //! and its material pipeline matches @materialPipelineMask.
             //! The search is done only within the DrawItems of the subMesh identifiable by the tuple (@meshHandle, @lodIndex, @subMeshIndex). 
+            //! When r_meshDrawPacketCache is enabled, identical mesh instances share their DrawSrgs.
             virtual const Data::Instance<RPI::ShaderResourceGroup>& GetDrawSrg(const MeshHandle& meshHandle, uint32_t lodIndex, uint32_t subMeshIndex,
                 RHI::DrawListTag drawListTag, RHI::DrawFilterMask materialPipelineMask) const = 0;
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::Render
+{
+    //! Tracks which instances have pending per-frame work with one bit per instance, so the frame update only has to visit
+    //! the instances that were marked instead of every instance.
+    //! Each instance reserves a slot when it is added. Slots live in pages that are never moved or freed until the set is
+    //! destroyed, so Mark() is lock-free and may be called from any thread, including while the marked bits are being taken.
+    template<typename T>
+    class DirtyInstanceSet
+    {
+    public:
+        static constexpr uint32_t InvalidSlot = AZStd::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t SlotsPerWord = 64;
+        static constexpr uint32_t WordsPerPage = 64;
+        static constexpr uint32_t SlotsPerPage = SlotsPerWord * WordsPerPage;
+        static constexpr uint32_t MaxPageCount = 1024;
+
+        DirtyInstanceSet() = default;
+        DirtyInstanceSet(const DirtyInstanceSet&) = delete;
+        DirtyInstanceSet& operator=(const DirtyInstanceSet&) = delete;
+
+        ~DirtyInstanceSet()
+        {
+            for (uint32_t pageIndex = 0; pageIndex < m_pageCount.load(); ++pageIndex)
+            {
+                delete m_pages[pageIndex].load();
+            }
+        }
+
+        //! Reserves a slot for the instance. New slots start out marked so the instance is visited on the next update.
+        uint32_t AcquireSlot(T* instance)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_slotMutex);
+            uint32_t slot = InvalidSlot;
+            if (!m_freeSlots.empty())
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                const uint32_t pageCount = m_pageCount.load();
+                if (m_nextSlot == pageCount * SlotsPerPage)
+                {
+                    if (pageCount == MaxPageCount)
+                    {
+                        AZ_Assert(false, "DirtyInstanceSet is limited to %u instances.", MaxPageCount * SlotsPerPage);
+                        return InvalidSlot;
+                    }
+                    m_pages[pageCount] = aznew Page();
+                    m_pageCount = pageCount + 1;
+                }
+                slot = m_nextSlot++;
+            }
+
+            GetPage(slot).m_instances[slot % SlotsPerPage] = instance;
+            Mark(slot);
+            return slot;
+        }
+
+        //! Returns the slot to the set. Any pending mark for the slot is dropped.
+        void ReleaseSlot(uint32_t slot)
+        {
+            if (slot == InvalidSlot)
+            {
+                return;
+            }
+            AZStd::lock_guard<AZStd::mutex> lock(m_slotMutex);
+            Page& page = GetPage(slot);
+            page.m_instances[slot % SlotsPerPage] = nullptr;
+            page.m_words[(slot % SlotsPerPage) / SlotsPerWord].fetch_and(~GetSlotBit(slot));
+            m_freeSlots.push_back(slot);
+        }
+
+        //! Marks the instance in this slot as needing an update. Lock-free.
+        void Mark(uint32_t slot)
+        {
+            if (slot != InvalidSlot)
+            {
+                GetPage(slot).m_words[(slot % SlotsPerPage) / SlotsPerWord].fetch_or(GetSlotBit(slot));
+            }
+        }
+
+        //! Marks every slot that is in use.
+        void MarkAll()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_slotMutex);
+            for (uint32_t slot = 0; slot < m_nextSlot; ++slot)
+            {
+                if (GetPage(slot).m_instances[slot % SlotsPerPage])
+                {
+                    Mark(slot);
+                }
+            }
+        }
+
+        //! Returns the number of 64 bit words needed to hold a bit for every slot handed out so far.
+        size_t GetWordCount() const
+        {
+            return m_pageCount.load() * WordsPerPage;
+        }
+
+        //! Ors the marked bits into inOutWords, growing it as needed, and clears them in the set.
+        //! Instances that are marked while this runs are either taken now or stay marked for the next call.
+        void TakeMarked(AZStd::vector<uint64_t>& inOutWords)
+        {
+            const uint32_t pageCount = m_pageCount.load();
+            if (inOutWords.size() < pageCount * WordsPerPage)
+            {
+                inOutWords.resize(pageCount * WordsPerPage, 0);
+            }
+
+            for (uint32_t pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+            {
+                Page& page = *m_pages[pageIndex].load();
+                uint64_t* outWords = inOutWords.data() + pageIndex * WordsPerPage;
+                for (uint32_t wordIndex = 0; wordIndex < WordsPerPage; ++wordIndex)
+                {
+                    // Test before exchanging so clean words don't dirty their cache lines
+                    if (page.m_words[wordIndex].load(AZStd::memory_order_relaxed))
+                    {
+                        outWords[wordIndex] |= page.m_words[wordIndex].exchange(0);
+                    }
+                }
+            }
+        }
+
+        //! Calls function(T&) for every live instance whose bit is set in words[beginWord, endWord).
+        template<typename Function>
+        void ForEachInWords(const AZStd::vector<uint64_t>& words, size_t beginWord, size_t endWord, Function&& function) const
+        {
+            endWord = AZStd::min(endWord, words.size());
+            for (size_t wordIndex = beginWord; wordIndex < endWord; ++wordIndex)
+            {
+                uint64_t bits = words[wordIndex];
+                while (bits)
+                {
+                    const uint32_t slot = aznumeric_cast<uint32_t>(wordIndex * SlotsPerWord + az_ctz_u64(bits));
+                    bits &= bits - 1;
+                    if (T* instance = GetPage(slot).m_instances[slot % SlotsPerPage])
+                    {
+                        function(*instance);
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Page
+        {
+            AZStd::atomic<uint64_t> m_words[WordsPerPage] = {};
+            T* m_instances[SlotsPerPage] = {};
+        };
+
+        static uint64_t GetSlotBit(uint32_t slot)
+        {
+            return uint64_t{ 1 } << (slot % SlotsPerWord);
+        }
+
+        Page& GetPage(uint32_t slot) const
+        {
+            return *m_pages[slot / SlotsPerPage].load();
+        }
+
+        //! Pages are only ever appended, so readers never need the mutex
+        AZStd::atomic<Page*> m_pages[MaxPageCount] = {};
+        AZStd::atomic<uint32_t> m_pageCount = 0;
+
+        //! Guards slot allocation
+        AZStd::mutex m_slotMutex;
+        AZStd::vector<uint32_t> m_freeSlots;
+        uint32_t m_nextSlot = 0;
+    };
+} // namespace AZ::Render
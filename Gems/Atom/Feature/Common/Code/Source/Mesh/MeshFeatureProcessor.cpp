@@ -36,13 +36,12 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/Algorithms.h>
-#include <AzCore/Jobs/JobCompletion.h>
-#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <algorithm>
 
@@ -134,6 +133,7 @@ namespace AZ
 
             m_rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessor>();
             m_reflectionProbeFeatureProcessor = GetParentScene()->GetFeatureProcessor<ReflectionProbeFeatureProcessor>();
+            m_simulatePartitionCount = AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
             m_handleGlobalShaderOptionUpdate = RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler
             {
                 [this](const AZ::Name&, RPI::ShaderOptionValue) { m_forceRebuildDrawPackets = true; }
@@ -197,6 +197,7 @@ namespace AZ
             m_rayTracingFeatureProcessor = nullptr;
             m_reflectionProbeFeatureProcessor = nullptr;
             m_forceRebuildDrawPackets = false;
+            m_simulateTaskGraph.reset();
 
             GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshMovedFlag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_meshMotionDrawListTag);
@@ -217,34 +218,32 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Simulate");
 
-            AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
             // If the instancing cvar has changed, we need to re-initalize the ModelDataInstances
             CheckForInstancingCVarChange();
 
-            AZStd::vector<Job*> initJobQueue = CreateInitJobQueue();
-            AZStd::vector<Job*> updateCullingJobQueue = CreateUpdateCullingJobQueue();
+            // Take the instances that were marked since the last frame. Instances that are marked by the draw packet updates
+            // are added to this set again before the culling phase.
+            m_simulateDirtyWords.clear();
+            m_dirtyInstances.TakeMarked(m_simulateDirtyWords);
+            m_simulateRemovePerMeshShaderOptionFlags = !r_enablePerMeshShaderOptionFlags && m_enablePerMeshShaderOptionFlags;
 
-            if (!r_meshInstancingEnabled)
+            if (packet.m_isTaskGraphWorker)
             {
-                // There's no need for all the init jobs to finish before any of the update culling jobs are run.
-                // Any update culling job can run once it's corresponding init job is done. So instead of separating the jobs
-                // entirely, use individual job dependencies to synchronize them. This performs better than having a big sync between them
-                ExecuteCombinedJobQueue(initJobQueue, updateCullingJobQueue, parentJob);
+                // A TaskGraphEvent can't be waited on from inside a task, so run the phases with parallel_for instead
+                RunSimulatePhasesInline();
             }
             else
             {
+                if (!m_simulateTaskGraph)
+                {
+                    BuildSimulateTaskGraph();
+                }
 
-                ExecuteSimulateJobQueue(initJobQueue, parentJob);
-                // Per-InstanceGroup work must be done after the Init jobs are complete, because the init jobs will determine which instance
-                // group each mesh belongs to and populate those instance groups
-                // Note: the Per-InstanceGroup jobs need to be created after init jobs because it's possible new instance groups are created in init jobs
-                AZStd::vector<Job*> perInstanceGroupJobQueue = CreatePerInstanceGroupJobQueue();
-                ExecuteSimulateJobQueue(perInstanceGroupJobQueue, parentJob);
-                // Updating the culling scene must happen after the per-instance group work is done
-                // because the per-instance group work will update the draw packets.
-                ExecuteSimulateJobQueue(updateCullingJobQueue, parentJob);
+                AZ::TaskGraphEvent simulateTGEvent{ "MeshFeatureProcessor Simulate Wait" };
+                m_simulateTaskGraph->Submit(&simulateTGEvent);
+                simulateTGEvent.Wait();
             }
 
             m_forceRebuildDrawPackets = false;
@@ -264,211 +263,223 @@ namespace AZ
             }
         }
 
-        AZStd::vector<Job*> MeshFeatureProcessor::CreatePerInstanceGroupJobQueue()
+        void MeshFeatureProcessor::BuildSimulateTaskGraph()
         {
-            const auto instanceManagerRanges = m_meshInstanceManager.GetParallelRanges();
-            AZStd::vector<Job*> perInstanceGroupJobQueue;
-            perInstanceGroupJobQueue.reserve(instanceManagerRanges.size());
-            RPI::Scene* scene = GetParentScene();
-            for (const auto& iteratorRange : instanceManagerRanges)
-            {
-                const auto perInstanceGroupJobLambda = [this, scene, iteratorRange]() -> void
+            static const AZ::TaskDescriptor simulateTGDesc{ "MeshFeatureProcessor::Simulate", "Graphics" };
+
+            // The graph only refers to the partition index, the work for each partition is looked up when the task runs,
+            // so the same graph can be re-submitted every frame regardless of how many instances are dirty.
+            m_simulateTaskGraph = AZStd::make_unique<AZ::TaskGraph>("MeshFeatureProcessor Simulate");
+
+            // Per-InstanceGroup work must be done after the Init work is complete, because Init determines which instance
+            // group each mesh belongs to and populates those instance groups. Updating the culling data must happen after the
+            // draw packets are updated, because the cullable refers to the draw packets.
+            AZ::TaskToken prepareDrawPacketUpdate = m_simulateTaskGraph->AddTask(
+                simulateTGDesc,
+                [this]()
                 {
-                    AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: PerInstanceGroupUpdate");
-                    for (auto instanceGroupDataIter = iteratorRange.m_begin; instanceGroupDataIter != iteratorRange.m_end;
-                         ++instanceGroupDataIter)
+                    PrepareSimulateDrawPacketUpdate();
+                });
+            AZ::TaskToken prepareUpdateCulling = m_simulateTaskGraph->AddTask(
+                simulateTGDesc,
+                [this]()
+                {
+                    PrepareSimulateUpdateCulling();
+                });
+
+            for (uint32_t partitionIndex = 0; partitionIndex < m_simulatePartitionCount; ++partitionIndex)
+            {
+                AZ::TaskToken init = m_simulateTaskGraph->AddTask(
+                    simulateTGDesc,
+                    [this, partitionIndex]()
                     {
-                        if (instanceGroupDataIter->UpdateDrawPacket(*scene, m_forceRebuildDrawPackets))
-                        {
-                            // We're going to need an interval for the root constant data that we update every frame for each draw item, so
-                            // cache that here
-                            CacheRootConstantInterval(*instanceGroupDataIter);
-                        }
-                    }
-                };
-                Job* executePerInstanceGroupJob =
-                    aznew JobFunction<decltype(perInstanceGroupJobLambda)>(perInstanceGroupJobLambda, true, nullptr); // Auto-deletes
-                perInstanceGroupJobQueue.push_back(executePerInstanceGroupJob);
+                        SimulateInit(partitionIndex);
+                    });
+                AZ::TaskToken drawPacketUpdate = m_simulateTaskGraph->AddTask(
+                    simulateTGDesc,
+                    [this, partitionIndex]()
+                    {
+                        SimulateDrawPacketUpdate(partitionIndex);
+                    });
+                AZ::TaskToken updateCulling = m_simulateTaskGraph->AddTask(
+                    simulateTGDesc,
+                    [this, partitionIndex]()
+                    {
+                        SimulateUpdateCulling(partitionIndex);
+                    });
+
+                init.Precedes(prepareDrawPacketUpdate);
+                drawPacketUpdate.Follows(prepareDrawPacketUpdate);
+                drawPacketUpdate.Precedes(prepareUpdateCulling);
+                updateCulling.Follows(prepareUpdateCulling);
             }
-            return perInstanceGroupJobQueue;
         }
 
-        AZStd::vector<Job*> MeshFeatureProcessor::CreateInitJobQueue()
+        void MeshFeatureProcessor::RunSimulatePhasesInline()
         {
-            const auto iteratorRanges = m_modelData.GetParallelRanges();
-            AZStd::vector<Job*> initJobQueue;
-            initJobQueue.reserve(iteratorRanges.size());
-            bool removePerMeshShaderOptionFlags = !r_enablePerMeshShaderOptionFlags && m_enablePerMeshShaderOptionFlags;
-            for (const auto& iteratorRange : iteratorRanges)
-            {
-                const auto initJobLambda = [this, iteratorRange, removePerMeshShaderOptionFlags]() -> void
+            // parallel_for can be waited on from task graph workers, unlike TaskGraphEvent::Wait()
+            AZ::parallel_for(0, aznumeric_cast<int>(m_simulatePartitionCount), [this](int partitionIndex)
                 {
-                    AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Init");
-
-                    for (auto modelDataIter = iteratorRange.m_begin; modelDataIter != iteratorRange.m_end; ++modelDataIter)
-                    {
-                        if (!modelDataIter->m_model)
-                        {
-                            continue; // model not loaded yet
-                        }
-
-                        if (!modelDataIter->m_flags.m_visible)
-                        {
-                            continue;
-                        }
-
-                        if (modelDataIter->m_flags.m_needsInit)
-                        {
-                            modelDataIter->Init(this);
-                        }
-
-                        if (modelDataIter->m_flags.m_objectSrgNeedsUpdate)
-                        {
-                            modelDataIter->UpdateObjectSrg(this);
-                        }
-
-                        if (modelDataIter->m_flags.m_needsSetRayTracingData)
-                        {
-                            modelDataIter->SetRayTracingData(this);
-                        }
-
-                        // If instancing is enabled, the draw packets will be updated by the per-instance group jobs,
-                        // so they don't need to be updated here
-                        if (!r_meshInstancingEnabled)
-                        {
-                            // Unset per mesh shader options
-                            if (removePerMeshShaderOptionFlags)
-                            {
-                                for (RPI::MeshDrawPacketList& drawPacketList : modelDataIter->m_meshDrawPacketListsByLod)
-                                {
-                                    for (RPI::MeshDrawPacket& drawPacket : drawPacketList)
-                                    {
-                                        m_flagRegistry->VisitTags(
-                                            [&](AZ::Name shaderOption, [[maybe_unused]] FlagRegistry::TagType tag)
-                                            {
-                                                drawPacket.UnsetShaderOption(shaderOption);
-                                            });
-                                    }
-                                }
-
-                                modelDataIter->m_cullable.m_shaderOptionFlags = 0;
-                                modelDataIter->m_cullable.m_prevShaderOptionFlags = 0;
-                            }
+                    SimulateInit(aznumeric_cast<uint32_t>(partitionIndex));
+                });
+            PrepareSimulateDrawPacketUpdate();
+            AZ::parallel_for(0, aznumeric_cast<int>(m_simulatePartitionCount), [this](int partitionIndex)
+                {
+                    SimulateDrawPacketUpdate(aznumeric_cast<uint32_t>(partitionIndex));
+                });
+            PrepareSimulateUpdateCulling();
+            AZ::parallel_for(0, aznumeric_cast<int>(m_simulatePartitionCount), [this](int partitionIndex)
+                {
+                    SimulateUpdateCulling(aznumeric_cast<uint32_t>(partitionIndex));
+                });
+        }
 
-                            // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                            // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                            // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                            // to check every one.
-                            modelDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
-                        }
-                    }
-                };
-                Job* executeInitJob = aznew JobFunction<decltype(initJobLambda)>(initJobLambda, true, nullptr); // Auto-deletes
-                initJobQueue.push_back(executeInitJob);
+        template<typename Function>
+        void MeshFeatureProcessor::ForEachSimulateDirtyInstance(uint32_t partitionIndex, Function&& function)
+        {
+            // Partitions take interleaved chunks of the dirty bits, since meshes that were added together tend to be updated together
+            constexpr size_t WordsPerChunk = 4;
+            const size_t wordCount = m_simulateDirtyWords.size();
+            for (size_t beginWord = partitionIndex * WordsPerChunk; beginWord < wordCount; beginWord += m_simulatePartitionCount * WordsPerChunk)
+            {
+                m_dirtyInstances.ForEachInWords(m_simulateDirtyWords, beginWord, beginWord + WordsPerChunk, function);
             }
-            return initJobQueue;
         }
 
-        AZStd::vector<Job*> MeshFeatureProcessor::CreateUpdateCullingJobQueue()
+        void MeshFeatureProcessor::SimulateInit(uint32_t partitionIndex)
         {
-            const auto iteratorRanges = m_modelData.GetParallelRanges();
-            AZStd::vector<Job*> updateCullingJobQueue;
-            updateCullingJobQueue.reserve(iteratorRanges.size());
+            AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Init");
 
-            for (const auto& iteratorRange : iteratorRanges)
-            {
-                const auto updateCullingJobLambda = [this, iteratorRange]() -> void
+            ForEachSimulateDirtyInstance(
+                partitionIndex,
+                [this](ModelDataInstance& modelData)
                 {
-                    AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: UpdateCulling");
+                    // Instances that are skipped here are marked again when their model is loaded or they become visible
+                    if (!modelData.m_model || !modelData.m_flags.m_visible)
+                    {
+                        return;
+                    }
 
-                    for (auto meshDataIter = iteratorRange.m_begin; meshDataIter != iteratorRange.m_end; ++meshDataIter)
+                    if (modelData.m_flags.m_needsInit)
                     {
-                        if (!meshDataIter->m_model)
-                        {
-                            continue; // model not loaded yet
-                        }
+                        modelData.Init(this);
+                    }
 
-                        if (meshDataIter->m_flags.m_cullableNeedsRebuild)
-                        {
-                            meshDataIter->BuildCullable();
-                        }
+                    if (modelData.m_flags.m_objectSrgNeedsUpdate)
+                    {
+                        modelData.UpdateObjectSrg(this);
+                    }
 
-                        if (meshDataIter->m_flags.m_cullBoundsNeedsUpdate)
-                        {
-                            meshDataIter->UpdateCullBounds(this);
-                        }
+                    if (modelData.m_flags.m_needsSetRayTracingData)
+                    {
+                        modelData.SetRayTracingData(this);
                     }
-                };
-                Job* executeUpdateGroupJob =
-                    aznew JobFunction<decltype(updateCullingJobLambda)>(updateCullingJobLambda, true, nullptr); // Auto-deletes
-                updateCullingJobQueue.push_back(executeUpdateGroupJob);
-            }
-            return updateCullingJobQueue;
+                });
         }
 
-        void MeshFeatureProcessor::ExecuteCombinedJobQueue(AZStd::span<Job*> initQueue, AZStd::span<Job*> updateCullingQueue, Job* parentJob)
+        void MeshFeatureProcessor::PrepareSimulateDrawPacketUpdate()
         {
-            AZ::JobCompletion jobCompletion;
-            for (size_t i = 0; i < initQueue.size(); ++i)
-            {
-                // Update Culling work should happen after Init is done
-                initQueue[i]->SetDependent(updateCullingQueue[i]);
-
-                // FeatureProcessor::Simulate is optionally run with a parent job.
-                if (parentJob)
-                {
-                    // When a parent job is used, we set dependencies on it and use WaitForChildren to wait for them to finish executing
-                    parentJob->StartAsChild(updateCullingQueue[i]);
-                    initQueue[i]->Start();
-                }
-                else
-                {
-                    // When a parent job is not used, we use a job completion to synchronize
-                    updateCullingQueue[i]->SetDependent(&jobCompletion);
-                    initQueue[i]->Start();
-                    updateCullingQueue[i]->Start();
-                }
-            }
-
-            if (parentJob)
+            // Init may create new instance groups, so the ranges are gathered after all of the Init work is done
+            if (!r_meshInstancingEnabled)
             {
-                parentJob->WaitForChildren();
+                m_simulateModelDataRanges = m_modelData.GetParallelRanges();
+                m_simulateInstanceGroupRanges.clear();
             }
             else
             {
-                jobCompletion.StartAndWaitForCompletion();
+                m_simulateModelDataRanges.clear();
+                m_simulateInstanceGroupRanges = m_meshInstanceManager.GetParallelRanges();
             }
         }
 
-        void MeshFeatureProcessor::ExecuteSimulateJobQueue(AZStd::span<Job*> jobQueue, Job* parentJob)
+        void MeshFeatureProcessor::SimulateDrawPacketUpdate(uint32_t partitionIndex)
         {
-            AZ::JobCompletion jobCompletion;
-            for (Job* childJob : jobQueue)
+            // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
+            // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
+            // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
+            // to check every one. Draw packets that do change mark their instances through HandleDrawPacketUpdate.
+            RPI::Scene* scene = GetParentScene();
+            for (size_t rangeIndex = partitionIndex; rangeIndex < m_simulateInstanceGroupRanges.size(); rangeIndex += m_simulatePartitionCount)
             {
-                // FeatureProcessor::Simulate is optionally run with a parent job.
-                if (parentJob)
+                AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: PerInstanceGroupUpdate");
+                const auto& iteratorRange = m_simulateInstanceGroupRanges[rangeIndex];
+                for (auto instanceGroupDataIter = iteratorRange.m_begin; instanceGroupDataIter != iteratorRange.m_end; ++instanceGroupDataIter)
                 {
-                    // When a parent job is used, we set dependencies on it and use WaitForChildren to wait for them to finish executing
-                    parentJob->StartAsChild(childJob);
-                }
-                else
-                {
-                    // When a parent job is not used, we use a job completion to synchronize
-                    childJob->SetDependent(&jobCompletion);
-                    childJob->Start();
+                    if (instanceGroupDataIter->UpdateDrawPacket(*scene, m_forceRebuildDrawPackets))
+                    {
+                        // We're going to need an interval for the root constant data that we update every frame for each draw item, so
+                        // cache that here
+                        CacheRootConstantInterval(*instanceGroupDataIter);
+                    }
                 }
             }
 
-            if (parentJob)
+            for (size_t rangeIndex = partitionIndex; rangeIndex < m_simulateModelDataRanges.size(); rangeIndex += m_simulatePartitionCount)
             {
-                parentJob->WaitForChildren();
-            }
-            else
-            {
-                jobCompletion.StartAndWaitForCompletion();
+                AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: UpdateDrawPackets");
+                const auto& iteratorRange = m_simulateModelDataRanges[rangeIndex];
+                for (auto modelDataIter = iteratorRange.m_begin; modelDataIter != iteratorRange.m_end; ++modelDataIter)
+                {
+                    if (!modelDataIter->m_model || !modelDataIter->m_flags.m_visible || modelDataIter->m_flags.m_needsInit)
+                    {
+                        continue;
+                    }
+
+                    // Unset per mesh shader options
+                    if (m_simulateRemovePerMeshShaderOptionFlags)
+                    {
+                        for (RPI::MeshDrawPacketList& drawPacketList : modelDataIter->m_meshDrawPacketListsByLod)
+                        {
+                            for (RPI::MeshDrawPacket& drawPacket : drawPacketList)
+                            {
+                                m_flagRegistry->VisitTags(
+                                    [&](AZ::Name shaderOption, [[maybe_unused]] FlagRegistry::TagType tag)
+                                    {
+                                        drawPacket.UnsetShaderOption(shaderOption);
+                                    });
+                            }
+                        }
+
+                        modelDataIter->m_cullable.m_shaderOptionFlags = 0;
+                        modelDataIter->m_cullable.m_prevShaderOptionFlags = 0;
+                    }
+
+                    modelDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
+                }
             }
         }
 
+        void MeshFeatureProcessor::PrepareSimulateUpdateCulling()
+        {
+            // Pick up the instances whose draw packets changed, their cullables need to be rebuilt this frame
+            m_dirtyInstances.TakeMarked(m_simulateDirtyWords);
+        }
+
+        void MeshFeatureProcessor::SimulateUpdateCulling(uint32_t partitionIndex)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: UpdateCulling");
+
+            ForEachSimulateDirtyInstance(
+                partitionIndex,
+                [this](ModelDataInstance& modelData)
+                {
+                    if (!modelData.m_model)
+                    {
+                        return; // model not loaded yet
+                    }
+
+                    if (modelData.m_flags.m_cullableNeedsRebuild)
+                    {
+                        modelData.BuildCullable();
+                    }
+
+                    if (modelData.m_flags.m_cullBoundsNeedsUpdate)
+                    {
+                        modelData.UpdateCullBounds(this);
+                    }
+                });
+        }
+
         void MeshFeatureProcessor::OnEndCulling(const MeshFeatureProcessor::RenderPacket& packet)
         {
             if (r_meshInstancingEnabled)
@@ -915,6 +926,7 @@ namespace AZ
                             }
 
                             modelHandle.m_flags.m_cullableNeedsRebuild = true;
+                            modelHandle.MarkForSimulate();
                             // [GHI-13619]
                             // Update the draw packets on the cullable, since we just set a shader item.
                             // BuildCullable is a bit overkill here, this could be reduced to just updating the drawPacket specific info
@@ -1008,6 +1020,8 @@ namespace AZ
             meshDataHandle->m_descriptor.m_modelChangedEventHandler.Connect(meshDataHandle->m_modelChangedEvent);
             meshDataHandle->m_descriptor.m_objectSrgCreatedHandler.Connect(meshDataHandle->m_objectSrgCreatedEvent);
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_dirtyInstanceSet = &m_dirtyInstances;
+            meshDataHandle->m_dirtyInstanceSlot = m_dirtyInstances.AcquireSlot(&*meshDataHandle);
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_rayTracingUuid = AZ::Uuid::CreateRandom();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -1034,6 +1048,7 @@ namespace AZ
                 m_transformService->ReleaseObjectId(converted->m_objectId);
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
+                m_dirtyInstances.ReleaseSlot(converted->m_dirtyInstanceSlot);
                 m_modelData.erase(converted);
 
                 return true;
@@ -1151,7 +1166,9 @@ namespace AZ
         {
             if (meshHandle.IsValid())
             {
-                ToModelDataInstance(meshHandle).m_flags.m_objectSrgNeedsUpdate = true;
+                ModelDataInstance& modelData = ToModelDataInstance(meshHandle);
+                modelData.m_flags.m_objectSrgNeedsUpdate = true;
+                modelData.MarkForSimulate();
             }
         }
 
@@ -1174,6 +1191,7 @@ namespace AZ
                 }
 
                 modelData.m_flags.m_objectSrgNeedsUpdate = true;
+                modelData.MarkForSimulate();
             }
         }
 
@@ -1284,6 +1302,7 @@ namespace AZ
                 auto& modelData = ToModelDataInstance(meshHandle);
                 modelData.m_flags.m_cullBoundsNeedsUpdate = true;
                 modelData.m_flags.m_objectSrgNeedsUpdate = true;
+                modelData.MarkForSimulate();
                 modelData.m_cullable.m_flags = modelData.m_cullable.m_flags | m_meshMovedFlag.GetIndex();
 
                 // Only set m_dynamic flag if the model instance is initialized.
@@ -1329,6 +1348,7 @@ namespace AZ
                 modelData.m_aabb = localAabb;
                 modelData.m_flags.m_cullBoundsNeedsUpdate = true;
                 modelData.m_flags.m_objectSrgNeedsUpdate = true;
+                modelData.MarkForSimulate();
             }
         };
 
@@ -1472,6 +1492,7 @@ namespace AZ
                 {
                     // add to ray tracing
                     modelData.m_flags.m_needsSetRayTracingData = true;
+                    modelData.MarkForSimulate();
                 }
                 else if (!enabled && modelData.m_descriptor.m_isRayTracingEnabled)
                 {
@@ -1525,6 +1546,7 @@ namespace AZ
                     if (visible)
                     {
                         modelData.m_flags.m_needsSetRayTracingData = true;
+                        modelData.MarkForSimulate();
                     }
                 }
             }
@@ -1537,6 +1559,7 @@ namespace AZ
                 auto& modelData = ToModelDataInstance(meshHandle);
                 modelData.m_descriptor.m_useForwardPassIblSpecular = useForwardPassIblSpecular;
                 modelData.m_flags.m_objectSrgNeedsUpdate = true;
+                modelData.MarkForSimulate();
 
                 if (modelData.m_model)
                 {
@@ -1553,7 +1576,9 @@ namespace AZ
         {
             if (meshHandle.IsValid())
             {
-                ToModelDataInstance(meshHandle).m_flags.m_needsSetRayTracingData = true;
+                ModelDataInstance& modelData = ToModelDataInstance(meshHandle);
+                modelData.m_flags.m_needsSetRayTracingData = true;
+                modelData.MarkForSimulate();
             }
         }
 
@@ -1585,6 +1610,7 @@ namespace AZ
                 if (meshInstance.m_descriptor.m_useForwardPassIblSpecular)
                 {
                     meshInstance.m_flags.m_objectSrgNeedsUpdate = true;
+                    meshInstance.MarkForSimulate();
                 }
 
                 // update the raytracing reflection probe data if necessary
@@ -1959,6 +1985,7 @@ namespace AZ
             m_model = model;
             m_flags.m_needsInit = true;
             m_aabb = m_model->GetModelAsset()->GetAabb();
+            MarkForSimulate();
         }
 
         void ModelDataInstance::Init(MeshFeatureProcessor* meshFeatureProcessor)
@@ -3135,6 +3162,15 @@ namespace AZ
         {
             m_flags.m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+            MarkForSimulate();
+        }
+
+        void ModelDataInstance::MarkForSimulate()
+        {
+            if (m_dirtyInstanceSet)
+            {
+                m_dirtyInstanceSet->Mark(m_dirtyInstanceSlot);
+            }
         }
 
         CustomMaterialInfo ModelDataInstance::GetCustomMaterialWithFallback(const CustomMaterialId& id) const
@@ -3154,6 +3190,7 @@ namespace AZ
         {
             // When the drawpacket is updated, the cullable must be rebuilt to use the latest draw packet
             m_flags.m_cullableNeedsRebuild = true;
+            MarkForSimulate();
             m_meshDrawPacketUpdatedEvent.Signal(*this, lodIndex, meshIndex, meshDrawPacket);
         }
 
@@ -18,7 +18,9 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <Mesh/DirtyInstanceSet.h>
 #include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <TransformService/TransformServiceFeatureProcessor.h>
@@ -133,6 +135,8 @@ namespace AZ
             void UpdateObjectSrg(MeshFeatureProcessor* meshFeatureProcessor);
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
+            // Queue this instance for the next MeshFeatureProcessor::Simulate. Call after setting any of the flags that Simulate handles.
+            void MarkForSimulate();
 
             // When instancing is disabled, draw packets are owned by the ModelDataInstance
             RPI::MeshDrawPacketLods m_meshDrawPacketListsByLod;
@@ -174,6 +178,10 @@ namespace AZ
 
             Aabb m_aabb = Aabb::CreateNull();
 
+            // The MeshFeatureProcessor's set of instances with pending Simulate work, and this instance's slot in it
+            DirtyInstanceSet<ModelDataInstance>* m_dirtyInstanceSet = nullptr;
+            uint32_t m_dirtyInstanceSlot = DirtyInstanceSet<ModelDataInstance>::InvalidSlot;
+
             struct Flags
             {
                 bool m_cullBoundsNeedsUpdate : 1;
@@ -309,12 +317,19 @@ namespace AZ
             void OnRenderPipelineChanged(AZ::RPI::RenderPipeline* pipeline, RPI::SceneNotification::RenderPipelineChangeType changeType) override;
 
             void CheckForInstancingCVarChange();
-            AZStd::vector<AZ::Job*> CreateInitJobQueue();
-            AZStd::vector<AZ::Job*> CreatePerInstanceGroupJobQueue();
-            AZStd::vector<AZ::Job*> CreateUpdateCullingJobQueue();
-            void ExecuteSimulateJobQueue(AZStd::span<Job*> jobQueue, Job* parentJob);
-            void ExecuteCombinedJobQueue(AZStd::span<Job*> initQueue, AZStd::span<Job*> updateCullingQueue, Job* parentJob);
-            
+
+            // Simulate runs in three phases, each split into m_simulatePartitionCount partitions:
+            // init the dirty instances, update the draw packets, then update the culling data of the dirty instances.
+            // The phases are recorded once into m_simulateTaskGraph, which is re-submitted every frame.
+            void BuildSimulateTaskGraph();
+            void RunSimulatePhasesInline();
+            void SimulateInit(uint32_t partitionIndex);
+            void PrepareSimulateDrawPacketUpdate();
+            void SimulateDrawPacketUpdate(uint32_t partitionIndex);
+            void PrepareSimulateUpdateCulling();
+            void SimulateUpdateCulling(uint32_t partitionIndex);
+            template<typename Function>
+            void ForEachSimulateDirtyInstance(uint32_t partitionIndex, Function&& function);
             
             void ResizePerViewInstanceVectors(size_t viewCount);
             void AddVisibleObjectsToBuckets(TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view);
@@ -332,6 +347,15 @@ namespace AZ
 
             MeshInstanceManager m_meshInstanceManager;
 
+            // Instances with pending Simulate work. The bits taken for the current frame are kept in m_simulateDirtyWords.
+            DirtyInstanceSet<ModelDataInstance> m_dirtyInstances;
+            AZStd::vector<uint64_t> m_simulateDirtyWords;
+            StableDynamicArray<ModelDataInstance>::ParallelRanges m_simulateModelDataRanges;
+            MeshInstanceManager::ParallelRanges m_simulateInstanceGroupRanges;
+            AZStd::unique_ptr<TaskGraph> m_simulateTaskGraph;
+            uint32_t m_simulatePartitionCount = 1;
+            bool m_simulateRemovePerMeshShaderOptionFlags = false;
+
             // SortInstanceData represents the data needed to do the sorting (sort by instance group, then by depth)
             // as well as the data being sorted (ObjectId)
             struct SortInstanceData
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TransformService/TransformPacking.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/Algorithms.h>
+
+namespace AZ::Render::TransformPacking
+{
+    // Enough matrices per chunk to keep the job overhead small next to the packing
+    static constexpr size_t ObjectsPerChunk = 2048;
+
+    static void StoreInverseTransposesRowMajorFloat12Serial(const float* __restrict matrices, float* __restrict out, size_t objectCount)
+    {
+        for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+        {
+            StoreInverseTransposeRowMajorFloat12(matrices + objectIndex * FloatsPerMatrix, out + objectIndex * FloatsPerMatrix);
+        }
+    }
+
+    void StoreInverseTransposesRowMajorFloat12(const float* matrices, float* out, size_t objectCount)
+    {
+        const size_t chunkCount = (objectCount + ObjectsPerChunk - 1) / ObjectsPerChunk;
+        if (chunkCount <= 1)
+        {
+            StoreInverseTransposesRowMajorFloat12Serial(matrices, out, objectCount);
+            return;
+        }
+
+        AZ::parallel_for(0, aznumeric_cast<int>(chunkCount), [matrices, out, objectCount](int chunkIndex)
+            {
+                const size_t beginObject = aznumeric_cast<size_t>(chunkIndex) * ObjectsPerChunk;
+                const size_t chunkObjectCount = AZStd::min(ObjectsPerChunk, objectCount - beginObject);
+                StoreInverseTransposesRowMajorFloat12Serial(
+                    matrices + beginObject * FloatsPerMatrix, out + beginObject * FloatsPerMatrix, chunkObjectCount);
+            });
+    }
+} // namespace AZ::Render::TransformPacking
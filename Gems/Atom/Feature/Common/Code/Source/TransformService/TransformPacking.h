@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ::Render::TransformPacking
+{
+    //! Number of floats in a row major 3x4 matrix, the layout of the object to world buffers.
+    constexpr size_t FloatsPerMatrix = 12;
+
+    //! Each bit of a dirty word marks one object. A word is also the granularity of buffer uploads.
+    constexpr size_t ObjectsPerDirtyWord = 64;
+
+    //! Writes the normal matrix for one row major 3x4 object to world matrix. The result matches
+    //! Matrix3x4::GetInverseFull().GetTranspose3x3(), computed from the cofactors with SIMD instead of element by element.
+    //! Like GetInverseFull(), a matrix with a zero determinant uses the identity for its inverse.
+    AZ_MATH_INLINE void StoreInverseTransposeRowMajorFloat12(const float* __restrict matrix, float* __restrict out)
+    {
+        using namespace Simd;
+
+        const Vec4::FloatType row0 = Vec4::LoadUnaligned(matrix + 0);
+        const Vec4::FloatType row1 = Vec4::LoadUnaligned(matrix + 4);
+        const Vec4::FloatType row2 = Vec4::LoadUnaligned(matrix + 8);
+        const Vec3::FloatType translation =
+            Vec3::LoadImmediate(Vec4::SelectIndex3(row0), Vec4::SelectIndex3(row1), Vec4::SelectIndex3(row2));
+
+        // The columns of the inverse are the cross products of the rows divided by the determinant,
+        // so they are the rows of the inverse transpose
+        const Vec3::FloatType axis0 = Vec4::ToVec3(row0);
+        const Vec3::FloatType axis1 = Vec4::ToVec3(row1);
+        const Vec3::FloatType axis2 = Vec4::ToVec3(row2);
+        Vec3::FloatType cofactor0 = Vec3::Cross(axis1, axis2);
+        Vec3::FloatType cofactor1 = Vec3::Cross(axis2, axis0);
+        Vec3::FloatType cofactor2 = Vec3::Cross(axis0, axis1);
+
+        const float determinant = Vec1::SelectIndex0(Vec3::Dot(axis0, cofactor0));
+        if (AZ::GetAbs(determinant) > Constants::FloatEpsilon)
+        {
+            const Vec3::FloatType determinantInv = Vec3::Splat(1.0f / determinant);
+            cofactor0 = Vec3::Mul(cofactor0, determinantInv);
+            cofactor1 = Vec3::Mul(cofactor1, determinantInv);
+            cofactor2 = Vec3::Mul(cofactor2, determinantInv);
+        }
+        else
+        {
+            cofactor0 = Vec3::LoadImmediate(1.0f, 0.0f, 0.0f);
+            cofactor1 = Vec3::LoadImmediate(0.0f, 1.0f, 0.0f);
+            cofactor2 = Vec3::LoadImmediate(0.0f, 0.0f, 1.0f);
+        }
+
+        // GetTranspose3x3() keeps the translation column of the inverse, which is -inverse * translation
+        Vec3::FloatType inverseTranslation = Vec3::Mul(cofactor0, Vec3::SplatIndex0(translation));
+        inverseTranslation = Vec3::Madd(cofactor1, Vec3::SplatIndex1(translation), inverseTranslation);
+        inverseTranslation = Vec3::Madd(cofactor2, Vec3::SplatIndex2(translation), inverseTranslation);
+
+        Vec4::StoreUnaligned(out + 0, Vec4::ReplaceIndex3(Vec4::FromVec3(cofactor0), -Vec3::SelectIndex0(inverseTranslation)));
+        Vec4::StoreUnaligned(out + 4, Vec4::ReplaceIndex3(Vec4::FromVec3(cofactor1), -Vec3::SelectIndex1(inverseTranslation)));
+        Vec4::StoreUnaligned(out + 8, Vec4::ReplaceIndex3(Vec4::FromVec3(cofactor2), -Vec3::SelectIndex2(inverseTranslation)));
+    }
+
+    //! Writes the normal matrices for objectCount consecutive matrices. Large batches are split into chunks that
+    //! are packed in parallel, so out may point straight at mapped upload memory as long as it is only written.
+    void StoreInverseTransposesRowMajorFloat12(const float* matrices, float* out, size_t objectCount);
+
+    //! Calls function(beginObject, endObject) for every run of dirty words in dirtyWords, clamped to objectCount.
+    //! Runs separated by up to maxGapWords clean words are merged, trading a few clean objects for fewer uploads.
+    template<typename Function>
+    void ForEachDirtyRange(const uint64_t* dirtyWords, size_t wordCount, size_t objectCount, size_t maxGapWords, Function&& function)
+    {
+        size_t wordIndex = 0;
+        while (wordIndex < wordCount)
+        {
+            if (!dirtyWords[wordIndex])
+            {
+                ++wordIndex;
+                continue;
+            }
+
+            const size_t beginWord = wordIndex;
+            size_t endWord = wordIndex + 1;
+            for (size_t nextWord = endWord; nextWord < wordCount && nextWord <= endWord + maxGapWords; ++nextWord)
+            {
+                if (dirtyWords[nextWord])
+                {
+                    endWord = nextWord + 1;
+                }
+            }
+            wordIndex = endWord;
+
+            const size_t beginObject = beginWord * ObjectsPerDirtyWord;
+            const size_t endObject = AZStd::min(endWord * ObjectsPerDirtyWord, objectCount);
+            if (beginObject < endObject)
+            {
+                function(beginObject, endObject);
+            }
+        }
+    }
+} // namespace AZ::Render::TransformPacking
@@ -7,12 +7,14 @@
  */
 
 #include <TransformService/TransformServiceFeatureProcessor.h>
+#include <TransformService/TransformPacking.h>
 
 #include <Atom/RHI/Factory.h>
 
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
+#include <AzCore/std/limits.h>
 
 #include <cinttypes>
 
@@ -22,6 +24,14 @@ namespace AZ
     {
         constexpr size_t BufferReserveCount = 1024;
 
+        // Dirty ranges separated by up to this many clean words are uploaded together, to avoid mapping many tiny ranges
+        constexpr size_t MaxUploadGapWords = 2;
+
+        static size_t GetDirtyWordCount(size_t objectCount)
+        {
+            return (objectCount + TransformPacking::ObjectsPerDirtyWord - 1) / TransformPacking::ObjectsPerDirtyWord;
+        }
+
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -39,7 +49,7 @@ namespace AZ
 
             m_deviceBufferNeedsUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
-            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_objectToWorldHistoryTransforms.reserve(BufferReserveCount);
 
             m_isWriteable = true;
 
@@ -49,7 +59,11 @@ namespace AZ
         void TransformServiceFeatureProcessor::Deactivate()
         {
             m_objectToWorldTransforms = {};
-            m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+            m_dirtyTransformWords = {};
+            m_historyDirtyTransformWords = {};
+            m_deviceBufferNeedsUpdate = false;
+            m_historyBufferNeedsUpdate = false;
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
@@ -67,10 +81,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersRecreated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +109,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
@@ -100,12 +117,13 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
 
             {
-                const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, static_cast<uint32_t>(m_objectToWorldInverseTransposeTransforms.size())));
+                const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, static_cast<uint32_t>(m_objectToWorldTransforms.size())));
                 static const uint32_t elementSize = NormalValueSize;
                 const uint32_t byteCount = elementCount * elementSize;
 
@@ -120,15 +138,54 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
+
+            return buffersRecreated;
+        }
+
+        void TransformServiceFeatureProcessor::MarkTransformDirty(uint32_t index)
+        {
+            const size_t wordIndex = index / TransformPacking::ObjectsPerDirtyWord;
+            if (wordIndex >= m_dirtyTransformWords.size())
+            {
+                m_dirtyTransformWords.resize(GetDirtyWordCount(m_objectToWorldTransforms.size()), 0);
+            }
+            m_dirtyTransformWords[wordIndex] |= uint64_t{ 1 } << (index % TransformPacking::ObjectsPerDirtyWord);
+            m_deviceBufferNeedsUpdate = true;
+        }
+
+        void TransformServiceFeatureProcessor::UploadInverseTransposeTransforms(size_t beginObject, size_t endObject)
+        {
+            const size_t objectCount = endObject - beginObject;
+            AZStd::unordered_map<int, void*> mappedData =
+                m_objectToWorldInverseTransposeBuffer->Map(objectCount * NormalValueSize, beginObject * NormalValueSize);
+
+            bool mapped = false;
+            for (auto& [deviceIndex, data] : mappedData)
+            {
+                if (data)
+                {
+                    // Pack into each device's memory rather than copying between them, mapped memory is slow to read back
+                    TransformPacking::StoreInverseTransposesRowMajorFloat12(
+                        m_objectToWorldTransforms[beginObject].m_transform, static_cast<float*>(data), objectCount);
+                    mapped = true;
+                }
+            }
+
+            if (mapped)
+            {
+                m_objectToWorldInverseTransposeBuffer->Unmap();
+            }
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -150,24 +207,57 @@ namespace AZ
 
             if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
             {
-                PrepareBuffers();
+                const size_t objectCount = m_objectToWorldTransforms.size();
+                if (PrepareBuffers())
+                {
+                    // New buffers start out empty, so every object has to be uploaded
+                    m_dirtyTransformWords.assign(GetDirtyWordCount(objectCount), AZStd::numeric_limits<uint64_t>::max());
+                    m_historyDirtyTransformWords.assign(m_dirtyTransformWords.size(), AZStd::numeric_limits<uint64_t>::max());
+                    m_deviceBufferNeedsUpdate = true;
+                    m_historyBufferNeedsUpdate = true;
+                }
+
                 if (m_historyBufferNeedsUpdate)
                 {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
+                    // The history transforms of last frame's dirty objects were captured after last frame's upload
+                    TransformPacking::ForEachDirtyRange(m_historyDirtyTransformWords.data(), m_historyDirtyTransformWords.size(), objectCount, MaxUploadGapWords,
+                        [this](size_t beginObject, size_t endObject)
+                        {
+                            m_objectToWorldHistoryBuffer->UpdateData(
+                                &m_objectToWorldHistoryTransforms[beginObject], (endObject - beginObject) * TransformValueSize, beginObject * TransformValueSize);
+                        });
                     m_historyBufferNeedsUpdate = false;
                 }
 
                 if (m_deviceBufferNeedsUpdate)
                 {
                     // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
-
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                    TransformPacking::ForEachDirtyRange(m_dirtyTransformWords.data(), m_dirtyTransformWords.size(), objectCount, MaxUploadGapWords,
+                        [this](size_t beginObject, size_t endObject)
+                        {
+                            m_objectToWorldBuffer->UpdateData(
+                                &m_objectToWorldTransforms[beginObject], (endObject - beginObject) * TransformValueSize, beginObject * TransformValueSize);
+                            UploadInverseTransposeTransforms(beginObject, endObject);
+                        });
+
+                    // Objects that didn't change already have the same transform in both arrays
+                    TransformPacking::ForEachDirtyRange(m_dirtyTransformWords.data(), m_dirtyTransformWords.size(), objectCount, 0,
+                        [this](size_t beginObject, size_t endObject)
+                        {
+                            memcpy(&m_objectToWorldHistoryTransforms[beginObject], &m_objectToWorldTransforms[beginObject], (endObject - beginObject) * TransformValueSize);
+                        });
+
+                    // This frame's dirty objects need their history uploaded next frame
+                    AZStd::swap(m_dirtyTransformWords, m_historyDirtyTransformWords);
+                    AZStd::fill(m_dirtyTransformWords.begin(), m_dirtyTransformWords.end(), uint64_t{ 0 });
 
                     m_deviceBufferNeedsUpdate = false;
                     m_historyBufferNeedsUpdate = true;
                 }
+                else
+                {
+                    AZStd::fill(m_historyDirtyTransformWords.begin(), m_historyDirtyTransformWords.end(), uint64_t{ 0 });
+                }
             }
         }
 
@@ -189,7 +279,6 @@ namespace AZ
             {
                 modelIndex = aznumeric_cast<uint32_t>(m_objectToWorldTransforms.size());
                 m_objectToWorldTransforms.emplace_back();
-                m_objectToWorldInverseTransposeTransforms.emplace_back();
                 m_objectToWorldHistoryTransforms.emplace_back();
             }
             return ObjectId(modelIndex);
@@ -217,9 +306,9 @@ namespace AZ
                 matrix3x4.MultiplyByScale(nonUniformScale);
                 matrix3x4.StoreToRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
 
-                // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
-                matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
-                m_deviceBufferNeedsUpdate = true;
+                // The inverse transpose that takes the non-uniform scale out of the transform for usage with normals is computed
+                // in bulk when the dirty transforms are uploaded.
+                MarkTransformDirty(id.GetIndex());
             }
         }
 
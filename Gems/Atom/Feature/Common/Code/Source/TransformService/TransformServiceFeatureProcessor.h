@@ -65,7 +65,14 @@ namespace AZ
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if the buffers were created or resized, which leaves them without any of the current data
+            bool PrepareBuffers();
+
+            // Flags the object so its transform is uploaded during the next OnBeginPrepareRender()
+            void MarkTransformDirty(uint32_t index);
+
+            // Computes the normal matrices for the objects in [beginObject, endObject) straight into the mapped normal buffer
+            void UploadInverseTransposeTransforms(size_t beginObject, size_t endObject);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -78,12 +85,18 @@ namespace AZ
             // have a uint32_t that points to the next empty slot like a linked list. m_firstAvailableMeshTransformIndex stores the first
             // empty slot, unless there are none then it's NoAvailableTransformIndices. This allows mesh object SRGs to be compiled once
             // with an index to their transform, and updates to the transform just update the buffer, not individual mesh SRGs.
+            // The normal matrices aren't kept on the CPU, they are computed from m_objectToWorldTransforms during upload.
             AZStd::vector<Float4x3> m_objectToWorldTransforms;
-            AZStd::vector<Float4x3> m_objectToWorldInverseTransposeTransforms;
             AZStd::vector<Float4x3> m_objectToWorldHistoryTransforms;
 
-            static const size_t TransformValueSize = sizeof(decltype(m_objectToWorldTransforms)::value_type);
-            static const size_t NormalValueSize = sizeof(decltype(m_objectToWorldInverseTransposeTransforms)::value_type);
+            static const size_t TransformValueSize = sizeof(Float4x3);
+            static const size_t NormalValueSize = sizeof(Float4x3);
+
+            // One bit per object whose transform changed since the last upload. Only the ranges of objects with dirty bits are
+            // uploaded, so a frame where a few objects move in a large scene doesn't re-upload every transform.
+            AZStd::vector<uint64_t> m_dirtyTransformWords;
+            // The objects that were uploaded last frame, whose previous transforms still need to reach the history buffer
+            AZStd::vector<uint64_t> m_historyDirtyTransformWords;
 
             Data::Instance<RPI::Buffer> m_objectToWorldBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/DirtyInstanceSet.h>
+#include <Atom/Utils/StableDynamicArray.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    namespace DirtyInstanceSetTestUtils
+    {
+        //! Stands in for a ModelDataInstance. The padding keeps each instance on its own cache lines, like the real thing.
+        struct TestInstance
+        {
+            uint32_t m_slot = DirtyInstanceSet<TestInstance>::InvalidSlot;
+            uint32_t m_updateCount = 0;
+            bool m_needsUpdate = false;
+            uint8_t m_padding[500] = {};
+        };
+
+        AZStd::vector<uint32_t> TakeMarkedSlots(DirtyInstanceSet<TestInstance>& dirtySet)
+        {
+            AZStd::vector<uint64_t> words;
+            dirtySet.TakeMarked(words);
+            AZStd::vector<uint32_t> slots;
+            dirtySet.ForEachInWords(words, 0, words.size(), [&slots](TestInstance& instance)
+                {
+                    slots.push_back(instance.m_slot);
+                });
+            return slots;
+        }
+    }
+
+    class DirtyInstanceSetTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(DirtyInstanceSetTests, AcquireSlot_NewSlotsStartMarked)
+    {
+        DirtyInstanceSet<DirtyInstanceSetTestUtils::TestInstance> dirtySet;
+        DirtyInstanceSetTestUtils::TestInstance instances[3];
+        for (auto& instance : instances)
+        {
+            instance.m_slot = dirtySet.AcquireSlot(&instance);
+        }
+
+        EXPECT_EQ(DirtyInstanceSetTestUtils::TakeMarkedSlots(dirtySet).size(), 3u);
+        EXPECT_TRUE(DirtyInstanceSetTestUtils::TakeMarkedSlots(dirtySet).empty());
+    }
+
+    TEST_F(DirtyInstanceSetTests, Mark_OnlyMarkedInstancesAreVisited)
+    {
+        DirtyInstanceSet<DirtyInstanceSetTestUtils::TestInstance> dirtySet;
+        AZStd::vector<DirtyInstanceSetTestUtils::TestInstance> instances(10000);
+        for (auto& instance : instances)
+        {
+            instance.m_slot = dirtySet.AcquireSlot(&instance);
+        }
+        DirtyInstanceSetTestUtils::TakeMarkedSlots(dirtySet);
+
+        // Mark slots on both sides of a page boundary, and one slot twice
+        dirtySet.Mark(instances[5].m_slot);
+        dirtySet.Mark(instances[4095].m_slot);
+        dirtySet.Mark(instances[4096].m_slot);
+        dirtySet.Mark(instances[9999].m_slot);
+        dirtySet.Mark(instances[5].m_slot);
+
+        const AZStd::vector<uint32_t> expected = { instances[5].m_slot, instances[4095].m_slot, instances[4096].m_slot, instances[9999].m_slot };
+        EXPECT_EQ(DirtyInstanceSetTestUtils::TakeMarkedSlots(dirtySet), expected);
+    }
+
+    TEST_F(DirtyInstanceSetTests, TakeMarked_MergesIntoExistingWords)
+    {
+        DirtyInstanceSet<DirtyInstanceSetTestUtils::TestInstance> dirtySet;
+        DirtyInstanceSetTestUtils::TestInstance instances[2];
+        for (auto& instance : instances)
+        {
+            instance.m_slot = dirtySet.AcquireSlot(&instance);
+        }
+
+        AZStd::vector<uint64_t> words;
+        dirtySet.TakeMarked(words);
+        dirtySet.Mark(instances[1].m_slot);
+        dirtySet.TakeMarked(words);
+
+        uint32_t visitCount = 0;
+        dirtySet.ForEachInWords(words, 0, words.size(), [&visitCount](DirtyInstanceSetTestUtils::TestInstance&)
+            {
+                ++visitCount;
+            });
+        EXPECT_EQ(visitCount, 2u);
+    }
+
+    TEST_F(DirtyInstanceSetTests, ReleaseSlot_DropsMarkAndReusesSlot)
+    {
+        DirtyInstanceSet<DirtyInstanceSetTestUtils::TestInstance> dirtySet;
+        DirtyInstanceSetTestUtils::TestInstance first;
+        DirtyInstanceSetTestUtils::TestInstance second;
+        first.m_slot = dirtySet.AcquireSlot(&first);
+        dirtySet.ReleaseSlot(first.m_slot);
+        EXPECT_TRUE(DirtyInstanceSetTestUtils::TakeMarkedSlots(dirtySet).empty());
+
+        second.m_slot = dirtySet.AcquireSlot(&second);
+        EXPECT_EQ(second.m_slot, first.m_slot);
+
+        dirtySet.MarkAll();
+        const AZStd::vector<uint32_t> expected = { second.m_slot };
+        EXPECT_EQ(DirtyInstanceSetTestUtils::TakeMarkedSlots(dirtySet), expected);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+    using UnitTest::DirtyInstanceSetTestUtils::TestInstance;
+
+    //! Models a MeshFeatureProcessor::Simulate frame with state.range(0) static meshes and state.range(1) moving meshes.
+    //! The moving meshes are marked every frame, then the frame update either visits the marked meshes or sweeps all of them.
+    class DirtyInstanceSetBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Stands in for SetTransform on every moving mesh
+        void MoveMeshes()
+        {
+            for (TestInstance* instance : m_movingInstances)
+            {
+                instance->m_needsUpdate = true;
+                m_dirtySet->Mark(instance->m_slot);
+            }
+        }
+
+        AZStd::unique_ptr<StableDynamicArray<TestInstance>> m_instances;
+        AZStd::unique_ptr<DirtyInstanceSet<TestInstance>> m_dirtySet;
+        AZStd::vector<StableDynamicArrayHandle<TestInstance>> m_handles;
+        AZStd::vector<TestInstance*> m_movingInstances;
+
+    private:
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_instances = AZStd::make_unique<StableDynamicArray<TestInstance>>();
+            m_dirtySet = AZStd::make_unique<DirtyInstanceSet<TestInstance>>();
+
+            const size_t staticCount = aznumeric_cast<size_t>(state.range(0));
+            const size_t movingCount = aznumeric_cast<size_t>(state.range(1));
+            const size_t totalCount = staticCount + movingCount;
+            const size_t movingStride = AZStd::max<size_t>(totalCount / AZStd::max<size_t>(movingCount, 1), 1);
+            m_handles.reserve(totalCount);
+            for (size_t i = 0; i < totalCount; ++i)
+            {
+                m_handles.push_back(m_instances->emplace());
+                TestInstance& instance = *m_handles.back();
+                instance.m_slot = m_dirtySet->AcquireSlot(&instance);
+                // Spread the moving meshes through the array, like entities that were spawned at different times
+                if (m_movingInstances.size() < movingCount && i % movingStride == 0)
+                {
+                    m_movingInstances.push_back(&instance);
+                }
+            }
+
+            AZStd::vector<uint64_t> words;
+            m_dirtySet->TakeMarked(words);
+        }
+
+        void internalTearDown()
+        {
+            m_movingInstances = {};
+            m_handles = {};
+            m_dirtySet.reset();
+            m_instances.reset();
+        }
+    };
+
+    BENCHMARK_DEFINE_F(DirtyInstanceSetBenchmarkFixture, SimulateFrame_DirtyInstances)(benchmark::State& state)
+    {
+        AZStd::vector<uint64_t> words;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveMeshes();
+
+            words.clear();
+            m_dirtySet->TakeMarked(words);
+            m_dirtySet->ForEachInWords(words, 0, words.size(), [](TestInstance& instance)
+                {
+                    if (instance.m_needsUpdate)
+                    {
+                        instance.m_needsUpdate = false;
+                        ++instance.m_updateCount;
+                    }
+                });
+        }
+        state.SetItemsProcessed(state.iterations() * m_movingInstances.size());
+    }
+
+    BENCHMARK_DEFINE_F(DirtyInstanceSetBenchmarkFixture, SimulateFrame_SweepAllInstances)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveMeshes();
+
+            for (TestInstance& instance : *m_instances)
+            {
+                if (instance.m_needsUpdate)
+                {
+                    instance.m_needsUpdate = false;
+                    ++instance.m_updateCount;
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_movingInstances.size());
+    }
+
+    static void DirtyInstanceSetArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Args({ 100000, 10000 });
+        benchmark->Args({ 100000, 1000 });
+        benchmark->Args({ 100000, 0 });
+        benchmark->ArgNames({ "Static", "Moving" });
+        benchmark->Unit(benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_REGISTER_F(DirtyInstanceSetBenchmarkFixture, SimulateFrame_DirtyInstances)->Apply(DirtyInstanceSetArguments);
+    BENCHMARK_REGISTER_F(DirtyInstanceSetBenchmarkFixture, SimulateFrame_SweepAllInstances)->Apply(DirtyInstanceSetArguments);
+}
+#endif
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TransformService/TransformPacking.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    namespace TransformPackingTestUtils
+    {
+        //! Builds the same matrices TransformServiceFeatureProcessor::SetTransformForId() stores, with non-uniform scale.
+        AZStd::vector<float> BuildMatrices(size_t objectCount, uint32_t seed)
+        {
+            SimpleLcgRandom random(seed);
+            AZStd::vector<float> matrices(objectCount * TransformPacking::FloatsPerMatrix);
+            for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+            {
+                const Quaternion rotation = Quaternion::CreateFromEulerAnglesRadians(
+                    Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * Constants::TwoPi);
+                const Vector3 translation = Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 200.0f - Vector3(100.0f);
+                const Vector3 nonUniformScale = Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 4.0f + Vector3(0.5f);
+
+                Matrix3x4 matrix = Matrix3x4::CreateFromTransform(Transform::CreateFromQuaternionAndTranslation(rotation, translation));
+                matrix.MultiplyByScale(nonUniformScale);
+                matrix.StoreToRowMajorFloat12(&matrices[objectIndex * TransformPacking::FloatsPerMatrix]);
+            }
+            return matrices;
+        }
+
+        Matrix3x4 GetExpectedInverseTranspose(const float* matrix)
+        {
+            return Matrix3x4::CreateFromRowMajorFloat12(matrix).GetInverseFull().GetTranspose3x3();
+        }
+
+        AZStd::vector<AZStd::pair<size_t, size_t>> GetDirtyRanges(const AZStd::vector<uint64_t>& words, size_t objectCount, size_t maxGapWords)
+        {
+            AZStd::vector<AZStd::pair<size_t, size_t>> ranges;
+            TransformPacking::ForEachDirtyRange(words.data(), words.size(), objectCount, maxGapWords,
+                [&ranges](size_t beginObject, size_t endObject)
+                {
+                    ranges.emplace_back(beginObject, endObject);
+                });
+            return ranges;
+        }
+    }
+
+    class TransformPackingTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(TransformPackingTests, StoreInverseTransposes_MatchesMatrix3x4InverseTranspose)
+    {
+        constexpr size_t objectCount = 1000;
+        const AZStd::vector<float> matrices = TransformPackingTestUtils::BuildMatrices(objectCount, 1234);
+        AZStd::vector<float> packed(matrices.size());
+        TransformPacking::StoreInverseTransposesRowMajorFloat12(matrices.data(), packed.data(), objectCount);
+
+        for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+        {
+            const size_t offset = objectIndex * TransformPacking::FloatsPerMatrix;
+            const Matrix3x4 expected = TransformPackingTestUtils::GetExpectedInverseTranspose(&matrices[offset]);
+            const Matrix3x4 actual = Matrix3x4::CreateFromRowMajorFloat12(&packed[offset]);
+            EXPECT_TRUE(actual.IsClose(expected, 1.0e-3f)) << "object " << objectIndex;
+        }
+    }
+
+    TEST_F(TransformPackingTests, StoreInverseTranspose_ZeroScale_UsesIdentityInverse)
+    {
+        Matrix3x4 matrix = Matrix3x4::CreateTranslation(Vector3(1.0f, 2.0f, 3.0f));
+        matrix.MultiplyByScale(Vector3(1.0f, 0.0f, 1.0f));
+        float source[TransformPacking::FloatsPerMatrix];
+        matrix.StoreToRowMajorFloat12(source);
+
+        float packed[TransformPacking::FloatsPerMatrix];
+        TransformPacking::StoreInverseTransposeRowMajorFloat12(source, packed);
+
+        Matrix3x4 expected = Matrix3x4::CreateIdentity();
+        expected.SetTranslation(Vector3(-1.0f, -2.0f, -3.0f));
+        EXPECT_TRUE(Matrix3x4::CreateFromRowMajorFloat12(packed).IsClose(expected));
+    }
+
+    TEST_F(TransformPackingTests, ForEachDirtyRange_MergesSmallGapsAndClampsToObjectCount)
+    {
+        //                                      0    1    2    3    4    5    6    7
+        const AZStd::vector<uint64_t> words = { 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x8000000000000000 };
+        constexpr size_t objectCount = 7 * TransformPacking::ObjectsPerDirtyWord + 10;
+
+        using Ranges = AZStd::vector<AZStd::pair<size_t, size_t>>;
+        const Ranges separateRanges = { { 0, 64 }, { 128, 192 }, { 448, objectCount } };
+        EXPECT_EQ(TransformPackingTestUtils::GetDirtyRanges(words, objectCount, 0), separateRanges);
+
+        const Ranges mergedRanges = { { 0, 192 }, { 448, objectCount } };
+        EXPECT_EQ(TransformPackingTestUtils::GetDirtyRanges(words, objectCount, 1), mergedRanges);
+
+        const Ranges singleRange = { { 0, objectCount } };
+        EXPECT_EQ(TransformPackingTestUtils::GetDirtyRanges(words, objectCount, 4), singleRange);
+
+        EXPECT_TRUE(TransformPackingTestUtils::GetDirtyRanges(AZStd::vector<uint64_t>(8, 0), objectCount, 4).empty());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    //! Computes the normal matrices for state.range(0) objects, once the way SetTransformForId() used to for each object and
+    //! once with the bulk SIMD path the transform service uses during upload.
+    class TransformPackingBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        size_t m_objectCount = 0;
+        AZStd::vector<float> m_matrices;
+        AZStd::vector<float> m_packed;
+
+    private:
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_objectCount = aznumeric_cast<size_t>(state.range(0));
+            m_matrices = UnitTest::TransformPackingTestUtils::BuildMatrices(m_objectCount, 1234);
+            m_packed.resize(m_matrices.size());
+        }
+
+        void internalTearDown()
+        {
+            m_matrices = {};
+            m_packed = {};
+        }
+    };
+
+    BENCHMARK_DEFINE_F(TransformPackingBenchmarkFixture, InverseTranspose_Matrix3x4)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t objectIndex = 0; objectIndex < m_objectCount; ++objectIndex)
+            {
+                const size_t offset = objectIndex * TransformPacking::FloatsPerMatrix;
+                Matrix3x4::CreateFromRowMajorFloat12(&m_matrices[offset]).GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(&m_packed[offset]);
+            }
+            benchmark::DoNotOptimize(m_packed.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_objectCount);
+    }
+
+    BENCHMARK_DEFINE_F(TransformPackingBenchmarkFixture, InverseTranspose_Simd)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t objectIndex = 0; objectIndex < m_objectCount; ++objectIndex)
+            {
+                const size_t offset = objectIndex * TransformPacking::FloatsPerMatrix;
+                TransformPacking::StoreInverseTransposeRowMajorFloat12(&m_matrices[offset], &m_packed[offset]);
+            }
+            benchmark::DoNotOptimize(m_packed.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_objectCount);
+    }
+
+    static void TransformPackingArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Arg(1000);
+        benchmark->Arg(100000);
+        benchmark->ArgName("Objects");
+        benchmark->Unit(benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_REGISTER_F(TransformPackingBenchmarkFixture, InverseTranspose_Matrix3x4)->Apply(TransformPackingArguments);
+    BENCHMARK_REGISTER_F(TransformPackingBenchmarkFixture, InverseTranspose_Simd)->Apply(TransformPackingArguments);
+}
+#endif
@@ -127,6 +127,7 @@ set(FILES
     Source/Mesh/MeshInstanceGroupKey.h
     Source/Mesh/MeshInstanceGroupList.cpp
     Source/Mesh/MeshInstanceGroupList.h
+    Source/Mesh/DirtyInstanceSet.h
     Source/Mesh/MeshInstanceManager.cpp
     Source/Mesh/MeshInstanceManager.h
     Source/Mesh/MeshFeatureProcessor.cpp
@@ -321,6 +322,8 @@ set(FILES
     Source/SplashScreen/SplashScreenFeatureProcessor.h
     Source/SplashScreen/SplashScreenPass.cpp
     Source/SplashScreen/SplashScreenPass.h
+    Source/TransformService/TransformPacking.cpp
+    Source/TransformService/TransformPacking.h
     Source/TransformService/TransformServiceFeatureProcessor.cpp
     Source/TransformService/TransformServiceFeatureProcessor.h
 )
@@ -11,7 +11,9 @@ set(FILES
     Tests/CommonTest.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
+    Tests/Mesh/DirtyInstanceSetTests.cpp
     Tests/Mesh/MeshInstanceManagerTests.cpp
+    Tests/TransformService/TransformPackingTests.cpp
     Tests/MultiIndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
     Tests/SparseVectorTests.cpp
@@ -17,6 +17,7 @@
 #include <Atom/RHI/DeviceImagePool.h>
 #include <Atom/RHI/DeviceResourcePool.h>
 #include <Atom/RHI/DeviceTransientAttachmentPool.h>
+#include <Atom/RHI/TransientAttachmentPlacement.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -44,6 +45,9 @@ namespace AZ::RHI
     //! Aliased Heaps are used for allocating transient attachments (resources that are valid only during the duration of a frame).
     //! and they will reuse memory whenever possible, and will also track the necessary barriers that need to be inserted when aliasing happens.
     //! Aliased Heaps do not support aliased resources being used at the same time (even if the resources are compatible).
+    //! At the end of each frame the heap solves the placement of all the attachments of the frame at once (see TransientAttachmentPlacementSolver),
+    //! and the next frame places the attachments that match that plan at the solved offsets instead of using the first-fit allocator.
+    //! The first attachment that doesn't match the plan (the topology of the frame graph changed) abandons it for the rest of the frame.
     class ATOM_RHI_PUBLIC_API AliasedHeap
         : public DeviceResourcePool
     {
@@ -92,6 +96,9 @@ namespace AZ::RHI
         //! Returns the heap statistics of the frame when the Aliased Heap was began with the GatherStatistics flag.
         const TransientAttachmentStatistics::Heap& GetStatistics() const;
 
+        //! Returns the transient memory report of the last frame, with its peak memory, fragmentation and the heap size the placement solver reaches.
+        const TransientAttachmentPlacementReport& GetPlacementReport() const;
+
         //! Remove the entry related to the provided attachmentId from the cache as it is probably stale now
         void RemoveFromCache(RHI::AttachmentId attachmentId);
 
@@ -122,6 +129,20 @@ namespace AZ::RHI
     private:
         void DeactivateResourceInternal(const AttachmentId& attachmentId, Scope& scope, AliasedResourceType type);
 
+        //! Returns the heap address of a new attachment. Attachments that match the placement plan use their planned offset,
+        //! the rest use the first-fit allocator.
+        VirtualAddress AllocateInternal(
+            const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, const Scope& scope, bool& isPlanned);
+
+        //! Returns the planned region to the first-fit allocator, keeping only the ranges of the planned attachments that are still active.
+        void AbandonPlacementPlan();
+
+        //! Adds the lifetime of an attachment activated this frame, at the same index as its statistics.
+        void AddLifetime(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, const Scope& scope);
+
+        //! Solves the placement of the attachments of the frame for the next one, and updates the placement report.
+        void UpdatePlacementPlan();
+
         /// Descriptor of the heap.
         AliasedHeapDescriptor m_descriptor;
 
@@ -151,6 +172,7 @@ namespace AZ::RHI
             DeviceResource* m_resource = nullptr;
             uint32_t m_attachmentIndex = 0;
             Scope* m_activateScope = nullptr;
+            bool m_isPlanned = false;
         };
 
         AZStd::unordered_map<AttachmentId, AttachmentData> m_activeAttachmentLookup;
@@ -158,5 +180,28 @@ namespace AZ::RHI
         // This map is used to reverse look up resource hash so we can clear them out of m_cache
         // once they have been replaced with a new resource at a different place in the heap. 
         AZStd::unordered_map<AttachmentId, HashValue64> m_reverseLookupHash;
+
+        /// Lifetimes of the attachments activated this frame, in the same order as the statistics attachments.
+        AZStd::vector<TransientAttachmentLifetime> m_lifetimes;
+
+        /// Placements solved for the recent frame graph topologies.
+        TransientAttachmentPlacementCache m_placementCache;
+
+        struct PlannedAttachment
+        {
+            size_t m_heapOffset = 0;
+            size_t m_sizeInBytes = 0;
+            size_t m_scopeIndexMin = 0;
+        };
+
+        /// Solved offsets of the attachments of the previous frame, relative to the planned region.
+        AZStd::unordered_map<AttachmentId, PlannedAttachment> m_placementPlan;
+        size_t m_placementPlanSizeInBytes = 0;
+
+        /// Region at the start of the heap reserved in the first-fit allocator for the planned attachments.
+        /// Attachments that don't match the plan are allocated outside of it.
+        VirtualAddress m_plannedRegion;
+
+        TransientAttachmentPlacementReport m_placementReport;
     };
 }
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI/DeviceResource.h>
 #include <Atom/RHI/DeviceShaderResourceGroupData.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ::RHI
 {
@@ -67,6 +68,11 @@ namespace AZ::RHI
         //! be compiled for another m_updateMaskResetLatency number of Compile calls
         void ResetResourceTypeIteration(const DeviceShaderResourceGroupData::ResourceType resourceType);
 
+        //! Returns the constant bytes and shader inputs the compile in progress has to rewrite. Platforms compile into a
+        //! different copy of the group every time, so this is the union of the ranges written over the last FrameCountMax compiles.
+        //! Only meaningful for resource types that are enabled for compilation.
+        const DeviceShaderResourceGroupData::DirtyRanges& GetCompileDirtyRanges() const;
+
         //! Return the view hash stored within m_viewHash
         HashValue64 GetViewHash(const AZ::Name& viewName);
 
@@ -79,6 +85,15 @@ namespace AZ::RHI
     private:
         void SetData(const DeviceShaderResourceGroupData& data);
 
+        //! Returns the dirty ranges of the compile that is about to happen, so the pool can add to them.
+        DeviceShaderResourceGroupData::DirtyRanges& GetPendingDirtyRanges();
+
+        //! Gathers m_compileDirtyRanges from the history before a compile.
+        void UpdateCompileDirtyRanges();
+
+        //! Moves on to the next compile, dropping the ranges that every copy of the group has seen by now.
+        void AdvanceDirtyRangesHistory();
+
         DeviceShaderResourceGroupData m_data;
 
         // The binding slot cached from the layout.
@@ -94,6 +109,11 @@ namespace AZ::RHI
         uint32_t m_resourceTypeIteration[static_cast<uint32_t>(DeviceShaderResourceGroupData::ResourceType::Count)] = { 0 };
         uint32_t m_updateMaskResetLatency = RHI::Limits::Device::FrameCountMax - 1; //we do -1 because we update after compile
 
+        // Dirty ranges of the last FrameCountMax compiles, m_dirtyRangesHistoryIndex is the upcoming compile
+        AZStd::array<DeviceShaderResourceGroupData::DirtyRanges, RHI::Limits::Device::FrameCountMax> m_dirtyRangesHistory;
+        uint32_t m_dirtyRangesHistoryIndex = 0;
+        DeviceShaderResourceGroupData::DirtyRanges m_compileDirtyRanges;
+
         // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
         AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
     };
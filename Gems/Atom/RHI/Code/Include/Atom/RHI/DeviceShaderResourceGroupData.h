@@ -13,6 +13,7 @@
 #include <Atom/RHI/DeviceBuffer.h>
 #include <Atom/RHI/DeviceBufferView.h>
 #include <AzCore/Preprocessor/Enum.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ::RHI
 {
@@ -214,6 +215,82 @@ namespace AZ::RHI
             SamplerMask = AZ_BIT(static_cast<uint32_t>(ResourceType::Sampler))
         };
 
+        //! Tracks which constant bytes and which image / buffer shader inputs were written since the last ResetUpdateMask,
+        //! so backends only rewrite those parts of a compiled group. Inputs at or past InputMaskBitCount - 1 share the last bit.
+        //! The ranges refine the ResourceTypeMask: a resource type can be flagged for compilation without any range, which
+        //! means the whole resource type has to be compiled.
+        struct DirtyRanges
+        {
+            static constexpr uint32_t InputMaskBitCount = 64;
+
+            void MarkConstantBytes(uint32_t byteMin, uint32_t byteMax)
+            {
+                m_constantBytes.m_min = AZStd::min(m_constantBytes.m_min, byteMin);
+                m_constantBytes.m_max = AZStd::max(m_constantBytes.m_max, byteMax);
+            }
+
+            void MarkImageInput(uint32_t inputIndex)
+            {
+                m_imageInputMask |= GetInputBit(inputIndex);
+            }
+
+            void MarkBufferInput(uint32_t inputIndex)
+            {
+                m_bufferInputMask |= GetInputBit(inputIndex);
+            }
+
+            void MarkAll()
+            {
+                MarkConstantBytes(0, AZStd::numeric_limits<uint32_t>::max());
+                m_imageInputMask = AZStd::numeric_limits<uint64_t>::max();
+                m_bufferInputMask = AZStd::numeric_limits<uint64_t>::max();
+            }
+
+            void Merge(const DirtyRanges& other)
+            {
+                MarkConstantBytes(other.m_constantBytes.m_min, other.m_constantBytes.m_max);
+                m_imageInputMask |= other.m_imageInputMask;
+                m_bufferInputMask |= other.m_bufferInputMask;
+            }
+
+            void Reset()
+            {
+                *this = DirtyRanges();
+            }
+
+            //! Returns the written byte range clamped to the constant data size, or the whole constant data if no range was tracked.
+            Interval GetConstantBytes(uint32_t constantDataSize) const
+            {
+                if (m_constantBytes.m_min >= m_constantBytes.m_max)
+                {
+                    return Interval(0, constantDataSize);
+                }
+                return Interval(AZStd::min(m_constantBytes.m_min, constantDataSize), AZStd::min(m_constantBytes.m_max, constantDataSize));
+            }
+
+            //! Returns true if the image input needs to be rewritten. Also true for every input if no input was tracked.
+            bool IsImageInputDirty(uint32_t inputIndex) const
+            {
+                return m_imageInputMask == 0 || (m_imageInputMask & GetInputBit(inputIndex)) != 0;
+            }
+
+            //! Returns true if the buffer input needs to be rewritten. Also true for every input if no input was tracked.
+            bool IsBufferInputDirty(uint32_t inputIndex) const
+            {
+                return m_bufferInputMask == 0 || (m_bufferInputMask & GetInputBit(inputIndex)) != 0;
+            }
+
+            static uint64_t GetInputBit(uint32_t inputIndex)
+            {
+                return uint64_t{ 1 } << AZStd::min(inputIndex, InputMaskBitCount - 1);
+            }
+
+            //! Empty (m_min >= m_max) when no constant was written.
+            Interval m_constantBytes = Interval(AZStd::numeric_limits<uint32_t>::max(), 0);
+            uint64_t m_imageInputMask = 0;
+            uint64_t m_bufferInputMask = 0;
+        };
+
         // Structure to hold all the bindless views and the BindlessResourceType related to it
         struct BindlessResourceViews
         {
@@ -229,6 +306,9 @@ namespace AZ::RHI
 
         //! Returns the mask that is suppose to indicate which resource type was updated
         uint32_t GetUpdateMask() const;
+
+        //! Returns the constant bytes and shader inputs written since the last ResetUpdateMask
+        const DirtyRanges& GetDirtyRanges() const;
             
         //! Update the indirect buffer view with the indices of all the image views which reside in the global gpu heap.
         //! Ideally higher level code can access bindless heap indices directly from the view and populate any indirect
@@ -268,6 +348,9 @@ namespace AZ::RHI
         bool ValidateSetImageView(ShaderInputImageIndex inputIndex, const DeviceImageView* imageView, uint32_t arrayIndex) const;
         bool ValidateSetBufferView(ShaderInputBufferIndex inputIndex, const DeviceBufferView* bufferView, uint32_t arrayIndex) const;
 
+        //! Adds the byte range of the constant input to the dirty ranges
+        void MarkConstantDirty(ShaderInputConstantIndex inputIndex);
+
         template<typename TShaderInput, typename TShaderInputDescriptor>
         bool ValidateImageViewAccess(TShaderInput inputIndex, const DeviceImageView* imageView, uint32_t arrayIndex) const;
         template<typename TShaderInput, typename TShaderInputDescriptor>
@@ -292,12 +375,16 @@ namespace AZ::RHI
 
         //! Mask used to check whether to compile a specific resource type. This mask is managed by RPI and copied over to the RHI every frame. 
         uint32_t m_updateMask = 0;
+
+        //! Finer grained companion of m_updateMask, reset along with it.
+        DirtyRanges m_dirtyRanges;
     };
 
     template <typename T>
     bool DeviceShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+        MarkConstantDirty(inputIndex);
         return m_constantsData.SetConstant(inputIndex, value);
     }
 
@@ -305,6 +392,7 @@ namespace AZ::RHI
     bool DeviceShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value, uint32_t arrayIndex)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+        MarkConstantDirty(inputIndex);
         return m_constantsData.SetConstant(inputIndex, value, arrayIndex);
     }
 
@@ -312,6 +400,7 @@ namespace AZ::RHI
     bool DeviceShaderResourceGroupData::SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+        MarkConstantDirty(inputIndex);
         return m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount);
     }
 
@@ -321,6 +410,7 @@ namespace AZ::RHI
         if (!values.empty())
         {
             EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            MarkConstantDirty(inputIndex);
         }
         return m_constantsData.SetConstantArray(inputIndex, values);
     }
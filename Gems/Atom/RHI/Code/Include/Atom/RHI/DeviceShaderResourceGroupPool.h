@@ -113,9 +113,9 @@ namespace AZ::RHI
         HashValue64 GetViewHash(AZStd::span<const RHI::ConstPtr<T>> views);
 
         // Modify the m_rhiUpdateMask of a Srg if a view was modified in the current frame. This
-        // will ensure that the view will be compiled by the back end
+        // will ensure that the view will be compiled by the back end. Returns true if the views were modified.
         template<typename T>
-        void UpdateMaskBasedOnViewHash(
+        bool UpdateMaskBasedOnViewHash(
             DeviceShaderResourceGroup& shaderResourceGroup,
             Name entryName,
             AZStd::span<const RHI::ConstPtr<T>> views,
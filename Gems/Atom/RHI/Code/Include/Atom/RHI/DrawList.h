@@ -40,5 +40,15 @@ namespace AZ::RHI
     /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
     ATOM_RHI_PUBLIC_API DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
-    ATOM_RHI_PUBLIC_API void SortDrawList(DrawList& drawList, DrawListSortType sortType);
+    //! Algorithms SortDrawList can use. All of them produce the same order, ties on sort key and depth are broken by draw item address.
+    enum class DrawListSortMethod : uint8_t
+    {
+        Automatic = 0,  //!< Picks a method from the size of the list and the r_drawListSort* cvars.
+        Comparison,     //!< Comparison sort on sort key, depth and draw item address.
+        Radix,          //!< Stable LSD radix sort on the packed sort key and depth, run on the calling thread.
+        ParallelRadix,  //!< Radix sort with its passes split over the job system. Runs serially if no job context is available.
+        Coherent,       //!< Bounded insertion sort for lists that are already nearly sorted, falls back to Automatic when the budget runs out.
+    };
+
+    ATOM_RHI_PUBLIC_API void SortDrawList(DrawList& drawList, DrawListSortType sortType, DrawListSortMethod sortMethod = DrawListSortMethod::Automatic);
 }
@@ -55,7 +55,8 @@ namespace AZ::RHI
         /// Controls whether the phase is allowed to use jobs.
         JobPolicy m_jobPolicy = JobPolicy::Parallel;
 
-        /// Controls the number of ShaderResourceGroups compiled per job.
+        /// Controls the number of ShaderResourceGroups compiled per job. When r_srgCompileAutoSplit is
+        /// enabled this is the upper bound and the job size is derived from the number of queued groups.
         uint32_t m_shaderResourceGroupCompilesPerJob = 256;
     };
 
@@ -195,6 +196,7 @@ namespace AZ::RHI
         void PrepareProducers();
         void CompileProducers();
         void CompileShaderResourceGroups();
+        uint32_t GetShaderResourceGroupCompilesPerJob(uint32_t compilesTotal) const;
         void BuildRayTracingShaderTables();
 
         ScopeProducer* FindScopeProducer(const ScopeId& scopeId);
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/Base.h>
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::RHI
+{
+    //! Memory requirements and lifetime of a transient attachment placed on an aliased heap.
+    struct TransientAttachmentLifetime
+    {
+        bool operator==(const TransientAttachmentLifetime& other) const
+        {
+            return m_id == other.m_id &&
+                m_sizeInBytes == other.m_sizeInBytes &&
+                m_alignmentInBytes == other.m_alignmentInBytes &&
+                m_scopeIndexMin == other.m_scopeIndexMin &&
+                m_scopeIndexMax == other.m_scopeIndexMax;
+        }
+
+        AttachmentId m_id;
+        size_t m_sizeInBytes = 0;
+        size_t m_alignmentInBytes = 1;
+
+        //! Inclusive range of scope indices in which the attachment is alive. Two attachments may only alias
+        //! when their ranges don't intersect.
+        size_t m_scopeIndexMin = 0;
+        size_t m_scopeIndexMax = 0;
+    };
+
+    //! Heap offsets of a set of transient attachments, in the same order as the lifetimes they were solved for.
+    struct TransientAttachmentPlacement
+    {
+        AZStd::vector<size_t> m_heapOffsets;
+
+        //! Size of the heap needed for the placement (the highest offset plus size of all attachments).
+        size_t m_heapSizeInBytes = 0;
+    };
+
+    //! Transient memory usage of a frame on one heap.
+    struct TransientAttachmentPlacementReport
+    {
+        //! The largest total size of the attachments that are alive at the same scope. No placement can use a smaller heap.
+        size_t m_peakMemoryInBytes = 0;
+
+        //! The heap size used by the frame.
+        size_t m_heapSizeInBytes = 0;
+
+        //! The heap size the placement solver reaches for the same lifetimes.
+        size_t m_solvedHeapSizeInBytes = 0;
+
+        //! Portion of the used heap size that is never used by any attachment at the peak, from 0 to 1.
+        float m_fragmentation = 0.0f;
+    };
+
+    //! Computes the placement of transient attachments on an aliased heap for the full lifetime set of a frame graph,
+    //! instead of placing them one at a time while the scopes are compiled.
+    //! Placing the attachments is the packing of rectangles (scope range x byte range) on the byte axis. The solver runs
+    //! a few greedy strategies that are known to be close to the optimum for this problem (largest first, longest lived first,
+    //! and the first-fit order the heap uses at runtime), each with a best-fit and a lowest-offset gap search, and keeps the smallest.
+    //! Including the runtime order guarantees the result is never worse than first-fit on the same lifetimes.
+    namespace TransientAttachmentPlacementSolver
+    {
+        //! Returns a placement where attachments with intersecting lifetimes don't share any byte.
+        ATOM_RHI_PUBLIC_API TransientAttachmentPlacement Solve(const AZStd::vector<TransientAttachmentLifetime>& lifetimes);
+
+        //! Returns true if the placement aligns all attachments, keeps them in the heap size, and doesn't overlap
+        //! attachments with intersecting lifetimes.
+        ATOM_RHI_PUBLIC_API bool IsValid(
+            const AZStd::vector<TransientAttachmentLifetime>& lifetimes, const TransientAttachmentPlacement& placement);
+
+        //! Returns the largest total size of the attachments that are alive at the same scope.
+        ATOM_RHI_PUBLIC_API size_t ComputePeakMemory(const AZStd::vector<TransientAttachmentLifetime>& lifetimes);
+
+        //! Returns a hash of the lifetimes, which only changes when the frame graph topology or the attachment sizes change.
+        ATOM_RHI_PUBLIC_API HashValue64 ComputeTopologyHash(const AZStd::vector<TransientAttachmentLifetime>& lifetimes);
+
+        //! Returns the lifetimes of the attachments recorded in the statistics of an aliased heap.
+        //! The statistics don't record the alignment, so all attachments use the alignment of the heap.
+        ATOM_RHI_PUBLIC_API AZStd::vector<TransientAttachmentLifetime> GetLifetimes(
+            const TransientAttachmentStatistics::Heap& heapStatistics, size_t alignmentInBytes);
+
+        //! Builds the report of a recorded heap, comparing the placement it used with the solver.
+        ATOM_RHI_PUBLIC_API TransientAttachmentPlacementReport CreateReport(
+            const TransientAttachmentStatistics::Heap& heapStatistics, size_t alignmentInBytes);
+    } // namespace TransientAttachmentPlacementSolver
+
+    //! Keeps the solved placements of the last few frame graph topologies, so the solver only runs when the topology changes.
+    //! Lookups compare the full lifetimes, a hash collision never returns the placement of a different topology.
+    class ATOM_RHI_PUBLIC_API TransientAttachmentPlacementCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TransientAttachmentPlacementCache, SystemAllocator);
+
+        static constexpr size_t DefaultCapacity = 8;
+
+        explicit TransientAttachmentPlacementCache(size_t capacity = DefaultCapacity);
+
+        //! Returns the placement of the lifetimes, solving it if the topology is not in the cache.
+        //! When the cache is full, the topology that was used the longest time ago is evicted.
+        //! The returned reference is valid until the next call.
+        const TransientAttachmentPlacement& FindOrSolve(const AZStd::vector<TransientAttachmentLifetime>& lifetimes);
+
+        void Clear();
+
+        size_t GetEntryCount() const;
+
+    private:
+        struct Entry
+        {
+            HashValue64 m_topologyHash = HashValue64{ 0 };
+            AZStd::vector<TransientAttachmentLifetime> m_lifetimes;
+            TransientAttachmentPlacement m_placement;
+            uint64_t m_lastUse = 0;
+        };
+
+        AZStd::vector<Entry> m_entries;
+        size_t m_capacity = DefaultCapacity;
+        uint64_t m_useCounter = 0;
+    };
+} // namespace AZ::RHI
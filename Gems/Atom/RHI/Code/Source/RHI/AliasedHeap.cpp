@@ -13,24 +13,46 @@
 #include <Atom/RHI.Reflect/TransientBufferDescriptor.h>
 #include <Atom/RHI.Reflect/TransientImageDescriptor.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_transientAttachmentPlacementSolver, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Place the transient attachments of aliased heaps at the offsets solved for the whole frame, instead of first-fit as they are activated.");
+
     void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags)
     {
         m_totalAllocations = 0;
         m_compileFlags = compileFlags;
         m_heapStats.m_watermarkSize = 0;
         m_heapStats.m_attachments.clear();
+        m_lifetimes.clear();
         m_barrierTracker->Reset();
+
+        // The planned attachments only alias each other, so the region they use is reserved before any other allocation.
+        // It is returned to the first-fit allocator as soon as an attachment doesn't match the plan (see AbandonPlacementPlan).
+        m_plannedRegion = VirtualAddress::CreateNull();
+        if (r_transientAttachmentPlacementSolver && m_placementPlanSizeInBytes > 0)
+        {
+            m_plannedRegion = m_firstFitAllocator.Allocate(m_placementPlanSizeInBytes, m_descriptor.m_alignment);
+        }
     }
 
     void AliasedHeap::End()
     {
+        if (m_plannedRegion.IsValid())
+        {
+            m_firstFitAllocator.DeAllocate(m_plannedRegion);
+            m_firstFitAllocator.GarbageCollectForce();
+            m_plannedRegion = VirtualAddress::CreateNull();
+        }
+
         AZ_Assert(m_activeAttachmentLookup.empty() && m_firstFitAllocator.GetAllocationCount() == 0,
             "There are still active allocations.");
 
+        UpdatePlacementPlan();
+
         if (RHI::CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::GatherStatistics))
         {
             AZStd::sort(m_heapStats.m_attachments.begin(), m_heapStats.m_attachments.end(),
@@ -94,6 +116,9 @@ namespace AZ::RHI
         m_barrierTracker = nullptr;
         m_cache.Clear();
         m_reverseLookupHash.clear();
+        m_placementCache.Clear();
+        m_placementPlan.clear();
+        m_placementPlanSizeInBytes = 0;
         m_firstFitAllocator.Shutdown();
     }
 
@@ -111,7 +136,9 @@ namespace AZ::RHI
         ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor);
             
         const size_t alignmentInBytes = memRequirements.m_alignmentInBytes;
-        RHI::VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, alignmentInBytes);
+        bool isPlanned = false;
+        RHI::VirtualAddress address =
+            AllocateInternal(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, alignmentInBytes, scope, isPlanned);
         if (address.IsNull())
         {
             return ResultCode::OutOfMemory;
@@ -170,7 +197,8 @@ namespace AZ::RHI
         }
 
         const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-        m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope });
+        m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope, isPlanned });
+        AddLifetime(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, alignmentInBytes, scope);
         m_heapStats.m_attachments.emplace_back();
 
         RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
@@ -207,6 +235,7 @@ namespace AZ::RHI
 
         TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments[attachmentData.m_attachmentIndex];
         attachment.m_scopeOffsetMax = scope.GetIndex();
+        m_lifetimes[attachmentData.m_attachmentIndex].m_scopeIndexMax = scope.GetIndex();
 
         if (!CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources))
         {
@@ -223,9 +252,13 @@ namespace AZ::RHI
             m_barrierTracker->AddResource(aliasedResource);
         }
             
-        const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
-        m_firstFitAllocator.DeAllocate(heapAddress);
-        m_firstFitAllocator.GarbageCollectForce();
+        // Planned attachments are inside the reserved region, they were never allocated from the first-fit allocator.
+        if (!attachmentData.m_isPlanned)
+        {
+            const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
+            m_firstFitAllocator.DeAllocate(heapAddress);
+            m_firstFitAllocator.GarbageCollectForce();
+        }
         m_activeAttachmentLookup.erase(findIter);
     }
 
@@ -233,7 +266,9 @@ namespace AZ::RHI
     {
         ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor);
 
-        VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
+        bool isPlanned = false;
+        VirtualAddress address = AllocateInternal(
+            descriptor.m_attachmentId, memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes, scope, isPlanned);
         if (address.IsNull())
         {
             return ResultCode::OutOfMemory;
@@ -295,7 +330,8 @@ namespace AZ::RHI
         const size_t sizeInBytes = memRequirements.m_sizeInBytes;
 
         const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-        m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope });
+        m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope, isPlanned });
+        AddLifetime(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes, scope);
         m_heapStats.m_attachments.emplace_back();
 
         RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
@@ -340,4 +376,148 @@ namespace AZ::RHI
     {
         return m_heapStats;
     }
+
+    const TransientAttachmentPlacementReport& AliasedHeap::GetPlacementReport() const
+    {
+        return m_placementReport;
+    }
+
+    VirtualAddress AliasedHeap::AllocateInternal(
+        const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, const Scope& scope, bool& isPlanned)
+    {
+        isPlanned = false;
+        if (m_plannedRegion.IsValid())
+        {
+            auto planIter = m_placementPlan.find(attachmentId);
+            if (planIter != m_placementPlan.end() &&
+                planIter->second.m_sizeInBytes == sizeInBytes &&
+                planIter->second.m_scopeIndexMin == scope.GetIndex())
+            {
+                const size_t heapOffsetInBytes = m_plannedRegion.m_ptr + planIter->second.m_heapOffset;
+
+                // The plan was solved for the lifetimes of the previous frame. If an attachment lives longer this frame its planned
+                // range could still be in use, so the planned offset is only used when it doesn't overlap an active planned attachment.
+                bool isRangeFree = alignmentInBytes == 0 || heapOffsetInBytes % alignmentInBytes == 0;
+                for (const auto& [activeAttachmentId, activeAttachmentData] : m_activeAttachmentLookup)
+                {
+                    const TransientAttachmentStatistics::Attachment& activeAttachment =
+                        m_heapStats.m_attachments[activeAttachmentData.m_attachmentIndex];
+                    if (activeAttachmentData.m_isPlanned &&
+                        activeAttachment.m_heapOffsetMin < heapOffsetInBytes + sizeInBytes &&
+                        heapOffsetInBytes <= activeAttachment.m_heapOffsetMax)
+                    {
+                        isRangeFree = false;
+                        break;
+                    }
+                }
+
+                if (isRangeFree)
+                {
+                    isPlanned = true;
+                    return VirtualAddress::CreateFromOffset(heapOffsetInBytes);
+                }
+            }
+
+            // The topology of the frame graph changed since the plan was solved, the reserved region would only take space
+            // from the attachments that don't match it.
+            AbandonPlacementPlan();
+        }
+
+        return m_firstFitAllocator.Allocate(sizeInBytes, alignmentInBytes);
+    }
+
+    void AliasedHeap::AbandonPlacementPlan()
+    {
+        AZStd::vector<AttachmentData*> plannedAttachments;
+        for (auto& [activeAttachmentId, activeAttachmentData] : m_activeAttachmentLookup)
+        {
+            if (activeAttachmentData.m_isPlanned)
+            {
+                plannedAttachments.push_back(&activeAttachmentData);
+            }
+        }
+        AZStd::sort(plannedAttachments.begin(), plannedAttachments.end(), [this](const AttachmentData* lhs, const AttachmentData* rhs)
+            {
+                return m_heapStats.m_attachments[lhs->m_attachmentIndex].m_heapOffsetMin <
+                    m_heapStats.m_attachments[rhs->m_attachmentIndex].m_heapOffsetMin;
+            });
+
+        // The region was the only allocation of the first-fit allocator, so once it is released everything above its start is free.
+        // The planned attachments that are still active are allocated back at their offsets, in increasing order, with temporary
+        // allocations filling the gaps between them so first-fit lands exactly on each offset. Planned offsets are aligned to the heap.
+        size_t offsetInBytes = m_plannedRegion.m_ptr;
+        m_firstFitAllocator.DeAllocate(m_plannedRegion);
+        m_firstFitAllocator.GarbageCollectForce();
+        m_plannedRegion = VirtualAddress::CreateNull();
+
+        AZStd::vector<VirtualAddress> gapAllocations;
+        for (AttachmentData* attachmentData : plannedAttachments)
+        {
+            const TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments[attachmentData->m_attachmentIndex];
+            if (attachment.m_heapOffsetMin > offsetInBytes)
+            {
+                gapAllocations.push_back(m_firstFitAllocator.Allocate(attachment.m_heapOffsetMin - offsetInBytes, m_descriptor.m_alignment));
+            }
+
+            const size_t sizeInBytes = RHI::AlignUp(attachment.m_sizeInBytes, m_descriptor.m_alignment);
+            [[maybe_unused]] const VirtualAddress address = m_firstFitAllocator.Allocate(sizeInBytes, m_descriptor.m_alignment);
+            AZ_Assert(address.m_ptr == attachment.m_heapOffsetMin, "Failed to keep a planned attachment at its offset.");
+
+            // From now on the attachment is released like any first-fit allocation.
+            attachmentData->m_isPlanned = false;
+            offsetInBytes = attachment.m_heapOffsetMin + sizeInBytes;
+        }
+
+        for (const VirtualAddress& gapAllocation : gapAllocations)
+        {
+            m_firstFitAllocator.DeAllocate(gapAllocation);
+        }
+        m_firstFitAllocator.GarbageCollectForce();
+    }
+
+    void AliasedHeap::AddLifetime(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, const Scope& scope)
+    {
+        TransientAttachmentLifetime& lifetime = m_lifetimes.emplace_back();
+        lifetime.m_id = attachmentId;
+        lifetime.m_sizeInBytes = sizeInBytes;
+        // First-fit aligns every allocation to the heap, so do the planned offsets.
+        lifetime.m_alignmentInBytes = AZStd::max(alignmentInBytes, m_descriptor.m_alignment);
+        lifetime.m_scopeIndexMin = scope.GetIndex();
+        lifetime.m_scopeIndexMax = scope.GetIndex();
+    }
+
+    void AliasedHeap::UpdatePlacementPlan()
+    {
+        m_placementPlan.clear();
+        m_placementPlanSizeInBytes = 0;
+
+        m_placementReport = {};
+        m_placementReport.m_peakMemoryInBytes = TransientAttachmentPlacementSolver::ComputePeakMemory(m_lifetimes);
+        m_placementReport.m_heapSizeInBytes = m_heapStats.m_watermarkSize;
+        if (m_placementReport.m_heapSizeInBytes > 0)
+        {
+            m_placementReport.m_fragmentation = 1.0f -
+                aznumeric_cast<float>(m_placementReport.m_peakMemoryInBytes) / aznumeric_cast<float>(m_placementReport.m_heapSizeInBytes);
+        }
+
+        if (!r_transientAttachmentPlacementSolver || m_lifetimes.empty())
+        {
+            return;
+        }
+
+        // The cache only solves again when the topology of the frame graph changes, most frames reuse the placement.
+        const TransientAttachmentPlacement& placement = m_placementCache.FindOrSolve(m_lifetimes);
+        m_placementReport.m_solvedHeapSizeInBytes = placement.m_heapSizeInBytes;
+        if (placement.m_heapSizeInBytes > m_descriptor.m_budgetInBytes)
+        {
+            return;
+        }
+
+        for (size_t index = 0; index < m_lifetimes.size(); ++index)
+        {
+            const TransientAttachmentLifetime& lifetime = m_lifetimes[index];
+            m_placementPlan.emplace(lifetime.m_id, PlannedAttachment{ placement.m_heapOffsets[index], lifetime.m_sizeInBytes, lifetime.m_scopeIndexMin });
+        }
+        m_placementPlanSizeInBytes = placement.m_heapSizeInBytes;
+    }
 }
@@ -57,6 +57,7 @@ namespace AZ::RHI
     {
         m_data = data;
         uint32_t sourceUpdateMask = data.GetUpdateMask();
+        GetPendingDirtyRanges().Merge(data.GetDirtyRanges());
             
         //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
         m_rhiUpdateMask |= sourceUpdateMask;
@@ -106,6 +107,31 @@ namespace AZ::RHI
         m_resourceTypeIteration[static_cast<uint32_t>(resourceType)] = 0;
     }
 
+    const DeviceShaderResourceGroupData::DirtyRanges& DeviceShaderResourceGroup::GetCompileDirtyRanges() const
+    {
+        return m_compileDirtyRanges;
+    }
+
+    DeviceShaderResourceGroupData::DirtyRanges& DeviceShaderResourceGroup::GetPendingDirtyRanges()
+    {
+        return m_dirtyRangesHistory[m_dirtyRangesHistoryIndex];
+    }
+
+    void DeviceShaderResourceGroup::UpdateCompileDirtyRanges()
+    {
+        m_compileDirtyRanges.Reset();
+        for (const DeviceShaderResourceGroupData::DirtyRanges& dirtyRanges : m_dirtyRangesHistory)
+        {
+            m_compileDirtyRanges.Merge(dirtyRanges);
+        }
+    }
+
+    void DeviceShaderResourceGroup::AdvanceDirtyRangesHistory()
+    {
+        m_dirtyRangesHistoryIndex = (m_dirtyRangesHistoryIndex + 1) % RHI::Limits::Device::FrameCountMax;
+        m_dirtyRangesHistory[m_dirtyRangesHistoryIndex].Reset();
+    }
+
     HashValue64 DeviceShaderResourceGroup::GetViewHash(const AZ::Name& viewName)
     {
         return m_viewHash[viewName];
@@ -136,6 +136,7 @@ namespace AZ::RHI
             if(!imageViews.empty())
             {
                 EnableResourceTypeCompilation(ResourceTypeMask::ImageViewMask);
+                m_dirtyRanges.MarkImageInput(inputIndex.GetIndex());
             }
 
             return isValidAll;
@@ -198,6 +199,7 @@ namespace AZ::RHI
             if (!bufferViews.empty())
             {
                 EnableResourceTypeCompilation(ResourceTypeMask::BufferViewMask);
+                m_dirtyRanges.MarkBufferInput(inputIndex.GetIndex());
             }
             return isValidAll;
         }
@@ -266,18 +268,22 @@ namespace AZ::RHI
     bool DeviceShaderResourceGroupData::SetConstantRaw(ShaderInputConstantIndex inputIndex, const void* bytes, uint32_t byteOffset, uint32_t byteCount)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+        const Interval interval = GetLayout()->GetConstantsLayout()->GetInterval(inputIndex);
+        m_dirtyRanges.MarkConstantBytes(interval.m_min + byteOffset, interval.m_min + byteOffset + byteCount);
         return m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount);
     }
 
     bool DeviceShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteCount)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+        m_dirtyRanges.MarkConstantBytes(0, byteCount);
         return m_constantsData.SetConstantData(bytes, byteCount);
     }
 
     bool DeviceShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteOffset, uint32_t byteCount)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+        m_dirtyRanges.MarkConstantBytes(byteOffset, byteOffset + byteCount);
         return m_constantsData.SetConstantData(bytes, byteOffset, byteCount);
     }
 
@@ -406,6 +412,20 @@ namespace AZ::RHI
     void DeviceShaderResourceGroupData::ResetUpdateMask()
     {
         m_updateMask = 0;
+        m_dirtyRanges.Reset();
+    }
+
+    const DeviceShaderResourceGroupData::DirtyRanges& DeviceShaderResourceGroupData::GetDirtyRanges() const
+    {
+        return m_dirtyRanges;
+    }
+
+    void DeviceShaderResourceGroupData::MarkConstantDirty(ShaderInputConstantIndex inputIndex)
+    {
+        // Array element and partial matrix writes mark the whole input. Invalid indices map to an empty interval and are
+        // reported by the ConstantsData write that follows.
+        const Interval interval = GetLayout()->GetConstantsLayout()->GetInterval(inputIndex);
+        m_dirtyRanges.MarkConstantBytes(interval.m_min, interval.m_max);
     }
     
     void DeviceShaderResourceGroupData::SetBindlessViews(
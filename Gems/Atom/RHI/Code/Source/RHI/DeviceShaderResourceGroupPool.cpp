@@ -73,6 +73,12 @@ namespace AZ::RHI
 
             // Cache off the binding slot for one less indirection.
             group.m_bindingSlot = layout->GetBindingSlot();
+
+            // Every copy of the compiled group starts out empty, so the first compiles have to write all of it.
+            for (DeviceShaderResourceGroupData::DirtyRanges& dirtyRanges : group.m_dirtyRangesHistory)
+            {
+                dirtyRanges.MarkAll();
+            }
         }
         return resultCode;
     }
@@ -262,7 +268,7 @@ namespace AZ::RHI
     }
 
     template<typename T>
-    void DeviceShaderResourceGroupPool::UpdateMaskBasedOnViewHash(
+    bool DeviceShaderResourceGroupPool::UpdateMaskBasedOnViewHash(
         DeviceShaderResourceGroup& shaderResourceGroup, Name entryName, AZStd::span<const RHI::ConstPtr<T>> views,
         DeviceShaderResourceGroupData::ResourceType resourceType)
     {
@@ -273,7 +279,9 @@ namespace AZ::RHI
             shaderResourceGroup.EnableRhiResourceTypeCompilation(static_cast<DeviceShaderResourceGroupData::ResourceTypeMask>(AZ_BIT(static_cast<uint32_t>(resourceType))));
             shaderResourceGroup.ResetResourceTypeIteration(resourceType);
             shaderResourceGroup.UpdateViewHash(entryName, viewHash);
+            return true;
         }
+        return false;
     }
 
     void DeviceShaderResourceGroupPool::ResetUpdateMaskForModifiedViews(
@@ -285,9 +293,12 @@ namespace AZ::RHI
         for (const RHI::ShaderInputImageDescriptor& shaderInputImage : groupLayout.GetShaderInputListForImages())
         {
             const RHI::ShaderInputImageIndex imageInputIndex(shaderInputIndex);
-            UpdateMaskBasedOnViewHash<RHI::DeviceImageView>(
-                shaderResourceGroup, shaderInputImage.m_name, shaderResourceGroupData.GetImageViewArray(imageInputIndex),
-                DeviceShaderResourceGroupData::ResourceType::DeviceImageView);
+            if (UpdateMaskBasedOnViewHash<RHI::DeviceImageView>(
+                    shaderResourceGroup, shaderInputImage.m_name, shaderResourceGroupData.GetImageViewArray(imageInputIndex),
+                    DeviceShaderResourceGroupData::ResourceType::DeviceImageView))
+            {
+                shaderResourceGroup.GetPendingDirtyRanges().MarkImageInput(shaderInputIndex);
+            }
             ++shaderInputIndex;
         }
 
@@ -296,9 +307,12 @@ namespace AZ::RHI
         for (const RHI::ShaderInputBufferDescriptor& shaderInputBuffer : groupLayout.GetShaderInputListForBuffers())
         {
             const RHI::ShaderInputBufferIndex bufferInputIndex(shaderInputIndex);
-            UpdateMaskBasedOnViewHash<RHI::DeviceBufferView>(
-                shaderResourceGroup, shaderInputBuffer.m_name, shaderResourceGroupData.GetBufferViewArray(bufferInputIndex),
-                DeviceShaderResourceGroupData::ResourceType::DeviceBufferView);
+            if (UpdateMaskBasedOnViewHash<RHI::DeviceBufferView>(
+                    shaderResourceGroup, shaderInputBuffer.m_name, shaderResourceGroupData.GetBufferViewArray(bufferInputIndex),
+                    DeviceShaderResourceGroupData::ResourceType::DeviceBufferView))
+            {
+                shaderResourceGroup.GetPendingDirtyRanges().MarkBufferInput(shaderInputIndex);
+            }
             ++shaderInputIndex;
         }
 
@@ -337,6 +351,7 @@ namespace AZ::RHI
             {
                 shaderResourceGroup.EnableRhiResourceTypeCompilation(static_cast<DeviceShaderResourceGroupData::ResourceTypeMask>(AZ_BIT(i)));
             }
+            shaderResourceGroup.GetPendingDirtyRanges().MarkAll();
         }
 
         // Modify m_rhiUpdateMask in case a view was modified. This can happen if a view is invalidated
@@ -345,10 +360,12 @@ namespace AZ::RHI
         // Check if any part of the Srg was updated before trying to compile it
         if (shaderResourceGroup.IsAnyResourceTypeUpdated())
         {
+            shaderResourceGroup.UpdateCompileDirtyRanges();
             ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
                 
             //Reset update mask if the latency check has been fulfilled
             shaderResourceGroup.DisableCompilationForAllResourceTypes();
+            shaderResourceGroup.AdvanceDirtyRangesHistory();
             return resultCode;
         }
         return ResultCode::Success;
@@ -7,89 +7,406 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
 {
-    DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
+    AZ_CVAR(uint32_t, r_drawListRadixSortMinItems, 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Draw lists with at least this many items are sorted with a radix sort instead of a comparison sort. 0 disables the radix sort.");
+    AZ_CVAR(uint32_t, r_drawListParallelSortMinItems, 65536, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Draw lists with at least this many items split the radix sort passes over the job system. 0 disables the parallel sort.");
+    AZ_CVAR(bool, r_drawListSortExploitCoherence, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Try a bounded insertion sort before the full sort, which is cheaper for draw lists that are already nearly sorted.");
+
+    namespace
     {
-        if (drawList.empty())
+        //! Packed radix key for a single draw item. m_index refers back to the item in the unsorted list.
+        struct RadixSortEntry
         {
-            return DrawListView{};
+            uint64_t m_sortKey;
+            uint32_t m_depth;
+            uint32_t m_index;
+        };
+
+        constexpr uint32_t RadixBits = 8;
+        constexpr uint32_t RadixBucketCount = 1u << RadixBits;
+        constexpr uint32_t RadixDigitMask = RadixBucketCount - 1;
+        constexpr uint32_t RadixDepthPassCount = sizeof(uint32_t) * 8 / RadixBits;
+        constexpr uint32_t RadixSortKeyPassCount = sizeof(uint64_t) * 8 / RadixBits;
+        constexpr uint32_t RadixPassCount = RadixDepthPassCount + RadixSortKeyPassCount;
+
+        //! Below this many items per job the scatter passes are dominated by job overhead.
+        constexpr size_t ParallelSortMinItemsPerChunk = 16 * 1024;
+
+        //! The coherent sort gives up once the list has more descents than this fraction of its size...
+        constexpr size_t CoherentSortMaxDescentDivisor = 32;
+        //! ...or once it has moved this many items per list entry.
+        constexpr size_t CoherentSortMaxMovesPerItem = 4;
+
+        using RadixHistogram = AZStd::array<uint32_t, RadixBucketCount>;
+        using RadixHistograms = AZStd::array<RadixHistogram, RadixPassCount>;
+
+        constexpr bool IsKeyFirst(DrawListSortType sortType)
+        {
+            return sortType == DrawListSortType::KeyThenDepth || sortType == DrawListSortType::KeyThenReverseDepth;
         }
 
-        const size_t itemsPerPartition = AZ::DivideAndRoundUp(drawList.size(), partitionCount);
-        const size_t itemOffset = partitionIndex * itemsPerPartition;
-        const size_t itemCount = AZStd::min(drawList.size() - itemOffset, itemsPerPartition);
-        return DrawListView(&drawList[itemOffset], itemCount);
-    }
+        constexpr bool IsReverseDepth(DrawListSortType sortType)
+        {
+            return sortType == DrawListSortType::KeyThenReverseDepth || sortType == DrawListSortType::ReverseDepthThenKey;
+        }
 
-    void SortDrawList(DrawList& drawList, DrawListSortType sortType)
-    {
-        switch (sortType)
+        template<DrawListSortType SortType>
+        struct DrawItemLess
         {
-        case DrawListSortType::KeyThenDepth:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+            bool operator()(const DrawItemProperties& a, const DrawItemProperties& b) const
+            {
+                if constexpr (IsKeyFirst(SortType))
                 {
                     if (a.m_sortKey != b.m_sortKey)
                     {
                         return a.m_sortKey < b.m_sortKey;
                     }
-                    if (a.m_depth != b.m_depth)
+                }
+                if (a.m_depth != b.m_depth)
+                {
+                    return IsReverseDepth(SortType) ? a.m_depth > b.m_depth : a.m_depth < b.m_depth;
+                }
+                if constexpr (!IsKeyFirst(SortType))
+                {
+                    if (a.m_sortKey != b.m_sortKey)
                     {
-                        return a.m_depth < b.m_depth;
+                        return a.m_sortKey < b.m_sortKey;
                     }
-                    return a.m_item < b.m_item;
                 }
-            );
-            break;
+                return a.m_item < b.m_item;
+            }
+        };
 
-        case DrawListSortType::KeyThenReverseDepth:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+        //! Maps the signed sort key onto an unsigned value with the same ordering.
+        uint64_t GetRadixSortKey(DrawItemSortKey sortKey)
+        {
+            return static_cast<uint64_t>(sortKey) ^ (uint64_t{ 1 } << 63);
+        }
+
+        //! Maps the depth onto an unsigned value that orders the same way as the float comparison, inverted for reverse depth.
+        template<DrawListSortType SortType>
+        uint32_t GetRadixDepth(float depth)
+        {
+            uint32_t bits = 0;
+            // -0 and +0 compare equal, so both map to the key of +0
+            if (depth != 0.0f)
+            {
+                memcpy(&bits, &depth, sizeof(bits));
+            }
+            bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            return IsReverseDepth(SortType) ? ~bits : bits;
+        }
+
+        //! LSD passes consume the secondary key first, so the stable passes over the primary key keep its order.
+        template<DrawListSortType SortType>
+        uint32_t GetRadixDigit(const RadixSortEntry& entry, uint32_t pass)
+        {
+            if constexpr (IsKeyFirst(SortType))
+            {
+                return pass < RadixDepthPassCount
+                    ? (entry.m_depth >> (pass * RadixBits)) & RadixDigitMask
+                    : static_cast<uint32_t>(entry.m_sortKey >> ((pass - RadixDepthPassCount) * RadixBits)) & RadixDigitMask;
+            }
+            else
+            {
+                return pass < RadixSortKeyPassCount
+                    ? static_cast<uint32_t>(entry.m_sortKey >> (pass * RadixBits)) & RadixDigitMask
+                    : (entry.m_depth >> ((pass - RadixSortKeyPassCount) * RadixBits)) & RadixDigitMask;
+            }
+        }
+
+        uint32_t GetRadixSortChunkCount(size_t itemCount, bool allowParallel)
+        {
+            if (!allowParallel || !JobContext::GetGlobalContext())
+            {
+                return 1;
+            }
+            const size_t workerCount = JobContext::GetParentContext()->GetJobManager().GetNumWorkerThreads();
+            return aznumeric_cast<uint32_t>(AZStd::clamp<size_t>(itemCount / ParallelSortMinItemsPerChunk, 1, workerCount));
+        }
+
+        template<class Function>
+        void ForEachChunk(uint32_t chunkCount, const Function& function)
+        {
+            if (chunkCount == 1)
+            {
+                function(0);
+            }
+            else
+            {
+                // parallel_for can be waited on from jobs and from task graph workers alike, unlike TaskGraphEvent::Wait(),
+                // which matters because draw lists are sorted from inside the view's sort tasks.
+                AZ::parallel_for(0, aznumeric_cast<int>(chunkCount), [&function](int chunkIndex)
+                    {
+                        function(aznumeric_cast<uint32_t>(chunkIndex));
+                    });
+            }
+        }
+
+        template<DrawListSortType SortType>
+        void SortDrawListRadix(DrawList& drawList, bool allowParallel)
+        {
+            const size_t itemCount = drawList.size();
+            const uint32_t chunkCount = GetRadixSortChunkCount(itemCount, allowParallel);
+            const size_t itemsPerChunk = AZ::DivideAndRoundUp(itemCount, size_t{ chunkCount });
+            const auto getChunkRange = [itemCount, itemsPerChunk](uint32_t chunkIndex)
+            {
+                const size_t begin = AZStd::min(itemCount, chunkIndex * itemsPerChunk);
+                return AZStd::make_pair(begin, AZStd::min(itemCount, begin + itemsPerChunk));
+            };
+
+            AZStd::vector<RadixSortEntry> entries(itemCount);
+            AZStd::vector<RadixSortEntry> scratch(itemCount);
+            AZStd::vector<RadixHistograms> chunkHistograms(chunkCount);
+
+            // Pack the keys and build the histograms of every pass in a single read of the draw list
+            ForEachChunk(chunkCount, [&](uint32_t chunkIndex)
                 {
-                    if (a.m_sortKey != b.m_sortKey)
+                    RadixHistograms& histograms = chunkHistograms[chunkIndex];
+                    for (RadixHistogram& histogram : histograms)
                     {
-                        return a.m_sortKey < b.m_sortKey;
+                        histogram.fill(0);
                     }
-                    if (a.m_depth != b.m_depth)
+
+                    const auto [begin, end] = getChunkRange(chunkIndex);
+                    for (size_t i = begin; i < end; ++i)
                     {
-                        return a.m_depth > b.m_depth;
+                        const DrawItemProperties& item = drawList[i];
+                        RadixSortEntry& entry = entries[i];
+                        entry.m_sortKey = GetRadixSortKey(item.m_sortKey);
+                        entry.m_depth = GetRadixDepth<SortType>(item.m_depth);
+                        entry.m_index = aznumeric_cast<uint32_t>(i);
+                        for (uint32_t pass = 0; pass < RadixPassCount; ++pass)
+                        {
+                            ++histograms[pass][GetRadixDigit<SortType>(entry, pass)];
+                        }
                     }
-                    return a.m_item < b.m_item;
+                });
+
+            RadixSortEntry* source = entries.data();
+            RadixSortEntry* destination = scratch.data();
+            bool firstScatter = true;
+            for (uint32_t pass = 0; pass < RadixPassCount; ++pass)
+            {
+                // A digit shared by every item doesn't reorder anything, e.g. the upper bytes of sort keys or depths that span a narrow range
+                const uint32_t firstDigit = GetRadixDigit<SortType>(source[0], pass);
+                uint32_t firstDigitCount = 0;
+                for (const RadixHistograms& histograms : chunkHistograms)
+                {
+                    firstDigitCount += histograms[pass][firstDigit];
+                }
+                if (firstDigitCount == itemCount)
+                {
+                    continue;
                 }
-            );
-            break;
 
-        case DrawListSortType::DepthThenKey:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                // The per chunk histograms stay valid for the first scatter since nothing has moved yet. After that each chunk
+                // holds different items, the totals are unchanged so a single chunk never needs to recount.
+                if (!firstScatter && chunkCount > 1)
+                {
+                    ForEachChunk(chunkCount, [&](uint32_t chunkIndex)
+                        {
+                            RadixHistogram& histogram = chunkHistograms[chunkIndex][pass];
+                            histogram.fill(0);
+                            const auto [begin, end] = getChunkRange(chunkIndex);
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                ++histogram[GetRadixDigit<SortType>(source[i], pass)];
+                            }
+                        });
+                }
+                firstScatter = false;
+
+                // Offsets are assigned digit major and chunk minor, so items with the same digit keep their relative order across chunks
+                AZStd::vector<RadixHistogram> chunkOffsets(chunkCount);
+                uint32_t offset = 0;
+                for (uint32_t digit = 0; digit < RadixBucketCount; ++digit)
                 {
-                    if (a.m_depth != b.m_depth)
+                    for (uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
                     {
-                        return a.m_depth < b.m_depth;
+                        chunkOffsets[chunkIndex][digit] = offset;
+                        offset += chunkHistograms[chunkIndex][pass][digit];
                     }
-                    if (a.m_sortKey != b.m_sortKey)
+                }
+
+                ForEachChunk(chunkCount, [&](uint32_t chunkIndex)
                     {
-                        return a.m_sortKey < b.m_sortKey;
+                        RadixHistogram& offsets = chunkOffsets[chunkIndex];
+                        const auto [begin, end] = getChunkRange(chunkIndex);
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            destination[offsets[GetRadixDigit<SortType>(source[i], pass)]++] = source[i];
+                        }
+                    });
+
+                AZStd::swap(source, destination);
+            }
+
+            DrawList sortedDrawList(itemCount);
+            ForEachChunk(chunkCount, [&](uint32_t chunkIndex)
+                {
+                    const auto [begin, end] = getChunkRange(chunkIndex);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        sortedDrawList[i] = drawList[source[i].m_index];
                     }
-                    return a.m_item < b.m_item;
-                }
-            );
-            break;
+                });
+            drawList.swap(sortedDrawList);
 
-        case DrawListSortType::ReverseDepthThenKey:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+            // The radix key leaves out the draw item address, which is the final tie break of the comparison sort
+            size_t runBegin = 0;
+            for (size_t i = 1; i <= itemCount; ++i)
+            {
+                if (i == itemCount || drawList[i].m_sortKey != drawList[runBegin].m_sortKey || drawList[i].m_depth != drawList[runBegin].m_depth)
                 {
-                    if (a.m_depth != b.m_depth)
+                    if (i - runBegin > 1)
                     {
-                        return a.m_depth > b.m_depth;
+                        AZStd::sort(drawList.begin() + runBegin, drawList.begin() + i, [](const DrawItemProperties& a, const DrawItemProperties& b)
+                            {
+                                return a.m_item < b.m_item;
+                            });
                     }
-                    if (a.m_sortKey != b.m_sortKey)
+                    runBegin = i;
+                }
+            }
+        }
+
+        //! Draw lists are rebuilt every frame, but visibility and the feature processors tend to emit items in a similar order
+        //! each frame, so the list is often nearly sorted already. Returns false if the list turned out not to be, in which
+        //! case it has been partially reordered and still needs a full sort.
+        template<DrawListSortType SortType>
+        bool SortDrawListCoherent(DrawList& drawList)
+        {
+            const DrawItemLess<SortType> less;
+            const size_t itemCount = drawList.size();
+
+            size_t descentCount = 0;
+            for (size_t i = 1; i < itemCount; ++i)
+            {
+                descentCount += less(drawList[i], drawList[i - 1]) ? 1 : 0;
+            }
+            if (descentCount == 0)
+            {
+                return true;
+            }
+            if (descentCount > itemCount / CoherentSortMaxDescentDivisor)
+            {
+                return false;
+            }
+
+            size_t moveBudget = itemCount * CoherentSortMaxMovesPerItem;
+            for (size_t i = 1; i < itemCount; ++i)
+            {
+                if (!less(drawList[i], drawList[i - 1]))
+                {
+                    continue;
+                }
+
+                const DrawItemProperties item = drawList[i];
+                size_t j = i;
+                do
+                {
+                    drawList[j] = drawList[j - 1];
+                    --j;
+                    if (--moveBudget == 0)
                     {
-                        return a.m_sortKey < b.m_sortKey;
+                        drawList[j] = item;
+                        return false;
                     }
-                    return a.m_item < b.m_item;
+                } while (j > 0 && less(item, drawList[j - 1]));
+                drawList[j] = item;
+            }
+            return true;
+        }
+
+        template<DrawListSortType SortType>
+        void SortDrawListTyped(DrawList& drawList, DrawListSortMethod sortMethod)
+        {
+            if (sortMethod == DrawListSortMethod::Automatic && r_drawListSortExploitCoherence)
+            {
+                sortMethod = DrawListSortMethod::Coherent;
+            }
+
+            if (sortMethod == DrawListSortMethod::Coherent)
+            {
+                if (SortDrawListCoherent<SortType>(drawList))
+                {
+                    return;
+                }
+                sortMethod = DrawListSortMethod::Automatic;
+            }
+
+            if (sortMethod == DrawListSortMethod::Automatic)
+            {
+                const uint32_t radixMinItems = r_drawListRadixSortMinItems;
+                const uint32_t parallelMinItems = r_drawListParallelSortMinItems;
+                if (radixMinItems == 0 || drawList.size() < radixMinItems)
+                {
+                    sortMethod = DrawListSortMethod::Comparison;
+                }
+                else if (parallelMinItems != 0 && drawList.size() >= parallelMinItems)
+                {
+                    sortMethod = DrawListSortMethod::ParallelRadix;
+                }
+                else
+                {
+                    sortMethod = DrawListSortMethod::Radix;
                 }
-            );
+            }
+
+            if (sortMethod == DrawListSortMethod::Comparison || drawList.size() < 2)
+            {
+                AZStd::sort(drawList.begin(), drawList.end(), DrawItemLess<SortType>());
+            }
+            else
+            {
+                SortDrawListRadix<SortType>(drawList, sortMethod == DrawListSortMethod::ParallelRadix);
+            }
+        }
+    }
+
+    DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
+    {
+        if (drawList.empty())
+        {
+            return DrawListView{};
+        }
+
+        const size_t itemsPerPartition = AZ::DivideAndRoundUp(drawList.size(), partitionCount);
+        const size_t itemOffset = partitionIndex * itemsPerPartition;
+        const size_t itemCount = AZStd::min(drawList.size() - itemOffset, itemsPerPartition);
+        return DrawListView(&drawList[itemOffset], itemCount);
+    }
+
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType, DrawListSortMethod sortMethod)
+    {
+        switch (sortType)
+        {
+        case DrawListSortType::KeyThenDepth:
+            SortDrawListTyped<DrawListSortType::KeyThenDepth>(drawList, sortMethod);
+            break;
+
+        case DrawListSortType::KeyThenReverseDepth:
+            SortDrawListTyped<DrawListSortType::KeyThenReverseDepth>(drawList, sortMethod);
+            break;
+
+        case DrawListSortType::DepthThenKey:
+            SortDrawListTyped<DrawListSortType::DepthThenKey>(drawList, sortMethod);
+            break;
+
+        case DrawListSortType::ReverseDepthThenKey:
+            SortDrawListTyped<DrawListSortType::ReverseDepthThenKey>(drawList, sortMethod);
             break;
         }
     }
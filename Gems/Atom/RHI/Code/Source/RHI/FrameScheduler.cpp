@@ -25,15 +25,22 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/DeviceRayTracingShaderTable.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/time.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_srgCompileAutoSplit, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Size the SRG compile jobs from the number of SRGs queued this frame, using m_shaderResourceGroupCompilesPerJob as the upper bound");
+    AZ_CVAR(uint32_t, r_srgCompileMinGroupsPerJob, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Smallest number of SRGs compiled by one job when r_srgCompileAutoSplit is enabled. Frames with fewer SRGs are compiled inline.");
+
     static constexpr const char* frameTimeMetricName = "Frame to Frame Time";
     static constexpr AZ::Crc32 frameTimeMetricId = AZ_CRC_CE(frameTimeMetricName);
 
@@ -288,6 +295,21 @@ namespace AZ::RHI
         }
     }
 
+    uint32_t FrameScheduler::GetShaderResourceGroupCompilesPerJob(uint32_t compilesTotal) const
+    {
+        const uint32_t compilesPerJobMax = AZStd::max(m_compileRequest.m_shaderResourceGroupCompilesPerJob, 1u);
+        if (!r_srgCompileAutoSplit)
+        {
+            return compilesPerJobMax;
+        }
+
+        // Aim for a few jobs per worker so the work stays balanced when some SRGs are much more expensive than others,
+        // but never go below the minimum where the scheduling overhead would outweigh the compiles.
+        const uint32_t compilesPerJobMin = AZStd::min(AZStd::max(static_cast<uint32_t>(r_srgCompileMinGroupsPerJob), 1u), compilesPerJobMax);
+        const uint32_t jobCountTarget = AZStd::max(AZStd::thread::hardware_concurrency(), 1u) * 2;
+        return AZStd::clamp(AZ::DivideAndRoundUp(compilesTotal, jobCountTarget), compilesPerJobMin, compilesPerJobMax);
+    }
+
     void FrameScheduler::CompileShaderResourceGroups()
     {
         AZ_PROFILE_SCOPE(RHI, "FrameScheduler: CompileShaderResourceGroups");
@@ -307,15 +329,47 @@ namespace AZ::RHI
 
                 if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
                 {
+                    const auto compileGroupsBeginFunction = [](DeviceShaderResourceGroupPool* srgPool)
+                    {
+                        srgPool->CompileGroupsBegin();
+                    };
+
+                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(
+                        compileGroupsBeginFunction);
+
+                    uint32_t compilesTotal = 0;
+                    const auto countCompilesFunction = [&compilesTotal](DeviceShaderResourceGroupPool* srgPool)
+                    {
+                        compilesTotal += srgPool->GetGroupsToCompileCount();
+                    };
+
+                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(countCompilesFunction)>(countCompilesFunction);
+
+                    const uint32_t compilesPerJob = GetShaderResourceGroupCompilesPerJob(compilesTotal);
+
+                    const auto compileGroupsEndFunction = [](DeviceShaderResourceGroupPool* srgPool)
+                    {
+                        srgPool->CompileGroupsEnd();
+                    };
+
+                    if (compilesTotal <= compilesPerJob)
+                    {
+                        // Not worth forking, the whole frame fits in a single job.
+                        const auto compileAllLambda = [](DeviceShaderResourceGroupPool* srgPool)
+                        {
+                            srgPool->CompileGroupsForInterval(Interval(0, srgPool->GetGroupsToCompileCount()));
+                        };
+
+                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
+                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
+                    }
                     // Iterate over each SRG pool and fork jobs to compile SRGs.
-                    const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
-                    if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
+                    else if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
                     {
                         AZ::TaskGraph taskGraph{ "SRG Compilation" };
 
                         const auto compileIntervalsFunction = [compilesPerJob, &taskGraph](DeviceShaderResourceGroupPool* srgPool)
                         {
-                            srgPool->CompileGroupsBegin();
                             const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
                             const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
                             AZ::TaskDescriptor srgCompileDesc{ "SrgCompile", "Graphics" };
@@ -356,15 +410,6 @@ namespace AZ::RHI
                     }
                     else // use Job system
                     {
-                        const auto compileGroupsBeginFunction = [](DeviceShaderResourceGroupPool* srgPool)
-                        {
-                            srgPool->CompileGroupsBegin();
-                        };
-
-                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(
-                            compileGroupsBeginFunction);
-
-                        // Iterate over each SRG pool and fork jobs to compile SRGs.
                         AZ::JobCompletion jobCompletion;
 
                         const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](DeviceShaderResourceGroupPool* srgPool)
@@ -396,11 +441,6 @@ namespace AZ::RHI
 
                         jobCompletion.StartAndWaitForCompletion();
 
-                        const auto compileGroupsEndFunction = [](DeviceShaderResourceGroupPool* srgPool)
-                        {
-                            srgPool->CompileGroupsEnd();
-                        };
-
                         resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
                     }
                 }
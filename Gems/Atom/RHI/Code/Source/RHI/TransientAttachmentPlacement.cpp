@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI/TransientAttachmentPlacement.h>
+
+#include <Atom/RHI.Reflect/Bits.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AZ::RHI
+{
+    namespace
+    {
+        enum class GapSearch
+        {
+            //! Use the smallest gap the attachment fits in, which leaves the larger gaps for later attachments.
+            BestFit,
+            //! Use the gap with the lowest offset, like the first-fit allocator of the heap.
+            LowestOffset
+        };
+
+        bool LifetimesIntersect(const TransientAttachmentLifetime& lhs, const TransientAttachmentLifetime& rhs)
+        {
+            return lhs.m_scopeIndexMin <= rhs.m_scopeIndexMax && rhs.m_scopeIndexMin <= lhs.m_scopeIndexMax;
+        }
+
+        size_t AlignOffset(size_t offset, size_t alignmentInBytes)
+        {
+            return AlignUpNPOT(offset, AZStd::max<size_t>(alignmentInBytes, 1));
+        }
+
+        //! Places the attachments one at a time in the given order. Each attachment goes in a gap between the byte ranges of
+        //! the attachments already placed whose lifetimes intersect its own, or on top of them if no gap is large enough.
+        TransientAttachmentPlacement PlaceInOrder(
+            const AZStd::vector<TransientAttachmentLifetime>& lifetimes, const AZStd::vector<uint32_t>& order, GapSearch gapSearch)
+        {
+            TransientAttachmentPlacement placement;
+            placement.m_heapOffsets.resize(lifetimes.size(), 0);
+
+            AZStd::vector<uint32_t> placedIndices;
+            placedIndices.reserve(lifetimes.size());
+            AZStd::vector<AZStd::pair<size_t, size_t>> occupiedRanges;
+
+            for (const uint32_t index : order)
+            {
+                const TransientAttachmentLifetime& lifetime = lifetimes[index];
+
+                occupiedRanges.clear();
+                for (const uint32_t placedIndex : placedIndices)
+                {
+                    if (LifetimesIntersect(lifetime, lifetimes[placedIndex]))
+                    {
+                        const size_t offset = placement.m_heapOffsets[placedIndex];
+                        occupiedRanges.emplace_back(offset, offset + lifetimes[placedIndex].m_sizeInBytes);
+                    }
+                }
+                AZStd::sort(occupiedRanges.begin(), occupiedRanges.end());
+
+                size_t bestOffset = AZStd::numeric_limits<size_t>::max();
+                size_t bestGapSize = AZStd::numeric_limits<size_t>::max();
+                size_t gapBegin = 0;
+                for (const auto& [rangeBegin, rangeEnd] : occupiedRanges)
+                {
+                    const size_t offset = AlignOffset(gapBegin, lifetime.m_alignmentInBytes);
+                    if (rangeBegin >= offset && rangeBegin - offset >= lifetime.m_sizeInBytes)
+                    {
+                        const size_t gapSize = rangeBegin - gapBegin;
+                        if (gapSearch == GapSearch::LowestOffset)
+                        {
+                            bestOffset = offset;
+                            break;
+                        }
+                        if (gapSize < bestGapSize)
+                        {
+                            bestGapSize = gapSize;
+                            bestOffset = offset;
+                        }
+                    }
+                    gapBegin = AZStd::max(gapBegin, rangeEnd);
+                }
+
+                if (bestOffset == AZStd::numeric_limits<size_t>::max())
+                {
+                    bestOffset = AlignOffset(gapBegin, lifetime.m_alignmentInBytes);
+                }
+
+                placement.m_heapOffsets[index] = bestOffset;
+                placement.m_heapSizeInBytes = AZStd::max(placement.m_heapSizeInBytes, bestOffset + lifetime.m_sizeInBytes);
+                placedIndices.push_back(index);
+            }
+
+            return placement;
+        }
+
+        template<class Compare>
+        AZStd::vector<uint32_t> CreateOrder(const AZStd::vector<TransientAttachmentLifetime>& lifetimes, Compare compare)
+        {
+            AZStd::vector<uint32_t> order(lifetimes.size());
+            for (uint32_t index = 0; index < order.size(); ++index)
+            {
+                order[index] = index;
+            }
+            // Ties keep the order of the lifetimes, which keeps the result deterministic.
+            AZStd::stable_sort(order.begin(), order.end(), [&lifetimes, &compare](uint32_t lhs, uint32_t rhs)
+                {
+                    return compare(lifetimes[lhs], lifetimes[rhs]);
+                });
+            return order;
+        }
+
+        size_t GetLifetimeLength(const TransientAttachmentLifetime& lifetime)
+        {
+            return lifetime.m_scopeIndexMax - lifetime.m_scopeIndexMin + 1;
+        }
+    } // namespace
+
+    namespace TransientAttachmentPlacementSolver
+    {
+        TransientAttachmentPlacement Solve(const AZStd::vector<TransientAttachmentLifetime>& lifetimes)
+        {
+            // The runtime order comes first so it wins ties, which keeps the placement of the heap when the solver can't improve it.
+            const AZStd::vector<uint32_t> orders[] = {
+                CreateOrder(lifetimes, [](const TransientAttachmentLifetime& lhs, const TransientAttachmentLifetime& rhs)
+                    {
+                        return lhs.m_scopeIndexMin < rhs.m_scopeIndexMin;
+                    }),
+                CreateOrder(lifetimes, [](const TransientAttachmentLifetime& lhs, const TransientAttachmentLifetime& rhs)
+                    {
+                        if (lhs.m_sizeInBytes != rhs.m_sizeInBytes)
+                        {
+                            return lhs.m_sizeInBytes > rhs.m_sizeInBytes;
+                        }
+                        return GetLifetimeLength(lhs) > GetLifetimeLength(rhs);
+                    }),
+                CreateOrder(lifetimes, [](const TransientAttachmentLifetime& lhs, const TransientAttachmentLifetime& rhs)
+                    {
+                        if (GetLifetimeLength(lhs) != GetLifetimeLength(rhs))
+                        {
+                            return GetLifetimeLength(lhs) > GetLifetimeLength(rhs);
+                        }
+                        return lhs.m_sizeInBytes > rhs.m_sizeInBytes;
+                    })
+            };
+
+            TransientAttachmentPlacement bestPlacement;
+            bool hasPlacement = false;
+            for (const AZStd::vector<uint32_t>& order : orders)
+            {
+                for (const GapSearch gapSearch : { GapSearch::LowestOffset, GapSearch::BestFit })
+                {
+                    TransientAttachmentPlacement placement = PlaceInOrder(lifetimes, order, gapSearch);
+                    if (!hasPlacement || placement.m_heapSizeInBytes < bestPlacement.m_heapSizeInBytes)
+                    {
+                        bestPlacement = AZStd::move(placement);
+                        hasPlacement = true;
+                    }
+                }
+            }
+            return bestPlacement;
+        }
+
+        bool IsValid(const AZStd::vector<TransientAttachmentLifetime>& lifetimes, const TransientAttachmentPlacement& placement)
+        {
+            if (placement.m_heapOffsets.size() != lifetimes.size())
+            {
+                return false;
+            }
+
+            for (size_t index = 0; index < lifetimes.size(); ++index)
+            {
+                const size_t offset = placement.m_heapOffsets[index];
+                if (offset != AlignOffset(offset, lifetimes[index].m_alignmentInBytes) ||
+                    offset + lifetimes[index].m_sizeInBytes > placement.m_heapSizeInBytes)
+                {
+                    return false;
+                }
+
+                for (size_t otherIndex = index + 1; otherIndex < lifetimes.size(); ++otherIndex)
+                {
+                    const size_t otherOffset = placement.m_heapOffsets[otherIndex];
+                    const bool bytesIntersect =
+                        offset < otherOffset + lifetimes[otherIndex].m_sizeInBytes && otherOffset < offset + lifetimes[index].m_sizeInBytes;
+                    if (bytesIntersect && LifetimesIntersect(lifetimes[index], lifetimes[otherIndex]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        size_t ComputePeakMemory(const AZStd::vector<TransientAttachmentLifetime>& lifetimes)
+        {
+            // Sweep the scopes, an attachment is added at its first scope and removed after its last one.
+            // Removals sort before additions at the same scope index, since they belong to the previous scope.
+            AZStd::vector<AZStd::pair<size_t, int64_t>> events;
+            events.reserve(lifetimes.size() * 2);
+            for (const TransientAttachmentLifetime& lifetime : lifetimes)
+            {
+                const int64_t sizeInBytes = aznumeric_cast<int64_t>(lifetime.m_sizeInBytes);
+                events.emplace_back(lifetime.m_scopeIndexMin, sizeInBytes);
+                events.emplace_back(lifetime.m_scopeIndexMax + 1, -sizeInBytes);
+            }
+            AZStd::sort(events.begin(), events.end());
+
+            int64_t liveMemory = 0;
+            int64_t peakMemory = 0;
+            for (const auto& [scopeIndex, sizeDelta] : events)
+            {
+                liveMemory += sizeDelta;
+                peakMemory = AZStd::max(peakMemory, liveMemory);
+            }
+            return aznumeric_cast<size_t>(peakMemory);
+        }
+
+        HashValue64 ComputeTopologyHash(const AZStd::vector<TransientAttachmentLifetime>& lifetimes)
+        {
+            size_t seed = lifetimes.size();
+            for (const TransientAttachmentLifetime& lifetime : lifetimes)
+            {
+                AZStd::hash_combine(
+                    seed,
+                    lifetime.m_id.GetHash(),
+                    lifetime.m_sizeInBytes,
+                    lifetime.m_alignmentInBytes,
+                    lifetime.m_scopeIndexMin,
+                    lifetime.m_scopeIndexMax);
+            }
+            return HashValue64{ seed };
+        }
+
+        AZStd::vector<TransientAttachmentLifetime> GetLifetimes(
+            const TransientAttachmentStatistics::Heap& heapStatistics, size_t alignmentInBytes)
+        {
+            AZStd::vector<TransientAttachmentLifetime> lifetimes;
+            lifetimes.reserve(heapStatistics.m_attachments.size());
+            for (const TransientAttachmentStatistics::Attachment& attachment : heapStatistics.m_attachments)
+            {
+                TransientAttachmentLifetime& lifetime = lifetimes.emplace_back();
+                lifetime.m_id = attachment.m_id;
+                lifetime.m_sizeInBytes = attachment.m_sizeInBytes;
+                lifetime.m_alignmentInBytes = alignmentInBytes;
+                lifetime.m_scopeIndexMin = attachment.m_scopeOffsetMin;
+                lifetime.m_scopeIndexMax = AZStd::max(attachment.m_scopeOffsetMin, attachment.m_scopeOffsetMax);
+            }
+            return lifetimes;
+        }
+
+        TransientAttachmentPlacementReport CreateReport(const TransientAttachmentStatistics::Heap& heapStatistics, size_t alignmentInBytes)
+        {
+            const AZStd::vector<TransientAttachmentLifetime> lifetimes = GetLifetimes(heapStatistics, alignmentInBytes);
+
+            TransientAttachmentPlacementReport report;
+            report.m_peakMemoryInBytes = ComputePeakMemory(lifetimes);
+            report.m_heapSizeInBytes = heapStatistics.m_watermarkSize;
+            report.m_solvedHeapSizeInBytes = Solve(lifetimes).m_heapSizeInBytes;
+            if (report.m_heapSizeInBytes > 0)
+            {
+                report.m_fragmentation =
+                    1.0f - aznumeric_cast<float>(report.m_peakMemoryInBytes) / aznumeric_cast<float>(report.m_heapSizeInBytes);
+            }
+            return report;
+        }
+    } // namespace TransientAttachmentPlacementSolver
+
+    TransientAttachmentPlacementCache::TransientAttachmentPlacementCache(size_t capacity)
+        : m_capacity(AZStd::max<size_t>(capacity, 1))
+    {
+    }
+
+    const TransientAttachmentPlacement& TransientAttachmentPlacementCache::FindOrSolve(
+        const AZStd::vector<TransientAttachmentLifetime>& lifetimes)
+    {
+        const HashValue64 topologyHash = TransientAttachmentPlacementSolver::ComputeTopologyHash(lifetimes);
+        ++m_useCounter;
+
+        for (Entry& entry : m_entries)
+        {
+            if (entry.m_topologyHash == topologyHash && entry.m_lifetimes == lifetimes)
+            {
+                entry.m_lastUse = m_useCounter;
+                return entry.m_placement;
+            }
+        }
+
+        Entry* entry = nullptr;
+        if (m_entries.size() < m_capacity)
+        {
+            entry = &m_entries.emplace_back();
+        }
+        else
+        {
+            entry = &m_entries.front();
+            for (Entry& candidate : m_entries)
+            {
+                if (candidate.m_lastUse < entry->m_lastUse)
+                {
+                    entry = &candidate;
+                }
+            }
+        }
+
+        entry->m_topologyHash = topologyHash;
+        entry->m_lifetimes = lifetimes;
+        entry->m_placement = TransientAttachmentPlacementSolver::Solve(lifetimes);
+        entry->m_lastUse = m_useCounter;
+        return entry->m_placement;
+    }
+
+    void TransientAttachmentPlacementCache::Clear()
+    {
+        m_entries.clear();
+    }
+
+    size_t TransientAttachmentPlacementCache::GetEntryCount() const
+    {
+        return m_entries.size();
+    }
+} // namespace AZ::RHI
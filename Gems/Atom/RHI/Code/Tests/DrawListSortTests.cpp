@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+
+#include <Atom/RHI/DrawList.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace DrawListSortTestUtils
+    {
+        //! Builds a draw list with many duplicate sort keys and depths, so every tie break is exercised.
+        //! The draw item pointers are never dereferenced by the sort, they only need distinct addresses.
+        RHI::DrawList BuildDrawList(size_t itemCount, uint32_t seed)
+        {
+            SimpleLcgRandom random(seed);
+            RHI::DrawList drawList(itemCount);
+            for (RHI::DrawItemProperties& item : drawList)
+            {
+                item.m_item = reinterpret_cast<const RHI::DrawItem*>(static_cast<uintptr_t>((random.GetRandom() % 4096 + 1) * 16));
+                item.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16) - 8;
+                if (random.GetRandom() % 2)
+                {
+                    item.m_sortKey = item.m_sortKey * (RHI::DrawItemSortKey{ 1 } << 40) + random.GetRandom();
+                }
+                const float depths[] = { 0.0f, -0.0f, 1.0f, -1.0f, 1000.0f };
+                item.m_depth = (random.GetRandom() % 2) ? depths[random.GetRandom() % AZ_ARRAY_SIZE(depths)] : random.GetRandomFloat() * 200.0f - 100.0f;
+                item.m_drawFilterMask = random.GetRandom();
+            }
+            return drawList;
+        }
+
+        void SetUpJobManager(AZStd::unique_ptr<JobManager>& jobManager, AZStd::unique_ptr<JobContext>& jobContext)
+        {
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            const uint32_t numWorkerThreads = desc.GetWorkerThreadCount(AZStd::thread::hardware_concurrency());
+            for (uint32_t i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            jobManager = AZStd::make_unique<JobManager>(desc);
+            jobContext = AZStd::make_unique<JobContext>(*jobManager);
+            JobContext::SetGlobalContext(jobContext.get());
+        }
+
+        void TearDownJobManager(AZStd::unique_ptr<JobManager>& jobManager, AZStd::unique_ptr<JobContext>& jobContext)
+        {
+            JobContext::SetGlobalContext(nullptr);
+            jobContext.reset();
+            jobManager.reset();
+        }
+    }
+
+    class DrawListSortTests
+        : public RHITestFixture
+        , public ::testing::WithParamInterface<RHI::DrawListSortType>
+    {
+    protected:
+        void SetUp() override
+        {
+            RHITestFixture::SetUp();
+            DrawListSortTestUtils::SetUpJobManager(m_jobManager, m_jobContext);
+        }
+
+        void TearDown() override
+        {
+            DrawListSortTestUtils::TearDownJobManager(m_jobManager, m_jobContext);
+            RHITestFixture::TearDown();
+        }
+
+        void ExpectSameOrder(const RHI::DrawList& expected, const RHI::DrawList& actual)
+        {
+            ASSERT_EQ(expected.size(), actual.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                // Items that only differ in their filter mask are interchangeable for every sort method
+                EXPECT_EQ(expected[i].m_item, actual[i].m_item) << "index " << i;
+                EXPECT_EQ(expected[i].m_sortKey, actual[i].m_sortKey) << "index " << i;
+                EXPECT_EQ(expected[i].m_depth, actual[i].m_depth) << "index " << i;
+            }
+        }
+
+        void TestSortMethodMatchesComparison(RHI::DrawListSortMethod sortMethod, const RHI::DrawList& drawList)
+        {
+            RHI::DrawList expected = drawList;
+            RHI::SortDrawList(expected, GetParam(), RHI::DrawListSortMethod::Comparison);
+
+            RHI::DrawList actual = drawList;
+            RHI::SortDrawList(actual, GetParam(), sortMethod);
+            ExpectSameOrder(expected, actual);
+        }
+
+    private:
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+    };
+
+    TEST_P(DrawListSortTests, Radix_MatchesComparisonSort)
+    {
+        TestSortMethodMatchesComparison(RHI::DrawListSortMethod::Radix, DrawListSortTestUtils::BuildDrawList(5000, 1234));
+    }
+
+    TEST_P(DrawListSortTests, ParallelRadix_MatchesComparisonSort)
+    {
+        // Large enough to be split into several chunks
+        TestSortMethodMatchesComparison(RHI::DrawListSortMethod::ParallelRadix, DrawListSortTestUtils::BuildDrawList(100000, 5678));
+    }
+
+    TEST_P(DrawListSortTests, Coherent_NearlySortedList_MatchesComparisonSort)
+    {
+        RHI::DrawList drawList = DrawListSortTestUtils::BuildDrawList(5000, 4321);
+        RHI::SortDrawList(drawList, GetParam(), RHI::DrawListSortMethod::Comparison);
+        SimpleLcgRandom random(8765);
+        for (size_t i = 0; i < drawList.size() / 100; ++i)
+        {
+            AZStd::swap(drawList[random.GetRandom() % drawList.size()], drawList[random.GetRandom() % drawList.size()]);
+        }
+
+        TestSortMethodMatchesComparison(RHI::DrawListSortMethod::Coherent, drawList);
+    }
+
+    TEST_P(DrawListSortTests, Coherent_ShuffledList_FallsBackAndMatchesComparisonSort)
+    {
+        TestSortMethodMatchesComparison(RHI::DrawListSortMethod::Coherent, DrawListSortTestUtils::BuildDrawList(5000, 9876));
+    }
+
+    TEST_P(DrawListSortTests, AllMethods_TrivialLists_DoNotCrash)
+    {
+        for (RHI::DrawListSortMethod sortMethod : { RHI::DrawListSortMethod::Automatic, RHI::DrawListSortMethod::Comparison,
+                                                    RHI::DrawListSortMethod::Radix, RHI::DrawListSortMethod::ParallelRadix,
+                                                    RHI::DrawListSortMethod::Coherent })
+        {
+            TestSortMethodMatchesComparison(sortMethod, RHI::DrawList{});
+            TestSortMethodMatchesComparison(sortMethod, DrawListSortTestUtils::BuildDrawList(1, 1));
+            TestSortMethodMatchesComparison(sortMethod, DrawListSortTestUtils::BuildDrawList(3, 2));
+        }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        DrawListSort,
+        DrawListSortTests,
+        ::testing::Values(
+            RHI::DrawListSortType::KeyThenDepth,
+            RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey,
+            RHI::DrawListSortType::ReverseDepthThenKey));
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+
+    //! Sorts a draw list of state.range(0) items with the sort method given by state.range(1).
+    //! The unsorted list is copied back in every iteration with timing paused.
+    class DrawListSortBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunSort(benchmark::State& state, const RHI::DrawList& unsorted)
+        {
+            const RHI::DrawListSortMethod sortMethod = static_cast<RHI::DrawListSortMethod>(state.range(1));
+            RHI::DrawList drawList;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                drawList = unsorted;
+                state.ResumeTiming();
+
+                RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenReverseDepth, sortMethod);
+                benchmark::DoNotOptimize(drawList.data());
+            }
+            state.SetItemsProcessed(state.iterations() * unsorted.size());
+        }
+
+    private:
+        void internalSetUp()
+        {
+            UnitTest::DrawListSortTestUtils::SetUpJobManager(m_jobManager, m_jobContext);
+        }
+
+        void internalTearDown()
+        {
+            UnitTest::DrawListSortTestUtils::TearDownJobManager(m_jobManager, m_jobContext);
+        }
+
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+    };
+
+    static void DrawListSortArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t itemCount : { 10000, 100000, 500000 })
+        {
+            for (RHI::DrawListSortMethod sortMethod : { RHI::DrawListSortMethod::Comparison, RHI::DrawListSortMethod::Radix,
+                                                        RHI::DrawListSortMethod::ParallelRadix, RHI::DrawListSortMethod::Coherent })
+            {
+                benchmark->Args({ itemCount, static_cast<int64_t>(sortMethod) });
+            }
+        }
+        benchmark->ArgNames({ "Items", "Method" });
+        benchmark->Unit(benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, SortDrawList_Shuffled)(benchmark::State& state)
+    {
+        const RHI::DrawList unsorted = UnitTest::DrawListSortTestUtils::BuildDrawList(aznumeric_cast<size_t>(state.range(0)), 1234);
+        RunSort(state, unsorted);
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, SortDrawList_Shuffled)->Apply(DrawListSortArguments);
+
+    //! Approximates a list whose items were emitted in roughly the same order as the previous frame
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, SortDrawList_NearlySorted)(benchmark::State& state)
+    {
+        RHI::DrawList unsorted = UnitTest::DrawListSortTestUtils::BuildDrawList(aznumeric_cast<size_t>(state.range(0)), 1234);
+        RHI::SortDrawList(unsorted, RHI::DrawListSortType::KeyThenReverseDepth, RHI::DrawListSortMethod::Comparison);
+        SimpleLcgRandom random(5678);
+        for (size_t i = 0; i < unsorted.size() / 200; ++i)
+        {
+            const size_t index = random.GetRandom() % (unsorted.size() - 1);
+            AZStd::swap(unsorted[index], unsorted[index + 1]);
+        }
+        RunSort(state, unsorted);
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, SortDrawList_NearlySorted)->Apply(DrawListSortArguments);
+}
+#endif
@@ -697,6 +697,58 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGDataDirtyRanges_SetConstants_TracksWrittenBytes)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        RHI::DeviceShaderResourceGroupData srgData = PrepareSRGData(srgLayout);
+        const uint32_t constantDataSize = static_cast<uint32_t>(srgData.GetConstantData().size());
+
+        // Nothing tracked means everything has to be compiled
+        RHI::Interval constantBytes = srgData.GetDirtyRanges().GetConstantBytes(constantDataSize);
+        EXPECT_EQ(constantBytes.m_min, 0u);
+        EXPECT_EQ(constantBytes.m_max, constantDataSize);
+
+        EXPECT_TRUE(srgData.SetConstant(srgLayout->FindShaderInputConstantIndex(Name("m_vector2")), Vector2(1.0f, 2.0f)));
+        constantBytes = srgData.GetDirtyRanges().GetConstantBytes(constantDataSize);
+        EXPECT_EQ(constantBytes.m_min, offsetof(ConstantBufferTest, m_vector2));
+        EXPECT_EQ(constantBytes.m_max, offsetof(ConstantBufferTest, m_vector2) + 8);
+
+        EXPECT_TRUE(srgData.SetConstant(srgLayout->FindShaderInputConstantIndex(Name("m_vector3")), Vector3(1.0f, 2.0f, 3.0f)));
+        constantBytes = srgData.GetDirtyRanges().GetConstantBytes(constantDataSize);
+        EXPECT_EQ(constantBytes.m_min, offsetof(ConstantBufferTest, m_vector2));
+        EXPECT_EQ(constantBytes.m_max, offsetof(ConstantBufferTest, m_vector3) + 12);
+
+        srgData.ResetUpdateMask();
+        constantBytes = srgData.GetDirtyRanges().GetConstantBytes(constantDataSize);
+        EXPECT_EQ(constantBytes.m_min, 0u);
+        EXPECT_EQ(constantBytes.m_max, constantDataSize);
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGDataDirtyRanges_MergeInputs_OnlyMarkedInputsAreDirty)
+    {
+        RHI::DeviceShaderResourceGroupData::DirtyRanges dirtyRanges;
+        EXPECT_TRUE(dirtyRanges.IsImageInputDirty(3));
+        EXPECT_TRUE(dirtyRanges.IsBufferInputDirty(3));
+
+        RHI::DeviceShaderResourceGroupData::DirtyRanges otherRanges;
+        otherRanges.MarkImageInput(1);
+        otherRanges.MarkBufferInput(100);
+        dirtyRanges.MarkImageInput(2);
+        dirtyRanges.Merge(otherRanges);
+
+        EXPECT_TRUE(dirtyRanges.IsImageInputDirty(1));
+        EXPECT_TRUE(dirtyRanges.IsImageInputDirty(2));
+        EXPECT_FALSE(dirtyRanges.IsImageInputDirty(3));
+        EXPECT_FALSE(dirtyRanges.IsBufferInputDirty(0));
+        // Inputs past the end of the mask share the last bit
+        EXPECT_TRUE(dirtyRanges.IsBufferInputDirty(64));
+
+        dirtyRanges.Reset();
+        dirtyRanges.MarkAll();
+        EXPECT_TRUE(dirtyRanges.IsImageInputDirty(3));
+        EXPECT_EQ(dirtyRanges.GetConstantBytes(256).m_max, 256u);
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+
+#include <Atom/RHI/AliasedAttachmentAllocator.h>
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/Scope.h>
+#include <Atom/RHI/TransientAttachmentPlacement.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace TransientAttachmentPlacementTestUtils
+    {
+        RHI::TransientAttachmentLifetime CreateLifetime(const char* name, size_t sizeInBytes, size_t scopeIndexMin, size_t scopeIndexMax)
+        {
+            RHI::TransientAttachmentLifetime lifetime;
+            lifetime.m_id = RHI::AttachmentId(name);
+            lifetime.m_sizeInBytes = sizeInBytes;
+            lifetime.m_scopeIndexMin = scopeIndexMin;
+            lifetime.m_scopeIndexMax = scopeIndexMax;
+            return lifetime;
+        }
+
+        //! Lifetimes of a frame graph with many short lived attachments of mixed sizes, in activation order like the heap records them.
+        AZStd::vector<RHI::TransientAttachmentLifetime> BuildFrameGraphLifetimes(size_t attachmentCount, size_t scopeCount, uint32_t seed)
+        {
+            SimpleLcgRandom random(seed);
+            AZStd::vector<RHI::TransientAttachmentLifetime> lifetimes;
+            for (size_t index = 0; index < attachmentCount; ++index)
+            {
+                const size_t scopeIndexMin = random.GetRandom() % scopeCount;
+                const size_t scopeIndexMax = AZStd::min(scopeCount - 1, scopeIndexMin + random.GetRandom() % 8);
+                const size_t sizeInBytes = (random.GetRandom() % 64 + 1) * 64 * 1024;
+                lifetimes.push_back(CreateLifetime(
+                    AZStd::string::format("Attachment%zu", index).c_str(), sizeInBytes, scopeIndexMin, scopeIndexMax));
+                lifetimes.back().m_alignmentInBytes = (random.GetRandom() % 2) ? 64 * 1024 : 256;
+            }
+            AZStd::stable_sort(lifetimes.begin(), lifetimes.end(), [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.m_scopeIndexMin < rhs.m_scopeIndexMin;
+                });
+            return lifetimes;
+        }
+
+        //! Heap size the first-fit allocator of AliasedHeap reaches when the attachments are activated in order.
+        size_t GetFirstFitHeapSize(const AZStd::vector<RHI::TransientAttachmentLifetime>& lifetimes)
+        {
+            AZStd::vector<size_t> offsets(lifetimes.size());
+            size_t heapSize = 0;
+            for (size_t index = 0; index < lifetimes.size(); ++index)
+            {
+                size_t offset = 0;
+                bool moved = true;
+                while (moved)
+                {
+                    moved = false;
+                    offset = RHI::AlignUpNPOT(offset, lifetimes[index].m_alignmentInBytes);
+                    for (size_t activeIndex = 0; activeIndex < index; ++activeIndex)
+                    {
+                        const bool isActive = lifetimes[activeIndex].m_scopeIndexMax >= lifetimes[index].m_scopeIndexMin;
+                        const size_t activeEnd = offsets[activeIndex] + lifetimes[activeIndex].m_sizeInBytes;
+                        if (isActive && offsets[activeIndex] < offset + lifetimes[index].m_sizeInBytes && offset < activeEnd)
+                        {
+                            offset = activeEnd;
+                            moved = true;
+                        }
+                    }
+                }
+                offsets[index] = offset;
+                heapSize = AZStd::max(heapSize, offset + lifetimes[index].m_sizeInBytes);
+            }
+            return heapSize;
+        }
+    }
+
+    class TransientAttachmentPlacementTests
+        : public RHITestFixture
+    {
+    };
+
+    TEST_F(TransientAttachmentPlacementTests, Solve_DisjointLifetimes_AliasAtOffsetZero)
+    {
+        using namespace TransientAttachmentPlacementTestUtils;
+        const AZStd::vector<RHI::TransientAttachmentLifetime> lifetimes = {
+            CreateLifetime("A", 1024, 0, 1), CreateLifetime("B", 4096, 2, 2), CreateLifetime("C", 2048, 3, 5)
+        };
+
+        const RHI::TransientAttachmentPlacement placement = RHI::TransientAttachmentPlacementSolver::Solve(lifetimes);
+        EXPECT_TRUE(RHI::TransientAttachmentPlacementSolver::IsValid(lifetimes, placement));
+        EXPECT_EQ(placement.m_heapOffsets, AZStd::vector<size_t>({ 0, 0, 0 }));
+        EXPECT_EQ(placement.m_heapSizeInBytes, 4096u);
+        EXPECT_EQ(RHI::TransientAttachmentPlacementSolver::ComputePeakMemory(lifetimes), 4096u);
+    }
+
+    TEST_F(TransientAttachmentPlacementTests, Solve_FirstFitFragments_ReachesPeakMemory)
+    {
+        using namespace TransientAttachmentPlacementTestUtils;
+        // First-fit places C above B, since A only frees a gap that is too small for it.
+        const AZStd::vector<RHI::TransientAttachmentLifetime> lifetimes = {
+            CreateLifetime("A", 4, 0, 0), CreateLifetime("B", 4, 0, 2), CreateLifetime("C", 8, 1, 2)
+        };
+        EXPECT_EQ(GetFirstFitHeapSize(lifetimes), 16u);
+
+        const RHI::TransientAttachmentPlacement placement = RHI::TransientAttachmentPlacementSolver::Solve(lifetimes);
+        EXPECT_TRUE(RHI::TransientAttachmentPlacementSolver::IsValid(lifetimes, placement));
+        EXPECT_EQ(placement.m_heapSizeInBytes, 12u);
+        EXPECT_EQ(RHI::TransientAttachmentPlacementSolver::ComputePeakMemory(lifetimes), 12u);
+    }
+
+    TEST_F(TransientAttachmentPlacementTests, Solve_RecordedFrameGraphs_ValidAndNotLargerThanFirstFit)
+    {
+        using namespace TransientAttachmentPlacementTestUtils;
+        for (uint32_t seed = 1; seed <= 10; ++seed)
+        {
+            const AZStd::vector<RHI::TransientAttachmentLifetime> lifetimes = BuildFrameGraphLifetimes(150, 60, seed);
+
+            const RHI::TransientAttachmentPlacement placement = RHI::TransientAttachmentPlacementSolver::Solve(lifetimes);
+            EXPECT_TRUE(RHI::TransientAttachmentPlacementSolver::IsValid(lifetimes, placement)) << "seed " << seed;
+            EXPECT_GE(placement.m_heapSizeInBytes, RHI::TransientAttachmentPlacementSolver::ComputePeakMemory(lifetimes)) << "seed " << seed;
+            EXPECT_LE(placement.m_heapSizeInBytes, GetFirstFitHeapSize(lifetimes)) << "seed " << seed;
+        }
+    }
+
+    TEST_F(TransientAttachmentPlacementTests, IsValid_OverlappingOrUnalignedPlacement_ReturnsFalse)
+    {
+        using namespace TransientAttachmentPlacementTestUtils;
+        AZStd::vector<RHI::TransientAttachmentLifetime> lifetimes = { CreateLifetime("A", 256, 0, 1), CreateLifetime("B", 256, 1, 2) };
+
+        RHI::TransientAttachmentPlacement placement;
+        placement.m_heapOffsets = { 0, 128 };
+        placement.m_heapSizeInBytes = 384;
+        EXPECT_FALSE(RHI::TransientAttachmentPlacementSolver::IsValid(lifetimes, placement));
+
+        placement.m_heapOffsets = { 0, 256 };
+        placement.m_heapSizeInBytes = 512;
+        EXPECT_TRUE(RHI::TransientAttachmentPlacementSolver::IsValid(lifetimes, placement));
+
+        lifetimes[1].m_alignmentInBytes = 512;
+        EXPECT_FALSE(RHI::TransientAttachmentPlacementSolver::IsValid(lifetimes, placement));
+    }
+
+    TEST_F(TransientAttachmentPlacementTests, CreateReport_RecordedHeapStatistics_ReportsPeakAndFragmentation)
+    {
+        // Statistics as AliasedHeap records them for the first-fit placement of Solve_FirstFitFragments_ReachesPeakMemory.
+        RHI::TransientAttachmentStatistics::Heap heapStatistics;
+        heapStatistics.m_watermarkSize = 16;
+        const struct
+        {
+            const char* m_name;
+            size_t m_heapOffset;
+            size_t m_sizeInBytes;
+            size_t m_scopeIndexMin;
+            size_t m_scopeIndexMax;
+        } recordedAttachments[] = { { "A", 0, 4, 0, 0 }, { "B", 4, 4, 0, 2 }, { "C", 8, 8, 1, 2 } };
+        for (const auto& recordedAttachment : recordedAttachments)
+        {
+            RHI::TransientAttachmentStatistics::Attachment& attachment = heapStatistics.m_attachments.emplace_back();
+            attachment.m_id = RHI::AttachmentId(recordedAttachment.m_name);
+            attachment.m_heapOffsetMin = recordedAttachment.m_heapOffset;
+            attachment.m_heapOffsetMax = recordedAttachment.m_heapOffset + recordedAttachment.m_sizeInBytes - 1;
+            attachment.m_sizeInBytes = recordedAttachment.m_sizeInBytes;
+            attachment.m_scopeOffsetMin = recordedAttachment.m_scopeIndexMin;
+            attachment.m_scopeOffsetMax = recordedAttachment.m_scopeIndexMax;
+        }
+
+        const RHI::TransientAttachmentPlacementReport report = RHI::TransientAttachmentPlacementSolver::CreateReport(heapStatistics, 4);
+        EXPECT_EQ(report.m_peakMemoryInBytes, 12u);
+        EXPECT_EQ(report.m_heapSizeInBytes, 16u);
+        EXPECT_EQ(report.m_solvedHeapSizeInBytes, 12u);
+        EXPECT_FLOAT_EQ(report.m_fragmentation, 0.25f);
+    }
+
+    TEST_F(TransientAttachmentPlacementTests, Cache_SameTopology_ReusesPlacementAndEvictsLeastRecentlyUsed)
+    {
+        using namespace TransientAttachmentPlacementTestUtils;
+        const AZStd::vector<RHI::TransientAttachmentLifetime> frameA = BuildFrameGraphLifetimes(20, 10, 1);
+        const AZStd::vector<RHI::TransientAttachmentLifetime> frameB = BuildFrameGraphLifetimes(20, 10, 2);
+        AZStd::vector<RHI::TransientAttachmentLifetime> frameC = frameA;
+        frameC.back().m_scopeIndexMax += 1;
+        EXPECT_NE(RHI::TransientAttachmentPlacementSolver::ComputeTopologyHash(frameA), RHI::TransientAttachmentPlacementSolver::ComputeTopologyHash(frameC));
+
+        RHI::TransientAttachmentPlacementCache cache(2);
+        const RHI::TransientAttachmentPlacement* placementA = &cache.FindOrSolve(frameA);
+        EXPECT_EQ(placementA->m_heapOffsets, RHI::TransientAttachmentPlacementSolver::Solve(frameA).m_heapOffsets);
+        EXPECT_EQ(&cache.FindOrSolve(frameA), placementA);
+        EXPECT_EQ(cache.GetEntryCount(), 1u);
+
+        cache.FindOrSolve(frameB);
+        cache.FindOrSolve(frameA);
+        EXPECT_EQ(cache.GetEntryCount(), 2u);
+
+        // Frame B is the least recently used topology, so frame C replaces it and frame A keeps its entry.
+        cache.FindOrSolve(frameC);
+        EXPECT_EQ(cache.GetEntryCount(), 2u);
+        EXPECT_EQ(&cache.FindOrSolve(frameA), placementA);
+
+        cache.Clear();
+        EXPECT_EQ(cache.GetEntryCount(), 0u);
+    }
+
+    //! Aliased heap that doesn't allocate any memory, like the one of the Null RHI.
+    class TestAliasedHeap final
+        : public RHI::AliasedHeap
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestAliasedHeap, SystemAllocator);
+        AZ_RTTI(TestAliasedHeap, "{6F0B27A5-9C7E-4B0B-8E50-3E5C4F1B7A21}", RHI::AliasedHeap);
+
+        using Descriptor = RHI::AliasedHeapDescriptor;
+
+        static RHI::Ptr<TestAliasedHeap> Create()
+        {
+            return aznew TestAliasedHeap();
+        }
+
+    private:
+        TestAliasedHeap() = default;
+
+        AZStd::unique_ptr<RHI::AliasingBarrierTracker> CreateBarrierTrackerInternal() override { return AZStd::make_unique<RHI::Internal::NoBarrierAliasingBarrierTracker>(); }
+        RHI::ResultCode InitInternal([[maybe_unused]] RHI::Device& device, [[maybe_unused]] const RHI::AliasedHeapDescriptor& descriptor) override { return RHI::ResultCode::Success; }
+        RHI::ResultCode InitImageInternal([[maybe_unused]] const RHI::DeviceImageInitRequest& request, [[maybe_unused]] size_t heapOffset) override { return RHI::ResultCode::Success; }
+        RHI::ResultCode InitBufferInternal([[maybe_unused]] const RHI::DeviceBufferInitRequest& request, [[maybe_unused]] size_t heapOffset) override { return RHI::ResultCode::Success; }
+    };
+
+    class AliasedHeapPlacementTests
+        : public RHITestFixture
+    {
+    public:
+        static constexpr size_t MegaByte = 1024 * 1024;
+        static constexpr uint32_t ScopeCount = 2;
+
+        struct FrameBuffer
+        {
+            const char* m_name = nullptr;
+            size_t m_sizeInBytes = 0;
+            uint32_t m_scopeIndexMin = 0;
+            uint32_t m_scopeIndexMax = 0;
+        };
+
+        void SetUp() override
+        {
+            RHITestFixture::SetUp();
+            m_factory.reset(aznew Factory());
+            m_device = MakeTestDevice();
+
+            for (uint32_t scopeIndex = 0; scopeIndex < ScopeCount; ++scopeIndex)
+            {
+                m_scopes.push_back(RHI::Factory::Get().CreateScope());
+                m_scopes.back()->Init(RHI::ScopeId(AZStd::string::format("Scope%u", scopeIndex)));
+            }
+        }
+
+        void TearDown() override
+        {
+            if (m_allocator)
+            {
+                m_allocator->Shutdown();
+                m_allocator = nullptr;
+            }
+            for (RHI::Ptr<RHI::Scope>& scope : m_scopes)
+            {
+                scope->Shutdown();
+            }
+            m_scopes.clear();
+            m_device = nullptr;
+            m_factory.reset();
+            RHITestFixture::TearDown();
+        }
+
+        //! Creates an allocator that never grows past a single heap of the budget, like the Fixed strategy of the transient attachment pool.
+        void InitFixedAllocator(size_t budgetInBytes)
+        {
+            RHI::AliasedAttachmentAllocator<TestAliasedHeap>::Descriptor descriptor;
+            descriptor.m_budgetInBytes = budgetInBytes;
+            descriptor.m_alignment = 64 * 1024;
+            descriptor.m_allocationParameters = RHI::HeapAllocationParameters();
+
+            m_allocator = RHI::AliasedAttachmentAllocator<TestAliasedHeap>::Create();
+            m_allocator->SetName(Name("TestAliasedAllocator"));
+            EXPECT_EQ(m_allocator->Init(*m_device, descriptor), RHI::ResultCode::Success);
+        }
+
+        //! Activates and deactivates the buffers of a frame scope by scope in the order the frame graph compiler uses,
+        //! and returns the statistics of the heap.
+        RHI::TransientAttachmentStatistics::Heap CompileFrame(const AZStd::vector<FrameBuffer>& buffers)
+        {
+            m_allocator->Begin(RHI::TransientAttachmentPoolCompileFlags::None);
+            for (uint32_t scopeIndex = 0; scopeIndex < ScopeCount; ++scopeIndex)
+            {
+                RHI::Scope& scope = *m_scopes[scopeIndex];
+                scope.Activate(nullptr, scopeIndex, RHI::GraphGroupId(), RHI::Scope::ActivationFlags::None);
+
+                for (const FrameBuffer& buffer : buffers)
+                {
+                    if (buffer.m_scopeIndexMin == scopeIndex)
+                    {
+                        RHI::TransientBufferDescriptor descriptor;
+                        descriptor.m_attachmentId = RHI::AttachmentId(buffer.m_name);
+                        descriptor.m_bufferDescriptor.m_byteCount = buffer.m_sizeInBytes;
+                        descriptor.m_bufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite;
+                        EXPECT_NE(m_allocator->ActivateBuffer(descriptor, scope), nullptr) << buffer.m_name;
+                    }
+                }
+
+                for (const FrameBuffer& buffer : buffers)
+                {
+                    if (buffer.m_scopeIndexMax == scopeIndex)
+                    {
+                        m_allocator->DeactivateBuffer(RHI::AttachmentId(buffer.m_name), scope);
+                    }
+                }
+            }
+            m_allocator->End();
+
+            for (RHI::Ptr<RHI::Scope>& scope : m_scopes)
+            {
+                scope->Deactivate();
+            }
+
+            AZStd::vector<RHI::TransientAttachmentStatistics::Heap> heapStatistics;
+            m_allocator->GetStatistics(heapStatistics);
+            EXPECT_EQ(heapStatistics.size(), 1u);
+            return heapStatistics.empty() ? RHI::TransientAttachmentStatistics::Heap() : heapStatistics.front();
+        }
+
+        //! Returns true if no attachments that are alive at the same time share any byte of the heap.
+        static bool IsValidPlacement(const RHI::TransientAttachmentStatistics::Heap& heapStatistics)
+        {
+            RHI::TransientAttachmentPlacement placement;
+            placement.m_heapSizeInBytes = heapStatistics.m_watermarkSize;
+            for (const RHI::TransientAttachmentStatistics::Attachment& attachment : heapStatistics.m_attachments)
+            {
+                placement.m_heapOffsets.push_back(attachment.m_heapOffsetMin);
+            }
+            return RHI::TransientAttachmentPlacementSolver::IsValid(
+                RHI::TransientAttachmentPlacementSolver::GetLifetimes(heapStatistics, 1), placement);
+        }
+
+    private:
+        AZStd::unique_ptr<Factory> m_factory;
+        RHI::Ptr<RHI::Device> m_device;
+        AZStd::vector<RHI::Ptr<RHI::Scope>> m_scopes;
+        RHI::Ptr<RHI::AliasedAttachmentAllocator<TestAliasedHeap>> m_allocator;
+    };
+
+    TEST_F(AliasedHeapPlacementTests, FixedHeap_TopologyChanges_AttachmentsThatDontMatchThePlanStillFit)
+    {
+        InitFixedAllocator(4 * MegaByte);
+
+        // The first frame fills the heap, so its plan reserves the whole heap in the next frame.
+        RHI::TransientAttachmentStatistics::Heap heapStatistics = CompileFrame({ { "A", 2 * MegaByte, 0, 1 }, { "B", 2 * MegaByte, 0, 1 } });
+        EXPECT_TRUE(IsValidPlacement(heapStatistics));
+
+        // A resize changes the size of A and replaces B, nothing matches the plan.
+        const AZStd::vector<FrameBuffer> resizedFrame = { { "A", 1 * MegaByte, 0, 1 }, { "C", 3 * MegaByte, 0, 1 } };
+        heapStatistics = CompileFrame(resizedFrame);
+        EXPECT_EQ(heapStatistics.m_attachments.size(), 2u);
+        EXPECT_TRUE(IsValidPlacement(heapStatistics));
+        EXPECT_LE(heapStatistics.m_watermarkSize, 4 * MegaByte);
+
+        // The same topology uses the plan of the previous frame.
+        heapStatistics = CompileFrame(resizedFrame);
+        EXPECT_EQ(heapStatistics.m_attachments.size(), 2u);
+        EXPECT_TRUE(IsValidPlacement(heapStatistics));
+
+        // A still matches the plan when D is added, so A keeps its planned offset while D uses the rest of the heap.
+        heapStatistics = CompileFrame({ { "A", 1 * MegaByte, 0, 1 }, { "D", 2 * MegaByte, 1, 1 } });
+        EXPECT_EQ(heapStatistics.m_attachments.size(), 2u);
+        EXPECT_TRUE(IsValidPlacement(heapStatistics));
+        EXPECT_LE(heapStatistics.m_watermarkSize, 4 * MegaByte);
+
+        heapStatistics = CompileFrame({ { "A", 1 * MegaByte, 0, 1 }, { "D", 2 * MegaByte, 1, 1 } });
+        EXPECT_EQ(heapStatistics.m_attachments.size(), 2u);
+        EXPECT_TRUE(IsValidPlacement(heapStatistics));
+    }
+}
@@ -264,6 +264,8 @@ set(FILES
     Include/Atom/RHI/TransientAttachmentPool.h
     Source/RHI/DeviceTransientAttachmentPool.cpp
     Source/RHI/TransientAttachmentPool.cpp
+    Include/Atom/RHI/TransientAttachmentPlacement.h
+    Source/RHI/TransientAttachmentPlacement.cpp
     Include/Atom/RHI/RHIUtils.h
     Source/RHI/RHIUtils.cpp
     Include/Atom/RHI/DeviceRayTracingAccelerationStructure.h
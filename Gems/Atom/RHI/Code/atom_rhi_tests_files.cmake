@@ -10,6 +10,7 @@ set(FILES
     Tests/RHITestFixture.h
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
+    Tests/DrawListSortTests.cpp
     Tests/DrawPacketTests.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
@@ -47,6 +48,7 @@ set(FILES
     Tests/TagRegistryTests.cpp
     Tests/TransientAttachmentPool.h
     Tests/TransientAttachmentPool.cpp
+    Tests/TransientAttachmentPlacementTests.cpp
     Tests/ThreadTester.h
     Tests/ThreadTester.cpp
     Tests/ImagePropertyTests.cpp
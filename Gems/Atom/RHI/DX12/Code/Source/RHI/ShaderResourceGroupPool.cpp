@@ -210,7 +210,15 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // Only the bytes written since this copy of the constant buffer was last filled need to be copied
+                const RHI::Interval constantBytes = groupBase.GetCompileDirtyRanges().GetConstantBytes(static_cast<uint32_t>(groupData.GetConstantData().size()));
+                if (constantBytes.m_max > constantBytes.m_min)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + constantBytes.m_min,
+                        groupData.GetConstantData().data() + constantBytes.m_min,
+                        constantBytes.m_max - constantBytes.m_min);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
@@ -276,6 +284,7 @@ namespace AZ
         {
             typedef AZ::RHI::DeviceShaderResourceGroupData::ResourceTypeMask ResourceMask;
             const RHI::ShaderResourceGroupLayout& groupLayout = *groupData.GetLayout();
+            const RHI::DeviceShaderResourceGroupData::DirtyRanges& dirtyRanges = group.GetCompileDirtyRanges();
             uint32_t shaderInputIndex = 0;
             
             if (forceUpdateViews || group.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::BufferViewMask)))
@@ -283,6 +292,12 @@ namespace AZ
                 for (const RHI::ShaderInputBufferDescriptor& shaderInputBuffer : groupLayout.GetShaderInputListForBuffers())
                 {
                     const RHI::ShaderInputBufferIndex bufferInputIndex(shaderInputIndex);
+                    if (!forceUpdateViews && !dirtyRanges.IsBufferInputDirty(shaderInputIndex))
+                    {
+                        // The descriptors in this copy of the table are still current
+                        ++shaderInputIndex;
+                        continue;
+                    }
 
                     AZStd::span<const RHI::ConstPtr<RHI::DeviceBufferView>> bufferViews = groupData.GetBufferViewArray(bufferInputIndex);
                     D3D12_DESCRIPTOR_RANGE_TYPE descriptorRangeType = ConvertShaderInputBufferAccess(shaderInputBuffer.m_access);
@@ -322,6 +337,11 @@ namespace AZ
                 for (const RHI::ShaderInputImageDescriptor& shaderInputImage : groupLayout.GetShaderInputListForImages())
                 {
                     const RHI::ShaderInputImageIndex imageInputIndex(shaderInputIndex);
+                    if (!forceUpdateViews && !dirtyRanges.IsImageInputDirty(shaderInputIndex))
+                    {
+                        ++shaderInputIndex;
+                        continue;
+                    }
 
                     AZStd::span<const RHI::ConstPtr<RHI::DeviceImageView>> imageViews = groupData.GetImageViewArray(imageInputIndex);
                     D3D12_DESCRIPTOR_RANGE_TYPE descriptorRangeType = ConvertShaderInputImageAccess(shaderInputImage.m_access);
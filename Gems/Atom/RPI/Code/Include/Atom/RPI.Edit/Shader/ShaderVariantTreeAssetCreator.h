@@ -53,6 +53,8 @@ namespace AZ
 
             bool EndInternal(Data::Asset<ShaderVariantTreeAsset>& result);
             bool BuildTree(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId);
+            //! Builds the perfect hash used by ShaderVariantTreeAsset::FindExactVariantStableId(). The asset stays valid without it.
+            void BuildFlatLookup(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId);
 
             const RPI::ShaderOptionGroupLayout* m_shaderOptionGroupLayout;
             AZStd::vector<ShaderVariantListSourceData::VariantInfo> m_variantInfos;
@@ -281,6 +281,16 @@ namespace AZ
             //! Will create child task graphs that signal the TaskGraphEvent to do the processing in parallel.
             void ProcessCullablesTG(const Scene& scene, View& view, AZ::TaskGraph& taskGraph, AZ::TaskGraphEvent& processCullablesTGEvent);
 
+            //! Performs render culling and lod selection for several Views with a single traversal of the visibility scene.
+            //! Each node and entry is tested against all view frustums at once, producing per view visibility masks that are then used
+            //! to add the visible renderpackets to each View. This replaces calling ProcessCullables() once per view.
+            //! Must be called between BeginCulling() and EndCulling(), requires either a valid parent job or a valid task graph.
+            void ProcessCullablesMultiView(
+                const Scene& scene, AZStd::span<const ViewPtr> views, AZ::Job* parentJob, AZ::TaskGraph* taskGraph = nullptr, AZ::TaskGraphEvent* processCullablesTGEvent = nullptr);
+
+            //! Returns true if views should be culled together using ProcessCullablesMultiView(), controlled by the r_useMultiViewCulling CVAR.
+            bool IsMultiViewCullingEnabled() const;
+
             //! Adds a Cullable to the underlying visibility system(s).
             //! Must be called at least once on initialization and whenever a Cullable's position or bounds is changed.
             //! Is not thread-safe, so call this from the main thread outside of Begin/EndCulling()
@@ -57,6 +57,9 @@ namespace AZ
             struct SimulatePacket
             {
                 AZ::Job* m_parentJob = nullptr;
+
+                //! True when Simulate is running inside a TaskGraph task. TaskGraphEvent::Wait() can't be used from there.
+                bool m_isTaskGraphWorker = false;
             };
             
             struct RenderPacket
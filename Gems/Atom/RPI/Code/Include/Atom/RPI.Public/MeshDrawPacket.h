@@ -17,6 +17,7 @@
 
 #include <AzCore/Math/Obb.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
 
 // Enable this define to print the shader variants used by MeshDrawPacket every time the draw packet get rebuilt.
 // Note: the log can be extremely long if there are too many mesh instances (for example, >5K).  
@@ -49,6 +50,44 @@ namespace AZ
 
             using ShaderList = AZStd::vector<ShaderData>;
 
+            //! The parts of the draw packet that only depend on the mesh, the material and the draw packet settings, and not on the
+            //! object SRG. When r_meshDrawPacketCache is enabled, MeshDrawPackets with identical settings share one instance through the
+            //! scene's MeshDrawPacketCache, so instances of the same mesh don't each select shader variants, acquire pipeline states and
+            //! create draw SRGs. Otherwise each MeshDrawPacket builds its own.
+            struct SharedData
+                : public AZStd::intrusive_base
+            {
+                AZ_CLASS_ALLOCATOR(SharedData, SystemAllocator);
+
+                struct DrawItem
+                {
+                    RHI::DrawListTag m_listTag;
+                    const RHI::PipelineState* m_pipelineState = nullptr;
+                    RHI::StreamBufferIndices m_streamIndices;
+                    RHI::DrawFilterMask m_drawFilterMask = RHI::DrawFilterMaskDefaultValue;
+                    bool m_isRasterShader = true;
+                    // Shared by every MeshDrawPacket that uses this data. It only holds per mesh and per variant constants.
+                    Data::Instance<ShaderResourceGroup> m_drawSrg;
+                };
+
+                AZStd::fixed_vector<DrawItem, RHI::DrawPacketBuilder::DrawItemCountMax> m_drawItems;
+
+                // Maintains references to the shader instances to keep their PSO caches resident (see Shader::Shutdown())
+                ShaderList m_activeShaders;
+
+                RHI::ConstPtr<RHI::ConstantsLayout> m_rootConstantsLayout;
+
+                // The cache identifies the data by the addresses of these, so they are kept alive as long as the data is
+                Data::Instance<ModelLod> m_modelLod;
+                Data::Instance<Material> m_material;
+
+#ifdef DEBUG_MESH_SHADERVARIANTS
+                // For debug shader variants
+                // The list of shader variant asset names used by the DrawPackets
+                AZStd::vector<AZStd::string_view> m_shaderVariantNames;
+#endif
+            };
+
             MeshDrawPacket() = default;
             MeshDrawPacket(
                 ModelLod& modelLod,
@@ -83,7 +122,7 @@ namespace AZ
 
             Data::Instance<Material> GetMaterial() const;
             const ModelLod::Mesh& GetMesh() const;
-            const ShaderList& GetActiveShaderList() const { return m_activeShaders; }
+            const ShaderList& GetActiveShaderList() const;
 
             void DebugOutputShaderVariants();
 
@@ -92,6 +131,8 @@ namespace AZ
 
         private:
             bool DoUpdate(const Scene& parentScene);
+            Ptr<SharedData> BuildSharedData(const Scene& parentScene) const;
+            bool IsSharedDataUpToDate(const SharedData& sharedData) const;
             void ForValidShaderOptionName(const Name& shaderOptionName, const AZStd::function<bool(const ShaderCollection::Item&, ShaderOptionIndex)>& callback);
 
             Ptr<RHI::DrawPacket> m_drawPacket;
@@ -99,8 +140,8 @@ namespace AZ
             // Note, many of the following items are held locally in the MeshDrawPacket solely to keep them resident in memory as long as they are needed
             // for the m_drawPacket. RHI::DrawPacket uses raw pointers only, but we use smart pointers here to hold on to the data.
 
-            // Maintains references to the shader instances to keep their PSO caches resident (see Shader::Shutdown())
-            ShaderList m_activeShaders;
+            // The shared data m_drawPacket was built from, which holds the shaders, pipeline states and draw SRGs
+            Ptr<SharedData> m_sharedData;
 
             RHI::ConstPtr<RHI::ConstantsLayout> m_rootConstantsLayout;
 
@@ -148,11 +189,6 @@ namespace AZ
             //! A flag to indicate if the DrawPacket need to be rebuild when updating
             bool m_needUpdate = true;
 
-#ifdef DEBUG_MESH_SHADERVARIANTS
-            // For debug shader variants
-            // The list of shader variant asset names used by the DrawPackets
-            AZStd::vector<AZStd::string_view> m_shaderVariantNames;
-#endif
         };
         
         using MeshDrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
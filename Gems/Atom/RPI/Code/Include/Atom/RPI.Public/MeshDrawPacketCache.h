@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Public/MeshDrawPacket.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Everything MeshDrawPacket::SharedData is built from. Two MeshDrawPackets with equal keys build identical shared data.
+        struct ATOM_RPI_PUBLIC_API MeshDrawPacketCacheKey
+        {
+            bool operator==(const MeshDrawPacketCacheKey& other) const;
+            size_t GetHash() const;
+
+            const ModelLod* m_modelLod = nullptr;
+            size_t m_modelLodMeshIndex = 0;
+            const Material* m_material = nullptr;
+            Material::ChangeId m_materialChangeId = Material::DEFAULT_CHANGE_ID;
+            AZStd::vector<AZStd::pair<Name, ShaderOptionValue>> m_shaderOptions;
+            MaterialModelUvOverrideMap m_materialModelUvMap;
+            RHI::DrawListMask m_drawListFilter;
+            RHI::DrawItemSortKey m_sortKey = 0;
+            uint8_t m_stencilRef = 0;
+            bool m_forceRootShaderVariant = false;
+        };
+
+        //! Content addressed cache of MeshDrawPacket::SharedData, owned by the Scene since the data depends on the scene's
+        //! pipeline states. Many instances of the same mesh with the same material share one set of draw items and draw SRGs,
+        //! and only build their own RHI::DrawPacket around them with their object SRG.
+        //! All functions are thread safe, MeshDrawPackets are updated in parallel.
+        class ATOM_RPI_PUBLIC_API MeshDrawPacketCache
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(MeshDrawPacketCache, SystemAllocator);
+
+            //! Returns the shared data for the key, or null if there is none.
+            Ptr<MeshDrawPacket::SharedData> Find(const MeshDrawPacketCacheKey& key) const;
+
+            //! Stores the shared data for the key, replacing any previous data.
+            void Insert(MeshDrawPacketCacheKey key, Ptr<MeshDrawPacket::SharedData> sharedData);
+
+            //! Releases the shared data that no MeshDrawPacket uses anymore.
+            void RemoveUnused();
+
+            //! Releases all shared data. MeshDrawPackets that still use it keep it alive until they are rebuilt.
+            void Clear();
+
+            size_t GetEntryCount() const;
+
+        private:
+            struct KeyHasher
+            {
+                size_t operator()(const MeshDrawPacketCacheKey& key) const
+                {
+                    return key.GetHash();
+                }
+            };
+
+            mutable AZStd::shared_mutex m_mutex;
+            AZStd::unordered_map<MeshDrawPacketCacheKey, Ptr<MeshDrawPacket::SharedData>, KeyHasher> m_entries;
+        };
+    } // namespace RPI
+} // namespace AZ
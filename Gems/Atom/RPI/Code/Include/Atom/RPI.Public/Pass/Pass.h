@@ -418,6 +418,13 @@ namespace AZ
             void FrameBegin(FramePrepareParams params);
             virtual void FrameBeginInternal([[maybe_unused]] FramePrepareParams params) { }
 
+            // Called every frame by the PassSystem on a worker thread, before FrameBegin, for passes that are going to render.
+            // Passes are processed concurrently, so the implementation may only touch the pass's own data (for example to build
+            // and sort its draw list). It must not use the FrameGraphBuilder, the attachment database or the pass system statistics,
+            // these stay in FrameBegin which runs serially in tree order so the scopes are always imported in the same order.
+            void FrameBeginParallel();
+            virtual void FrameBeginParallelInternal() { }
+
             // Called every frame after the frame has been rendered. Allows the pass
             // to perform any post-frame cleanup, such as resetting per-frame state.            
             void FrameEnd();
@@ -539,6 +546,9 @@ namespace AZ
 
                         // Whether the pass was enabled last frame
                         uint64_t m_lastFrameEnabled : 1;
+
+                        // Whether FrameBeginParallel already ran for this pass in the current frame
+                        uint64_t m_frameBeginParallelDone : 1;
                     };
                     uint64_t m_allFlags = 0;
                 };
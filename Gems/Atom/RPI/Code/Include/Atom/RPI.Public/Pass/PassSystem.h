@@ -19,6 +19,8 @@
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 
+#include <AzCore/Console/IConsole.h>
+
 #include <AzFramework/Windowing/WindowBus.h>
 
 namespace AZ
@@ -30,6 +32,9 @@ namespace AZ
 
     namespace RPI
     {
+        //! When enabled, FrameUpdate runs Pass::FrameBeginParallel on worker threads before the serial FrameBegin
+        AZ_CVAR_API_EXTERNED(ATOM_RPI_PUBLIC_API, bool, r_passSystemParallelFrameBegin);
+
         //! The central class of the pass system.
         //! Responsible for preparing the frame and keeping 
         //! track of which passes need rebuilding or deleting.
@@ -118,12 +123,22 @@ namespace AZ
             // Resets the frame statistic counters
             void ResetFrameStatistics();
 
+            // Updates the connected bindings of each pass tree and runs Pass::FrameBeginParallel for all passes
+            // that are going to render, spread over worker threads. Called by FrameUpdate before the serial FrameBegin.
+            void FrameBeginParallel();
+
+            // Appends the pass and its descendants to m_frameBeginPasses, skipping the subtrees that Pass::FrameBegin skips
+            void CollectFrameBeginPasses(Pass* pass);
+
             // List of render pipelines to be rendered by the pass system
             AZStd::vector< RenderPipeline* > m_renderPipelines;
 
             // Collection of passes that don't belong to any rendering pipeline
             PassTree m_passesWithoutPipeline;
 
+            // Passes that ran FrameBeginParallel in the current frame, in tree order
+            AZStd::vector<Pass*> m_frameBeginPasses;
+
             // Library of pass descriptors that can be instantiated through data driven pass requests
             PassLibrary m_passLibrary;
 
@@ -53,6 +53,7 @@ namespace AZ
             // Pass behavior overrides
             void Validate(PassValidationResults& validationResults) override;
             void FrameBeginInternal(FramePrepareParams params) override;
+            void FrameBeginParallelInternal() override;
             void InitializeInternal() override;
 
             // Scope producer functions...
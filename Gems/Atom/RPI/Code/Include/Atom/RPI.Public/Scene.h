@@ -52,6 +52,7 @@ namespace AZ
         class ShaderResourceGroupAsset;
         class CullingScene;
         class DynamicDrawSystem;
+        class MeshDrawPacketCache;
 
         // Callback function to modify values of a ShaderResourceGroup
         using ShaderResourceGroupCallback = AZStd::function<void(ShaderResourceGroup*)>;
@@ -169,6 +170,10 @@ namespace AZ
 
             AZ::RPI::CullingScene* GetCullingScene() const;
 
+            //! Returns the cache that lets MeshDrawPackets of identical meshes share their draw items.
+            //! It is cleared whenever the pipeline states lookup is rebuilt, since the draw items depend on it.
+            MeshDrawPacketCache& GetMeshDrawPacketCache() const;
+
             RenderPipelinePtr FindRenderPipelineForWindow(AzFramework::NativeWindowHandle windowHandle, ViewType viewType = ViewType::Default);
 
             using PrepareSceneSrgEvent = AZ::Event<RPI::ShaderResourceGroup*>;
@@ -259,6 +264,8 @@ namespace AZ
             AzFramework::IVisibilityScene* m_visibilityScene;
             AZ::RPI::CullingScene* m_cullingScene;
 
+            AZStd::unique_ptr<MeshDrawPacketCache> m_meshDrawPacketCache;
+
             // Cached views for current rendering frame. It gets re-built every frame.
             AZ::RPI::FeatureProcessor::SimulatePacket m_simulatePacket;
             AZ::RPI::FeatureProcessor::RenderPacket m_renderPacket;
@@ -10,6 +10,7 @@
 #include <Atom/RPI.Public/Configuration.h>
 #include <Atom/RPI.Public/Shader/ShaderVariant.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantSearchCache.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
@@ -213,9 +214,12 @@ namespace AZ
             //! A handle to the pipeline library in the pipeline state cache.
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
-            //! Used for thread safety for FindVariantStableId() and GetVariant().
+            //! Used for thread safety for GetVariant().
             AZStd::shared_mutex m_variantCacheMutex;
 
+            //! Results of FindVariantStableId(), so repeated searches don't lock the ShaderAsset or walk the variant tree.
+            mutable ShaderVariantSearchCache m_variantSearchCache;
+
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
 
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Configuration.h>
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A fixed size, lock-free cache of ShaderVariantSearchResults keyed by the bits of the ShaderVariantId.
+        //! Lookups never block and inserts never wait: an insert that races another write to the same slot is dropped
+        //! and the next miss inserts it again. Each entry is tagged with the variant tree generation it was searched with
+        //! (see ShaderAsset::GetVariantTreeGeneration()), so results from a replaced variant tree are never returned.
+        //! The slots are only allocated on the first insert, since most shaders never search for variants.
+        class ATOM_RPI_PUBLIC_API ShaderVariantSearchCache final
+        {
+        public:
+            static constexpr uint32_t SlotCount = 256;
+            static constexpr uint32_t MaxProbeCount = 8;
+
+            ShaderVariantSearchCache() = default;
+            ~ShaderVariantSearchCache();
+            AZ_DISABLE_COPY_MOVE(ShaderVariantSearchCache);
+
+            //! Returns the cached search result, if it was inserted with the same variant tree generation.
+            AZStd::optional<ShaderVariantSearchResult> Find(const ShaderVariantId& shaderVariantId, uint32_t variantTreeGeneration) const;
+
+            //! Caches a search result. Does nothing if no variant tree was available for this generation.
+            void Insert(const ShaderVariantId& shaderVariantId, uint32_t variantTreeGeneration, const ShaderVariantSearchResult& searchResult);
+
+            //! Invalidates all entries. Lookups that are running concurrently may still return entries inserted before the call.
+            void Clear();
+
+        private:
+            static_assert(sizeof(ShaderVariantKey::word_t) == sizeof(uint32_t), "The cache stores the ShaderVariantKey in 32 bit words");
+            static constexpr uint32_t KeyWordCount = 2 * ((ShaderVariantKeyBitCount + 31) / 32);
+            using KeyWords = AZStd::array<uint32_t, KeyWordCount>;
+
+            //! A seqlock protected entry. m_sequence is odd while the entry is being written and zero if it was never written.
+            struct Slot
+            {
+                AZStd::atomic<uint32_t> m_sequence{ 0 };
+                AZStd::atomic<uint32_t> m_epoch{ 0 };
+                AZStd::atomic<uint32_t> m_variantTreeGeneration{ 0 };
+                AZStd::atomic<uint32_t> m_stableId{ 0 };
+                AZStd::atomic<uint32_t> m_dynamicOptionCount{ 0 };
+                AZStd::array<AZStd::atomic<uint32_t>, KeyWordCount> m_keyWords = {};
+            };
+
+            //! The masked key followed by the mask, so ids that compare equal have the same words.
+            static KeyWords GetKeyWords(const ShaderVariantId& shaderVariantId);
+            static uint64_t GetHash(const KeyWords& keyWords);
+
+            Slot* GetOrCreateSlots();
+
+            AZStd::atomic<Slot*> m_slots{ nullptr };
+
+            //! Bumped by Clear(). Starts at 1 so slots that were never written do not match.
+            AZStd::atomic<uint32_t> m_epoch{ 1 };
+        };
+    } // namespace RPI
+} // namespace AZ
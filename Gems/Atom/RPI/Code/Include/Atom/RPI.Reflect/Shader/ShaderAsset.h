@@ -9,6 +9,7 @@
 
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/EBus/Event.h>
 
 #include <Atom/RPI.Public/AssetInitBus.h>
@@ -129,6 +130,11 @@ namespace AZ
             //! This function is thread safe.
             ShaderVariantSearchResult FindVariantStableId(const ShaderVariantId& shaderVariantId);
 
+            //! Changes every time the ShaderVariantTreeAsset used by FindVariantStableId() is replaced. The lowest bit is set while
+            //! a ShaderVariantTreeAsset is available, otherwise FindVariantStableId() only returns a temporary root variant result.
+            //! Callers that cache search results read this before searching and only reuse results tagged with the current value.
+            uint32_t GetVariantTreeGeneration() const;
+
             //! Returns the variant asset associated with the provided StableId.
             //! The user should call FindVariantStableId() first to get a ShaderVariantStableId from a ShaderVariantId,
             //! Or better yet, call GetVariant(ShaderVariantId) for maximum convenience.
@@ -238,6 +244,9 @@ namespace AZ
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> /*shaderVariantAsset*/, bool /*isError*/) override {};
             ///////////////////////////////////////////////////////////////////
 
+            //! Moves m_variantTreeGeneration on after m_shaderVariantTree changed. Must be called with m_variantTreeMutex exclusively locked.
+            void UpdateVariantTreeGeneration();
+
             //! A Supervariant represents a set of static shader compilation parameters.
             //! Those parameters can be predefined c-preprocessor macros or specific arguments
             //! for AZSLc.
@@ -337,6 +346,9 @@ namespace AZ
 
             bool m_shaderVariantTreeLoadWasRequested = false;
 
+            //! See GetVariantTreeGeneration(). Only written while m_variantTreeMutex is exclusively locked.
+            AZStd::atomic<uint32_t> m_variantTreeGeneration{ 0 };
+
             //! True if all supervariants are fully specialized
             bool m_isFullySpecialized = false;
         };
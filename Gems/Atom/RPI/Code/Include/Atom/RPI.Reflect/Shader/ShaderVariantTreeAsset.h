@@ -21,6 +21,7 @@ namespace AZ
         class ShaderOptionGroupLayout;
         struct ShaderVariantId;
         struct ShaderVariantTreeNode;
+        struct ShaderVariantTreeFlatEntry;
 
 
         //! The shader variant tree is a data structure to perform lookups of shader variants that have the best runtime performance on the GPU.
@@ -75,6 +76,10 @@ namespace AZ
             //! - Search the best match from those results.
             ShaderVariantSearchResult FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const;
 
+            //! Returns the variant whose ShaderVariantId is exactly the requested one, which is always the best fit the tree search would find.
+            //! This is a single perfect hash probe. Returns nullopt when no variant matches exactly, or when the asset has no flat lookup.
+            AZStd::optional<ShaderVariantSearchResult> FindExactVariantStableId(const ShaderVariantId& shaderVariantId) const;
+
         private:
 
             static constexpr uint32_t UnspecifiedIndex = std::numeric_limits<uint32_t>::max();
@@ -88,6 +93,9 @@ namespace AZ
             //! Build a list of values from the specified shader variant ID.
             static AZStd::vector<uint32_t> ConvertToValueChain(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId);
 
+            //! Hash used by the flat lookup. Bits of the key outside of the mask are ignored, like ShaderVariantId::operator== does.
+            static uint64_t HashShaderVariantId(const ShaderVariantId& shaderVariantId, uint32_t seed);
+
             //! Called by asset creators to assign the asset to a ready state.
             void SetReady();
             bool FinalizeAfterLoad();
@@ -97,6 +105,12 @@ namespace AZ
             //! .shadervariantlist file.
             AZ::u64 m_shaderHash = 0;
             AZStd::vector<ShaderVariantTreeNode> m_nodes;
+
+            //! Perfect hash (hash and displace) of the exact ShaderVariantId of every variant in the tree, built by the ShaderVariantTreeAssetCreator.
+            //! An entry is found at m_flatLookupEntries[Hash(id, m_flatLookupSeeds[Hash(id, 0) % bucketCount]) % entryCount].
+            //! Both are empty for assets that were built without it, in which case every search walks the tree.
+            AZStd::vector<uint32_t> m_flatLookupSeeds;
+            AZStd::vector<ShaderVariantTreeFlatEntry> m_flatLookupEntries;
         };
 
         class ATOM_RPI_REFLECT_API ShaderVariantTreeAssetHandler final
@@ -136,6 +150,18 @@ namespace AZ
             uint32_t m_offset;
         };
 
+        //! A slot of the flat lookup of the ShaderVariantTreeAsset. Unused slots have an empty ShaderVariantId.
+        struct ATOM_RPI_REFLECT_API ShaderVariantTreeFlatEntry final
+        {
+            AZ_TYPE_INFO(ShaderVariantTreeFlatEntry, "{6A0C4E47-3B3E-4F0B-9F0D-2C7E3B8E5D61}");
+
+            static void Reflect(ReflectContext* context);
+
+            ShaderVariantId m_shaderVariantId;
+            ShaderVariantStableId m_stableId;
+            uint32_t m_dynamicOptionCount = 0;
+        };
+
     } // namespace RPI
 
 } // namespace AZ
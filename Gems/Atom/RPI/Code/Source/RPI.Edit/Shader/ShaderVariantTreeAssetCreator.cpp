@@ -10,6 +10,10 @@
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
 namespace AZ
 {
     namespace RPI
@@ -17,6 +21,11 @@ namespace AZ
         // Arbitrary number to be reviewed that is used to constrain the range of options.
         static constexpr uint32_t MaxShaderVariantValues = 1000;
 
+        // Average number of variants per bucket of the flat lookup, and the number of seeds tried per bucket before growing the table.
+        static constexpr uint32_t FlatLookupVariantsPerBucket = 4;
+        static constexpr uint32_t FlatLookupMaxSeedAttempts = 1u << 16;
+        static constexpr uint32_t FlatLookupMaxBuildAttempts = 4;
+
         AZ::Outcome<void, AZStd::string> ShaderVariantTreeAssetCreator::ValidateStableIdsAreUnique(const AZStd::vector<ShaderVariantListSourceData::VariantInfo>& shaderVariantList)
         {
             AZStd::unordered_map<ShaderVariantStableId, uint32_t> stableIdToIndexMap;
@@ -175,7 +184,13 @@ namespace AZ
                 shaderVariantIds.push_back({optionGroup.GetShaderVariantId(), ShaderVariantStableId{variantInfo.m_stableId}});
             }
 
-            return BuildTree(shaderVariantIds);
+            if (!BuildTree(shaderVariantIds))
+            {
+                return false;
+            }
+
+            BuildFlatLookup(shaderVariantIds);
+            return true;
         }
 
         bool ShaderVariantTreeAssetCreator::BuildTree(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId)
@@ -297,5 +312,139 @@ namespace AZ
             return true;
         }
 
+        void ShaderVariantTreeAssetCreator::BuildFlatLookup(const AZStd::vector<ShaderVariantIdWithStableId>& shaderVariantIdsWithStableId)
+        {
+            const auto& options = m_shaderOptionGroupLayout->GetShaderOptions();
+            const uint32_t optionCount = aznumeric_cast<uint32_t>(options.size());
+
+            // Gather the variants after the root. When several variants share an id the tree keeps the last one, so do the same here.
+            AZStd::vector<ShaderVariantTreeFlatEntry> variants;
+            variants.reserve(shaderVariantIdsWithStableId.size());
+            for (size_t variantIndex = shaderVariantIdsWithStableId.size(); variantIndex-- > 1;)
+            {
+                const ShaderVariantId& shaderVariantId = shaderVariantIdsWithStableId[variantIndex].m_shaderVariantId;
+                if (shaderVariantId.IsEmpty())
+                {
+                    continue;
+                }
+
+                ShaderVariantTreeFlatEntry entry;
+                entry.m_shaderVariantId.m_key = shaderVariantId.m_key & shaderVariantId.m_mask;
+                entry.m_shaderVariantId.m_mask = shaderVariantId.m_mask;
+                entry.m_stableId = shaderVariantIdsWithStableId[variantIndex].m_stableId;
+
+                // Every specified option is a static branch of the best fit, the same count the tree search arrives at.
+                uint32_t specifiedOptionCount = 0;
+                for (const ShaderOptionDescriptor& option : options)
+                {
+                    if ((shaderVariantId.m_mask & option.GetBitMask()).any())
+                    {
+                        ++specifiedOptionCount;
+                    }
+                }
+                entry.m_dynamicOptionCount = optionCount - specifiedOptionCount;
+                variants.push_back(entry);
+            }
+
+            AZStd::stable_sort(variants.begin(), variants.end(),
+                [](const ShaderVariantTreeFlatEntry& left, const ShaderVariantTreeFlatEntry& right)
+                {
+                    return left.m_shaderVariantId < right.m_shaderVariantId;
+                });
+            variants.erase(AZStd::unique(variants.begin(), variants.end(),
+                [](const ShaderVariantTreeFlatEntry& left, const ShaderVariantTreeFlatEntry& right)
+                {
+                    return left.m_shaderVariantId == right.m_shaderVariantId;
+                }), variants.end());
+
+            if (variants.empty())
+            {
+                return;
+            }
+
+            // Hash and displace: variants are grouped in buckets by a first hash, then the largest buckets are placed first,
+            // each with the first seed that sends all of its variants to free entries.
+            const uint32_t variantCount = aznumeric_cast<uint32_t>(variants.size());
+            const uint32_t bucketCount = AZ::DivideAndRoundUp(variantCount, FlatLookupVariantsPerBucket);
+            AZStd::vector<AZStd::vector<uint32_t>> buckets(bucketCount);
+            for (uint32_t variantIndex = 0; variantIndex < variantCount; ++variantIndex)
+            {
+                buckets[ShaderVariantTreeAsset::HashShaderVariantId(variants[variantIndex].m_shaderVariantId, 0) % bucketCount].push_back(variantIndex);
+            }
+
+            AZStd::vector<uint32_t> bucketOrder(bucketCount);
+            for (uint32_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                bucketOrder[bucketIndex] = bucketIndex;
+            }
+            AZStd::stable_sort(bucketOrder.begin(), bucketOrder.end(),
+                [&buckets](uint32_t left, uint32_t right)
+                {
+                    return buckets[left].size() > buckets[right].size();
+                });
+
+            uint32_t entryCount = variantCount + variantCount / 4 + 1;
+            for (uint32_t buildAttempt = 0; buildAttempt < FlatLookupMaxBuildAttempts; ++buildAttempt, entryCount += entryCount / 2)
+            {
+                AZStd::vector<uint32_t> seeds(bucketCount, 0);
+                AZStd::vector<ShaderVariantTreeFlatEntry> entries(entryCount);
+                AZStd::vector<bool> isEntryUsed(entryCount, false);
+                AZStd::vector<uint32_t> bucketEntries;
+                bool allBucketsPlaced = true;
+
+                for (uint32_t bucketIndex : bucketOrder)
+                {
+                    const AZStd::vector<uint32_t>& bucket = buckets[bucketIndex];
+                    if (bucket.empty())
+                    {
+                        break;
+                    }
+
+                    bool bucketPlaced = false;
+                    for (uint32_t seed = 1; seed <= FlatLookupMaxSeedAttempts && !bucketPlaced; ++seed)
+                    {
+                        bucketEntries.clear();
+                        bucketPlaced = true;
+                        for (uint32_t variantIndex : bucket)
+                        {
+                            const uint32_t entryIndex = aznumeric_cast<uint32_t>(
+                                ShaderVariantTreeAsset::HashShaderVariantId(variants[variantIndex].m_shaderVariantId, seed) % entryCount);
+                            if (isEntryUsed[entryIndex] || AZStd::find(bucketEntries.begin(), bucketEntries.end(), entryIndex) != bucketEntries.end())
+                            {
+                                bucketPlaced = false;
+                                break;
+                            }
+                            bucketEntries.push_back(entryIndex);
+                        }
+
+                        if (bucketPlaced)
+                        {
+                            seeds[bucketIndex] = seed;
+                            for (size_t i = 0; i < bucket.size(); ++i)
+                            {
+                                isEntryUsed[bucketEntries[i]] = true;
+                                entries[bucketEntries[i]] = variants[bucket[i]];
+                            }
+                        }
+                    }
+
+                    if (!bucketPlaced)
+                    {
+                        allBucketsPlaced = false;
+                        break;
+                    }
+                }
+
+                if (allBucketsPlaced)
+                {
+                    m_asset->m_flatLookupSeeds = AZStd::move(seeds);
+                    m_asset->m_flatLookupEntries = AZStd::move(entries);
+                    return;
+                }
+            }
+
+            ReportWarning("Failed to build the flat lookup for %u shader variants. Variant searches will walk the tree.", variantCount);
+        }
+
     } // namespace RPI
 } // namespace AZ
@@ -18,9 +18,12 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Visibility/OcclusionBus.h>
@@ -57,6 +60,9 @@ namespace AZ
         // Default is set to -1 as this is optimization needs to be triggered by the content developer by setting a reasonable non-negative value applicable for their content. 
         AZ_CVAR(int, r_shadowCascadeExtrusionAmount, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of meters to extrude the Obb towards light direction when doing frustum overlap test against camera frustum");
 
+        // Multi-view culling traverses the octree once for all views instead of once per view
+        AZ_CVAR(bool, r_useMultiViewCulling, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Cull all views of a scene in a single octree traversal, testing each node and entry against every view frustum at once");
+
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -248,6 +254,59 @@ namespace AZ
             return worklistData;
         }
 
+        // Sets up the exclude frustum of a view, and the camera frustum used to reject shadow cascade nodes if applicable.
+        static void InitExcludeFrustum(const Scene& scene, const View& view, WorklistData& worklistData)
+        {
+            if (const Matrix4x4* worldToClipExclude = view.GetWorldToClipExcludeMatrix())
+            {
+                worklistData.m_hasExcludeFrustum = true;
+                worklistData.m_excludeFrustum = Frustum::CreateFromMatrixColumnMajor(*worldToClipExclude);
+
+                // Get the render pipeline associated with the shadow pass of the given view
+                RenderPipelinePtr renderPipeline = scene.GetRenderPipeline(view.GetShadowPassRenderPipelineId());             
+                //Only apply this optimization if you only have one view available.
+                if (renderPipeline && renderPipeline->GetViews(renderPipeline->GetMainViewTag()).size() == 1)
+                {
+                    RPI::ViewPtr cameraView = renderPipeline->GetDefaultView();
+                    const Matrix4x4& cameraWorldToClip = cameraView->GetWorldToClipMatrix();
+                    worklistData.m_cameraFrustum = Frustum::CreateFromMatrixColumnMajor(cameraWorldToClip);
+                    worklistData.m_applyCameraFrustumIntersectionTest = true;
+                }
+            }
+        }
+
+        // For shadow cascades that are greater than index 0 we can do another check to see if we can reject any Octree node that do not
+        // intersect with the camera frustum. We do this by checking for an overlap between the camera frustum and the Obb created
+        // from the node's AABB but rotated and extended towards light direction. This optimization is only activated when someone sets
+        // a non-negative extrusion value (i.e r_shadowCascadeExtrusionAmount) for their given content.
+        static bool OverlapsExtrudedCameraFrustum(const WorklistData& worklistData, const Aabb& nodeBounds)
+        {
+            if (r_shadowCascadeExtrusionAmount < 0 || !worklistData.m_applyCameraFrustumIntersectionTest || !worklistData.m_hasExcludeFrustum)
+            {
+                return true;
+            }
+
+            // Build an Obb from the Octree node's aabb
+            AZ::Obb extrudedBounds = AZ::Obb::CreateFromAabb(nodeBounds);
+
+            // Rotate the Obb in the direction of the light
+            AZ::Quaternion directionalLightRot = worklistData.m_view->GetCameraTransform().GetRotation();
+            extrudedBounds.SetRotation(directionalLightRot);
+            
+            AZ::Vector3 halfLength = 0.5f * nodeBounds.GetExtents();
+            // After converting AABB to OBB we apply a rotation and this can incorrectly fail intersection test. If you have an OBB cube built from an octree node,
+            // rotating it can cause it to not encapsulate meshes it encapsulated beforehand. The type of shape we want here is essentially a capsule that starts from the
+            // light and wraps the aabb of the octree node cube and extends towards light direction. This capsule's diameter needs to the size of the body diagonal
+            // of the cube. Since using capsule shape will make intersection test expensive we simply expand the Obb to have each side be at least the size of the body diagonal
+            // which is sqrt(3) * side size. Hence we expand the Obb by 73%. Since this is half length, we expand it by 73% / 2, or 36.5%.
+            halfLength *= Vector3(1.365f);
+            
+            // Next we extrude the Obb in the direction of the light in order to ensure we capture meshes that are behind the camera but cast a shadow within it's frustum
+            halfLength.SetY(halfLength.GetY() + r_shadowCascadeExtrusionAmount);
+            extrudedBounds.SetHalfLengths(halfLength);
+            return AZ::ShapeIntersection::Overlaps(worklistData.m_cameraFrustum, extrudedBounds);
+        }
+
         // Used to accumulate NodeData into lists to be handed off to jobs for processing
         struct WorkListType
         {
@@ -271,12 +330,61 @@ namespace AZ
         static bool TestOcclusionCulling(
             const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry);
 
+        // Number of entries classified against the frustum at once when the node provides structure-of-arrays bounds
+        static constexpr s32 EntryBoundsBlockSize = 64;
+
+        // Runs the per view tests for a cullable and, if it is visible, adds its lods to the view.
+        // testFrustum should be false when the cullable is already known to be inside the view frustum.
+        static bool CullAndAddToView(
+            const AZStd::shared_ptr<WorklistData>& worklistData,
+            AzFramework::VisibilityEntry* visibleEntry,
+            Cullable* c,
+            bool testFrustum,
+            uint32_t& drawPacketCount)
+        {
+            if ((c->m_cullData.m_drawListMask & worklistData->m_view->GetDrawListMask()).none() ||
+                c->m_cullData.m_hideFlags & worklistData->m_view->GetUsageFlags() ||
+                c->m_isHidden)
+            {
+                return false;
+            }
+
+            if (testFrustum)
+            {
+                IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
+                bool entryInFrustum = (res != IntersectResult::Exterior) && (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb));
+                if (!entryInFrustum)
+                {
+                    return false;
+                }
+            }
+
+            if (worklistData->m_hasExcludeFrustum &&
+                ShapeIntersection::Classify(worklistData->m_excludeFrustum, c->m_cullData.m_boundingSphere) == IntersectResult::Interior)
+            {
+                // Skip item contained in exclude frustum.
+                return false;
+            }
+
+            if (!TestOcclusionCulling(worklistData, visibleEntry))
+            {
+                return false;
+            }
+
+            drawPacketCount = AddLodDataToView(
+                c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, visibleEntry->m_typeFlags);
+            c->m_isVisible = true;
+            worklistData->m_view->ApplyFlags(c->m_flags);
+            return true;
+        }
+
         static void ProcessEntrylist(
             const AZStd::shared_ptr<WorklistData>& worklistData,
             const AZStd::vector<AzFramework::VisibilityEntry*>& entries,
             bool parentNodeContainedInFrustum = false,
             s32 startIdx = 0,
-            s32 endIdx = -1)
+            s32 endIdx = -1,
+            const AzFramework::VisibilityEntryBounds* entryBounds = nullptr)
         {
 #ifdef AZ_CULL_DEBUG_ENABLED
             // These variable are only used for the gathering of debug information.
@@ -285,52 +393,44 @@ namespace AZ
 #endif
             endIdx = (endIdx == -1) ? s32(entries.size()) : endIdx;
 
-            for (s32 i = startIdx; i < endIdx; ++i)
-            {
-                AzFramework::VisibilityEntry* visibleEntry = entries[i];
+            // When the node's entry bounds are available, classify them against the frustum in blocks first so that entries
+            // that are entirely outside the frustum are rejected without dereferencing the entry or its Cullable.
+            // The entry AABB encloses the Cullable's OBB, so Exterior and Interior results are exact and only Overlaps needs the per-entry test.
+            const bool useEntryBounds = !parentNodeContainedInFrustum && entryBounds != nullptr;
+            AZStd::array<IntersectResult, EntryBoundsBlockSize> entryBoundsResults;
 
-                if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
-                    visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
+            for (s32 blockStartIdx = startIdx; blockStartIdx < endIdx; blockStartIdx += EntryBoundsBlockSize)
+            {
+                const s32 blockEndIdx = AZStd::min(blockStartIdx + EntryBoundsBlockSize, endIdx);
+                if (useEntryBounds)
                 {
-                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                    entryBounds->ClassifyFrustum(worklistData->m_frustum, blockStartIdx, blockEndIdx, entryBoundsResults.data());
+                }
 
-                    if ((c->m_cullData.m_drawListMask & worklistData->m_view->GetDrawListMask()).none() ||
-                        c->m_cullData.m_hideFlags & worklistData->m_view->GetUsageFlags() ||
-                        c->m_isHidden)
+                for (s32 i = blockStartIdx; i < blockEndIdx; ++i)
+                {
+                    const IntersectResult entryBoundsResult = useEntryBounds ? entryBoundsResults[i - blockStartIdx] : IntersectResult::Overlaps;
+                    if (entryBoundsResult == IntersectResult::Exterior)
                     {
                         continue;
                     }
 
-                    if (!parentNodeContainedInFrustum)
-                    {
-                        IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
-                        bool entryInFrustum = (res != IntersectResult::Exterior) && (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb));
-                        if (!entryInFrustum)
-                        {
-                            continue;
-                        }
-                    }
-
-                    if (worklistData->m_hasExcludeFrustum &&
-                        ShapeIntersection::Classify(worklistData->m_excludeFrustum, c->m_cullData.m_boundingSphere) == IntersectResult::Interior)
-                    {
-                        // Skip item contained in exclude frustum.
-                        continue;
-                    }
+                    AzFramework::VisibilityEntry* visibleEntry = entries[i];
 
-                    if (TestOcclusionCulling(worklistData, visibleEntry))
+                    if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
+                        visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
                     {
-                        // There are ways to write this without [[maybe_unused]], but they are brittle.
-                        // For example, using #else could cause a bug where the function's parameter
-                        // is changed in #ifdef but not in #else.
-                        [[maybe_unused]] const uint32_t drawPacketCount = AddLodDataToView(
-                            c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, visibleEntry->m_typeFlags);
-                        c->m_isVisible = true;
-                        worklistData->m_view->ApplyFlags(c->m_flags);
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
+                        const bool testFrustum = !parentNodeContainedInFrustum && entryBoundsResult != IntersectResult::Interior;
+                        [[maybe_unused]] uint32_t drawPacketCount = 0;
+                        [[maybe_unused]] const bool isVisible = CullAndAddToView(worklistData, visibleEntry, c, testFrustum, drawPacketCount);
 #ifdef AZ_CULL_DEBUG_ENABLED
-                        ++numVisibleCullables;
-                        numDrawPackets += drawPacketCount;
+                        if (isVisible)
+                        {
+                            ++numVisibleCullables;
+                            numDrawPackets += drawPacketCount;
+                        }
 #endif
                     }
                 }
@@ -389,6 +489,7 @@ namespace AZ
 
             s32 startIdx = 0, size = s32(nodeData.m_entries.size());
             const AZStd::vector<AzFramework::VisibilityEntry*>& entries = nodeData.m_entries;
+            const AzFramework::VisibilityEntryBounds* entryBounds = nodeData.m_entryBounds;
 
             if (worklistData->m_taskGraphEvent)
             {
@@ -401,7 +502,7 @@ namespace AZ
                 {
                     taskGraph.AddTask(descriptor, [=, &entries]() -> void
                         {
-                            ProcessEntrylist(worklistData, entries, nodeIsContainedInFrustum, startIdx, startIdx + r_numEntriesPerCullingJob);
+                            ProcessEntrylist(worklistData, entries, nodeIsContainedInFrustum, startIdx, startIdx + r_numEntriesPerCullingJob, entryBounds);
                         });
                     startIdx += s32(r_numEntriesPerCullingJob);
                 }
@@ -412,7 +513,7 @@ namespace AZ
                     taskGraph.Submit(worklistData->m_taskGraphEvent);
                 }
 
-                ProcessEntrylist(worklistData, nodeData.m_entries, nodeIsContainedInFrustum, startIdx, size);
+                ProcessEntrylist(worklistData, nodeData.m_entries, nodeIsContainedInFrustum, startIdx, size, entryBounds);
             }
             else    // Use job system
             {
@@ -420,7 +521,7 @@ namespace AZ
                 {
                     auto processEntries = [=, &entries]() -> void
                     {
-                        ProcessEntrylist(worklistData, entries, nodeIsContainedInFrustum, startIdx, startIdx + r_numEntriesPerCullingJob);
+                        ProcessEntrylist(worklistData, entries, nodeIsContainedInFrustum, startIdx, startIdx + r_numEntriesPerCullingJob, entryBounds);
                     };
 
                     AZ::Job* job = AZ::CreateJobFunction(AZStd::move(processEntries), true);
@@ -430,7 +531,7 @@ namespace AZ
                     startIdx += s32(r_numEntriesPerCullingJob);
                 }
 
-                ProcessEntrylist(worklistData, nodeData.m_entries, nodeIsContainedInFrustum, startIdx, size);
+                ProcessEntrylist(worklistData, nodeData.m_entries, nodeIsContainedInFrustum, startIdx, size, entryBounds);
             }
 
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -467,6 +568,152 @@ namespace AZ
             }
         }
 
+        using FrustumMask = AzFramework::IVisibilityScene::FrustumMask;
+
+        // Per view data for a single multi-view traversal, indexed by the bit of the view in the frustum masks
+        struct MultiViewWorklistData
+        {
+            AZStd::fixed_vector<AZStd::shared_ptr<WorklistData>, AzFramework::IVisibilityScene::MaxEnumerateFrustums> m_views;
+        };
+
+        // A visible node along with the views whose frustums overlap or fully contain it
+        struct MultiViewNodeData
+        {
+            AzFramework::IVisibilityScene::NodeData m_nodeData;
+            FrustumMask m_overlapMask = 0;
+            FrustumMask m_containedMask = 0;
+        };
+
+        // Used to accumulate MultiViewNodeData into lists to be handed off to jobs for processing
+        struct MultiViewWorkListType
+        {
+            void Init()
+            {
+                m_entryCount = 0;
+                u32 reserveCount = r_useEntryCountForNodeJobs ? r_maxNodesWhenUsingEntryCount : r_numNodesPerCullingJob;
+                m_nodes.reserve(reserveCount);
+            }
+
+            u32 m_entryCount = 0;
+            AZStd::vector<MultiViewNodeData> m_nodes;
+        };
+
+        // Culls the entries of a node against every view in the node's overlap mask.
+        // Entries are first classified against each partially overlapping view in blocks to build a per entry view mask,
+        // so each Cullable is dereferenced at most once and only the views that can see it run the per view tests.
+        static void ProcessVisibilityNodeMultiView(const MultiViewWorklistData& multiViewData, const MultiViewNodeData& multiViewNode)
+        {
+            const AZStd::vector<AzFramework::VisibilityEntry*>& entries = multiViewNode.m_nodeData.m_entries;
+            const AzFramework::VisibilityEntryBounds* entryBounds = multiViewNode.m_nodeData.m_entryBounds;
+            const FrustumMask partialMask = multiViewNode.m_overlapMask & ~multiViewNode.m_containedMask;
+            const s32 entryCount = s32(entries.size());
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            AZStd::array<uint32_t, AzFramework::IVisibilityScene::MaxEnumerateFrustums> numDrawPackets = {};
+            AZStd::array<uint32_t, AzFramework::IVisibilityScene::MaxEnumerateFrustums> numVisibleCullables = {};
+#endif
+
+            AZStd::array<FrustumMask, EntryBoundsBlockSize> entryOverlapMasks;
+            AZStd::array<FrustumMask, EntryBoundsBlockSize> entryContainedMasks;
+            AZStd::array<IntersectResult, EntryBoundsBlockSize> entryBoundsResults;
+
+            for (s32 blockStartIdx = 0; blockStartIdx < entryCount; blockStartIdx += EntryBoundsBlockSize)
+            {
+                const s32 blockEndIdx = AZStd::min(blockStartIdx + EntryBoundsBlockSize, entryCount);
+                const s32 blockSize = blockEndIdx - blockStartIdx;
+
+                // Views that contain the node contain all of its entries, views that only overlap the node need per entry results
+                AZStd::fill_n(entryOverlapMasks.begin(), blockSize, multiViewNode.m_containedMask);
+                AZStd::fill_n(entryContainedMasks.begin(), blockSize, multiViewNode.m_containedMask);
+                for (FrustumMask remaining = partialMask; remaining != 0; remaining &= remaining - 1)
+                {
+                    const uint32_t viewIndex = az_ctz_u32(remaining);
+                    const FrustumMask viewBit = FrustumMask(1) << viewIndex;
+                    if (entryBounds == nullptr)
+                    {
+                        // Without structure-of-arrays bounds every entry falls back to the per entry frustum test
+                        for (s32 i = 0; i < blockSize; ++i)
+                        {
+                            entryOverlapMasks[i] |= viewBit;
+                        }
+                        continue;
+                    }
+
+                    entryBounds->ClassifyFrustum(multiViewData.m_views[viewIndex]->m_frustum, blockStartIdx, blockEndIdx, entryBoundsResults.data());
+                    for (s32 i = 0; i < blockSize; ++i)
+                    {
+                        if (entryBoundsResults[i] != IntersectResult::Exterior)
+                        {
+                            entryOverlapMasks[i] |= viewBit;
+                        }
+                        if (entryBoundsResults[i] == IntersectResult::Interior)
+                        {
+                            entryContainedMasks[i] |= viewBit;
+                        }
+                    }
+                }
+
+                for (s32 i = 0; i < blockSize; ++i)
+                {
+                    if (entryOverlapMasks[i] == 0)
+                    {
+                        continue;
+                    }
+
+                    AzFramework::VisibilityEntry* visibleEntry = entries[blockStartIdx + i];
+                    if (!(visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
+                          visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList))
+                    {
+                        continue;
+                    }
+
+                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                    for (FrustumMask remaining = entryOverlapMasks[i]; remaining != 0; remaining &= remaining - 1)
+                    {
+                        const uint32_t viewIndex = az_ctz_u32(remaining);
+                        const bool testFrustum = (entryContainedMasks[i] & (FrustumMask(1) << viewIndex)) == 0;
+                        [[maybe_unused]] uint32_t drawPacketCount = 0;
+                        [[maybe_unused]] const bool isVisible = CullAndAddToView(multiViewData.m_views[viewIndex], visibleEntry, c, testFrustum, drawPacketCount);
+#ifdef AZ_CULL_DEBUG_ENABLED
+                        if (isVisible)
+                        {
+                            ++numVisibleCullables[viewIndex];
+                            numDrawPackets[viewIndex] += drawPacketCount;
+                        }
+#endif
+                    }
+                }
+            }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            for (FrustumMask remaining = multiViewNode.m_overlapMask; remaining != 0; remaining &= remaining - 1)
+            {
+                const uint32_t viewIndex = az_ctz_u32(remaining);
+                const WorklistData& worklistData = *multiViewData.m_views[viewIndex];
+                if (worklistData.m_debugCtx->m_enableStats)
+                {
+                    CullingDebugContext::CullStats& cullStats = worklistData.m_debugCtx->GetCullStatsForView(worklistData.m_view);
+
+                    //no need for mutex here since these are all atomics
+                    cullStats.m_numVisibleDrawPackets += numDrawPackets[viewIndex];
+                    cullStats.m_numVisibleCullables += numVisibleCullables[viewIndex];
+                }
+            }
+#endif
+        }
+
+        static void ProcessWorklistMultiView(const MultiViewWorklistData& multiViewData, const MultiViewWorkListType& worklist)
+        {
+            AZ_PROFILE_SCOPE(RPI, "Culling: ProcessWorklistMultiView");
+
+            AZ_Assert(worklist.m_nodes.size() > 0, "Received empty worklist in ProcessWorklistMultiView");
+
+            for (const MultiViewNodeData& multiViewNode : worklist.m_nodes)
+            {
+                ProcessVisibilityNodeMultiView(multiViewData, multiViewNode);
+            }
+        }
+
         static bool TestOcclusionCulling(
             const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry)
         {
@@ -696,53 +943,13 @@ namespace AZ
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, taskGraphEvent);
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
-            if (const Matrix4x4* worldToClipExclude = view.GetWorldToClipExcludeMatrix())
-            {
-                worklistData->m_hasExcludeFrustum = true;
-                worklistData->m_excludeFrustum = Frustum::CreateFromMatrixColumnMajor(*worldToClipExclude);
+            InitExcludeFrustum(scene, view, *worklistData);
 
-                // Get the render pipeline associated with the shadow pass of the given view
-                RenderPipelinePtr renderPipeline = scene.GetRenderPipeline(view.GetShadowPassRenderPipelineId());             
-                //Only apply this optimization if you only have one view available.
-                if (renderPipeline && renderPipeline->GetViews(renderPipeline->GetMainViewTag()).size() == 1)
-                {
-                    RPI::ViewPtr cameraView = renderPipeline->GetDefaultView();
-                    const Matrix4x4& cameraWorldToClip = cameraView->GetWorldToClipMatrix();
-                    worklistData->m_cameraFrustum = Frustum::CreateFromMatrixColumnMajor(cameraWorldToClip);
-                    worklistData->m_applyCameraFrustumIntersectionTest = true;
-                }
-            }
-            
             auto nodeVisitorLambda = [worklistData, taskGraph, parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
-                // For shadow cascades that are greater than index 0 we can do another check to see if we can reject any Octree node that do not
-                // intersect with the camera frustum. We do this by checking for an overlap between the camera frustum and the Obb created
-                // from the node's AABB but rotated and extended towards light direction. This optimization is only activated when someone sets
-                // a non-negative extrusion value (i.e r_shadowCascadeExtrusionAmount) for their given content.
-                if (r_shadowCascadeExtrusionAmount >= 0 && worklistData->m_applyCameraFrustumIntersectionTest && worklistData->m_hasExcludeFrustum)
+                if (!OverlapsExtrudedCameraFrustum(*worklistData, nodeData.m_bounds))
                 {
-                    // Build an Obb from the Octree node's aabb
-                    AZ::Obb extrudedBounds = AZ::Obb::CreateFromAabb(nodeData.m_bounds);
-
-                    // Rotate the Obb in the direction of the light
-                    AZ::Quaternion directionalLightRot = worklistData->m_view->GetCameraTransform().GetRotation();
-                    extrudedBounds.SetRotation(directionalLightRot);
-                    
-                    AZ::Vector3 halfLength = 0.5f * nodeData.m_bounds.GetExtents();
-                    // After converting AABB to OBB we apply a rotation and this can incorrectly fail intersection test. If you have an OBB cube built from an octree node,
-                    // rotating it can cause it to not encapsulate meshes it encapsulated beforehand. The type of shape we want here is essentially a capsule that starts from the
-                    // light and wraps the aabb of the octree node cube and extends towards light direction. This capsule's diameter needs to the size of the body diagonal
-                    // of the cube. Since using capsule shape will make intersection test expensive we simply expand the Obb to have each side be at least the size of the body diagonal
-                    // which is sqrt(3) * side size. Hence we expand the Obb by 73%. Since this is half length, we expand it by 73% / 2, or 36.5%.
-                    halfLength *= Vector3(1.365f);
-                    
-                    // Next we extrude the Obb in the direction of the light in order to ensure we capture meshes that are behind the camera but cast a shadow within it's frustum
-                    halfLength.SetY(halfLength.GetY() + r_shadowCascadeExtrusionAmount);
-                    extrudedBounds.SetHalfLengths(halfLength);
-                    if (!AZ::ShapeIntersection::Overlaps(worklistData->m_cameraFrustum, extrudedBounds))
-                    {
-                        return;
-                    }
+                    return;
                 }
 
                 auto entriesInNode = nodeData.m_entries.size();
@@ -922,6 +1129,127 @@ namespace AZ
             ProcessCullables(scene, view, nullptr, &taskGraph, &taskGraphEvent);
         }
 
+        bool CullingScene::IsMultiViewCullingEnabled() const
+        {
+            // Per object debug drawing is only supported by the per view path
+            return r_useMultiViewCulling && !m_debugCtx.m_debugDraw;
+        }
+
+        void CullingScene::ProcessCullablesMultiView(
+            const Scene& scene, AZStd::span<const ViewPtr> views, AZ::Job* parentJob, AZ::TaskGraph* taskGraph, AZ::TaskGraphEvent* taskGraphEvent)
+        {
+            AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesMultiView() - %zu views", views.size());
+
+            AZ_Assert(parentJob != nullptr || taskGraph != nullptr, "ProcessCullablesMultiView must have either a valid parent job or a valid task graph");
+
+            static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklistMultiView", "Graphics" };
+            constexpr size_t MaxViewsPerTraversal = AzFramework::IVisibilityScene::MaxEnumerateFrustums;
+
+            for (size_t firstView = 0; firstView < views.size(); firstView += MaxViewsPerTraversal)
+            {
+                const AZStd::span<const ViewPtr> traversalViews = views.subspan(firstView, AZStd::min(MaxViewsPerTraversal, views.size() - firstView));
+
+                AZStd::shared_ptr<MultiViewWorklistData> multiViewData = AZStd::make_shared<MultiViewWorklistData>();
+                AZStd::fixed_vector<Frustum, MaxViewsPerTraversal> frustums;
+                for (const ViewPtr& viewPtr : traversalViews)
+                {
+                    View& view = *viewPtr;
+                    AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
+                    ProcessCullablesCommon(scene, view, frustum);
+
+                    AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, taskGraphEvent);
+                    InitExcludeFrustum(scene, view, *worklistData);
+                    multiViewData->m_views.push_back(AZStd::move(worklistData));
+                    frustums.push_back(frustum);
+                }
+
+                AZStd::shared_ptr<MultiViewWorkListType> worklist = AZStd::make_shared<MultiViewWorkListType>();
+                worklist->Init();
+
+                auto submitWorklist = [multiViewData, taskGraph, parentJob, &worklist]()
+                {
+                    // capture multiViewData & worklist by value
+                    auto processWorklist = [multiViewData, worklist = worklist]()
+                    {
+                        ProcessWorklistMultiView(*multiViewData, *worklist);
+                    };
+
+                    if (taskGraph != nullptr)
+                    {
+                        taskGraph->AddTask(descriptor, AZStd::move(processWorklist));
+                    }
+                    else
+                    {
+                        //Kick off a job to process the (full) worklist
+                        AZ::Job* job = AZ::CreateJobFunction(AZStd::move(processWorklist), true);
+                        parentJob->SetContinuation(job);
+                        job->Start();
+                    }
+                };
+
+                auto nodeVisitorLambda = [multiViewData, &worklist, &submitWorklist](
+                    const AzFramework::IVisibilityScene::NodeData& nodeData, FrustumMask overlapMask, FrustumMask containedMask) -> void
+                {
+                    // Apply the per view node rejection that the single view traversal does for shadow cascades
+                    for (FrustumMask remaining = overlapMask; remaining != 0; remaining &= remaining - 1)
+                    {
+                        const uint32_t viewIndex = az_ctz_u32(remaining);
+                        const WorklistData& worklistData = *multiViewData->m_views[viewIndex];
+                        if ((worklistData.m_hasExcludeFrustum && ShapeIntersection::Contains(worklistData.m_excludeFrustum, nodeData.m_bounds)) ||
+                            !OverlapsExtrudedCameraFrustum(worklistData, nodeData.m_bounds))
+                        {
+                            overlapMask &= ~(FrustumMask(1) << viewIndex);
+                        }
+                    }
+                    containedMask &= overlapMask;
+
+                    if (overlapMask == 0)
+                    {
+                        return;
+                    }
+
+                    auto entriesInNode = nodeData.m_entries.size();
+                    AZ_Assert(entriesInNode > 0, "should not get called with 0 entries");
+
+                    // Check job spawn condition for entries
+                    bool spawnJob = r_useEntryCountForNodeJobs && (worklist->m_entryCount > 0) &&
+                        ((worklist->m_entryCount + entriesInNode) > r_numEntriesPerCullingJob);
+
+                    // Check job spawn condition for nodes
+                    spawnJob = spawnJob || (worklist->m_nodes.size() == worklist->m_nodes.capacity());
+
+                    if (spawnJob)
+                    {
+                        submitWorklist();
+                        worklist = AZStd::make_shared<MultiViewWorkListType>();
+                        worklist->Init();
+                    }
+
+                    worklist->m_nodes.push_back({ nodeData, overlapMask, containedMask });
+                    worklist->m_entryCount += u32(entriesInNode);
+                };
+
+                if (m_debugCtx.m_enableFrustumCulling)
+                {
+                    m_visScene->Enumerate(frustums.data(), aznumeric_cast<uint32_t>(frustums.size()), nodeVisitorLambda);
+                }
+                else
+                {
+                    // Treat every node as fully contained by every view
+                    const FrustumMask allViewsMask = (frustums.size() >= MaxViewsPerTraversal) ? ~FrustumMask(0) : ((FrustumMask(1) << frustums.size()) - 1);
+                    m_visScene->EnumerateNoCull([&nodeVisitorLambda, allViewsMask](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        nodeVisitorLambda(nodeData, allViewsMask, allViewsMask);
+                    });
+                }
+
+                if (worklist->m_nodes.size() > 0)
+                {
+                    submitWorklist();
+                }
+            }
+        }
+
         uint32_t AddLodDataToView(
             const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, AzFramework::VisibilityEntry::TypeFlags typeFlags)
         {
@@ -9,6 +9,7 @@
 #include <Atom/RHI/DrawPacketBuilder.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/MeshDrawPacketCache.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
@@ -33,6 +34,15 @@ namespace AZ
             "(For Testing) Forces usage of root shader variant in the mesh draw packet level, ignoring any other shader variants that may exist."
         );
 
+        AZ_CVAR(bool,
+            r_meshDrawPacketCache,
+            false,
+            [](const bool&) { AZ::Interface<AZ::IConsole>::Get()->PerformCommand("MeshFeatureProcessor.ForceRebuildDrawPackets"); },
+            ConsoleFunctorFlags::Null,
+            "Share the shader variants, pipeline states and draw SRGs of mesh draw packets with identical mesh, material and shader option state. "
+            "Only enable this if draw SRGs returned by MeshFeatureProcessor::GetDrawSrg() are never modified per mesh instance, since they are shared."
+        );
+
         MeshDrawPacket::MeshDrawPacket(
             ModelLod& modelLod,
             size_t modelLodMeshIndex,
@@ -242,7 +252,11 @@ namespace AZ
             AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, m_modelLod->GetAssetId());
 
             AZ_TracePrintf("MeshDrawPacket", "Mesh: %s", assetInfo.m_relativePath.data());
-            for (const auto& variant : m_shaderVariantNames)
+            if (!m_sharedData)
+            {
+                return;
+            }
+            for (const auto& variant : m_sharedData->m_shaderVariantNames)
             {
                 AZ_TracePrintf("MeshDrawPacket", "%d: %s", index++, variant.data());
             }
@@ -271,28 +285,127 @@ namespace AZ
 
             ShaderReloadDebugTracker::ScopedSection reloadSection("MeshDrawPacket::DoUpdate");
 
+            m_material->ApplyGlobalShaderOptions();
+
+            // Instances of the same mesh with the same material and settings share everything except their object SRG.
+            // While the material still needs to compile, its change id doesn't describe the properties the draw items are built with
+            // (see Update()), so that data is neither looked up nor shared.
+            const bool useCache = r_meshDrawPacketCache && !m_material->NeedsCompile();
+            MeshDrawPacketCache* cache = useCache ? &parentScene.GetMeshDrawPacketCache() : nullptr;
+            MeshDrawPacketCacheKey cacheKey;
+            Ptr<SharedData> sharedData;
+            if (cache)
+            {
+                cacheKey.m_modelLod = m_modelLod.get();
+                cacheKey.m_modelLodMeshIndex = m_modelLodMeshIndex;
+                cacheKey.m_material = m_material.get();
+                cacheKey.m_materialChangeId = m_material->GetCurrentChangeId();
+                cacheKey.m_shaderOptions = m_shaderOptions;
+                cacheKey.m_materialModelUvMap = m_materialModelUvMap;
+                cacheKey.m_drawListFilter = m_drawListFilter;
+                cacheKey.m_sortKey = m_sortKey;
+                cacheKey.m_stencilRef = m_stencilRef;
+                cacheKey.m_forceRootShaderVariant = r_forceRootShaderVariantUsage;
+
+                sharedData = cache->Find(cacheKey);
+                if (sharedData && !IsSharedDataUpToDate(*sharedData))
+                {
+                    sharedData = nullptr;
+                }
+            }
+
+            if (!sharedData)
+            {
+                sharedData = BuildSharedData(parentScene);
+                if (cache)
+                {
+                    cache->Insert(AZStd::move(cacheKey), sharedData);
+                }
+            }
+
             RHI::DrawPacketBuilder drawPacketBuilder{RHI::MultiDevice::AllDevices};
             drawPacketBuilder.Begin(nullptr);
             drawPacketBuilder.SetGeometryView(&mesh);
             drawPacketBuilder.AddShaderResourceGroup(m_objectSrg->GetRHIShaderResourceGroup());
             drawPacketBuilder.AddShaderResourceGroup(m_material->GetRHIShaderResourceGroup());
 
-            // We build the list of used shaders in a local list rather than m_activeShaders so that
-            // if DoUpdate() fails it won't modify any member data.
-            MeshDrawPacket::ShaderList shaderList;
-            shaderList.reserve(m_activeShaders.size());
-
             // The root constants are shared by all draw items in the draw packet. We must populate them with default values.
-            // The draw packet builder needs to know where the data is coming from during appendShader, but it's not actually read
+            // The draw packet builder needs to know where the data is coming from, but it's not actually read
             // until drawPacketBuilder.End(), so store the default data out here.
             AZStd::vector<uint8_t> rootConstants;
-            bool isFirstShaderItem = true;
+            if (HasRootConstants(sharedData->m_rootConstantsLayout.get()))
+            {
+                rootConstants.resize(sharedData->m_rootConstantsLayout->GetDataSize());
+                drawPacketBuilder.SetRootConstants(rootConstants);
+            }
 
-            m_perDrawSrgs.clear();
+            for (const SharedData::DrawItem& drawItem : sharedData->m_drawItems)
+            {
+                RHI::DrawPacketBuilder::DrawRequest drawRequest;
+                drawRequest.m_listTag = drawItem.m_listTag;
+                drawRequest.m_pipelineState = drawItem.m_pipelineState;
+                if (drawItem.m_isRasterShader)
+                {
+                    drawRequest.m_streamIndices = drawItem.m_streamIndices;
+                    drawRequest.m_stencilRef = m_stencilRef;
+                }
+                drawRequest.m_sortKey = m_sortKey;
+                if (drawItem.m_drawSrg)
+                {
+                    drawRequest.m_uniqueShaderResourceGroup = drawItem.m_drawSrg->GetRHIShaderResourceGroup();
+                }
+                drawRequest.m_drawFilterMask = drawItem.m_drawFilterMask;
+                drawPacketBuilder.AddDrawItem(drawRequest);
+            }
 
-#ifdef DEBUG_MESH_SHADERVARIANTS
-            m_shaderVariantNames.clear();
-#endif
+            m_drawPacket = drawPacketBuilder.End();
+
+            if (m_drawPacket)
+            {
+                m_perDrawSrgs.clear();
+                for (const SharedData::DrawItem& drawItem : sharedData->m_drawItems)
+                {
+                    if (drawItem.m_drawSrg)
+                    {
+                        m_perDrawSrgs.push_back(drawItem.m_drawSrg);
+                    }
+                }
+                m_rootConstantsLayout = sharedData->m_rootConstantsLayout;
+                m_materialSrg = m_material->GetRHIShaderResourceGroup();
+                m_sharedData = AZStd::move(sharedData);
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        bool MeshDrawPacket::IsSharedDataUpToDate(const SharedData& sharedData) const
+        {
+            // Shader variants finish loading asynchronously, so data that was built with a fallback variant is rebuilt once the
+            // requested variant is ready
+            for (const ShaderData& shaderData : sharedData.m_activeShaders)
+            {
+                const ShaderVariant& variant = r_forceRootShaderVariantUsage
+                    ? shaderData.m_shader->GetRootVariant()
+                    : shaderData.m_shader->GetVariant(shaderData.m_requestedShaderVariantId);
+                if (variant.GetStableId() != shaderData.m_activeShaderVariantStableId)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        Ptr<MeshDrawPacket::SharedData> MeshDrawPacket::BuildSharedData(const Scene& parentScene) const
+        {
+            Ptr<SharedData> sharedData = aznew SharedData();
+            sharedData->m_modelLod = m_modelLod;
+            sharedData->m_material = m_material;
+
+            MeshDrawPacket::ShaderList& shaderList = sharedData->m_activeShaders;
+            bool isFirstShaderItem = true;
 
             auto appendShader = [&](const ShaderCollection::Item& shaderItem, const Name& materialPipelineName)
             {
@@ -373,10 +486,10 @@ namespace AZ
                 }
 
                 // apply shader options from this draw packet to the ShaderItem
-                for (auto& meshShaderOption : m_shaderOptions)
+                for (const auto& meshShaderOption : m_shaderOptions)
                 {
-                    Name& name = meshShaderOption.first;
-                    RPI::ShaderOptionValue& value = meshShaderOption.second;
+                    const Name& name = meshShaderOption.first;
+                    const RPI::ShaderOptionValue& value = meshShaderOption.second;
 
                     ShaderOptionIndex index = shaderOptions.FindShaderOptionIndex(name);
 
@@ -392,7 +505,7 @@ namespace AZ
                 const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(requestedVariantId);
 
 #ifdef DEBUG_MESH_SHADERVARIANTS
-                m_shaderVariantNames.push_back(variant.GetShaderVariantAsset().GetHint());
+                sharedData->m_shaderVariantNames.push_back(variant.GetShaderVariantAsset().GetHint());
 #endif
 
                 UvStreamTangentBitmask uvStreamTangentBitmask;
@@ -471,19 +584,18 @@ namespace AZ
                 {
                     if (HasRootConstants(rootConstantsLayout))
                     {
-                        m_rootConstantsLayout = rootConstantsLayout;
-                        rootConstants.resize(m_rootConstantsLayout->GetDataSize());
-                        drawPacketBuilder.SetRootConstants(rootConstants);
+                        sharedData->m_rootConstantsLayout = rootConstantsLayout;
                     }
 
                     isFirstShaderItem = false;
                 }
                 else
                 {
+                    [[maybe_unused]] const RHI::ConstantsLayout* firstRootConstantsLayout = sharedData->m_rootConstantsLayout.get();
                     AZ_Error(
                         "MeshDrawPacket",
-                        (!m_rootConstantsLayout && !HasRootConstants(rootConstantsLayout)) ||
-                            (m_rootConstantsLayout && rootConstantsLayout && m_rootConstantsLayout->GetHash() == rootConstantsLayout->GetHash()),
+                        (!firstRootConstantsLayout && !HasRootConstants(rootConstantsLayout)) ||
+                            (firstRootConstantsLayout && rootConstantsLayout && firstRootConstantsLayout->GetHash() == rootConstantsLayout->GetHash()),
                         "Shader %s has mis-matched root constant layout in material %s. "
                         "All draw items in a draw packet need to share the same root constants layout. This means that each pass "
                         "(e.g. Depth, Shadows, Forward, MotionVectors) for a given materialtype should use the same layout.",
@@ -491,30 +603,25 @@ namespace AZ
                         m_material->GetAsset().ToString<AZStd::string>().c_str());
                 }
 
-                RHI::DrawPacketBuilder::DrawRequest drawRequest;
-                drawRequest.m_listTag = drawListTag;
-                drawRequest.m_pipelineState = pipelineState;
+                SharedData::DrawItem drawItem;
+                drawItem.m_listTag = drawListTag;
+                drawItem.m_pipelineState = pipelineState;
+                drawItem.m_isRasterShader = isRasterShader;
                 if (isRasterShader)
                 {
-                    drawRequest.m_streamIndices = streamIndices;
-                    drawRequest.m_stencilRef = m_stencilRef;
-                }
-                drawRequest.m_sortKey = m_sortKey;
-                if (drawSrg)
-                {
-                    drawRequest.m_uniqueShaderResourceGroup = drawSrg->GetRHIShaderResourceGroup();
-                    // Hold on to a reference to the drawSrg so the refcount doesn't drop to zero
-                    m_perDrawSrgs.push_back(drawSrg);
+                    drawItem.m_streamIndices = streamIndices;
                 }
+                // Hold on to a reference to the drawSrg so the refcount doesn't drop to zero
+                drawItem.m_drawSrg = drawSrg;
 
                 if (materialPipelineName != MaterialPipelineNone)
                 {
                     RHI::DrawFilterTag pipelineTag = parentScene.GetDrawFilterTagRegistry()->AcquireTag(materialPipelineName);
                     AZ_Assert(pipelineTag.IsValid(), "Could not acquire pipeline filter tag '%s'.", materialPipelineName.GetCStr());
-                    drawRequest.m_drawFilterMask = 1 << pipelineTag.GetIndex();
+                    drawItem.m_drawFilterMask = 1 << pipelineTag.GetIndex();
                 }
 
-                drawPacketBuilder.AddDrawItem(drawRequest);
+                sharedData->m_drawItems.push_back(AZStd::move(drawItem));
 
                 ShaderData shaderData;
                 shaderData.m_shader = AZStd::move(shader);
@@ -528,8 +635,6 @@ namespace AZ
                 return true;
             }; // appendShader
 
-            m_material->ApplyGlobalShaderOptions();
-
             // TODO(MaterialPipeline): We might want to detect duplicate ShaderItem objects here, and merge them to avoid redundant RHI DrawItems.
             m_material->ForAllShaderItems(
                 [&](const Name& materialPipelineName, const ShaderCollection::Item& shaderItem)
@@ -550,18 +655,13 @@ namespace AZ
                     return true;
                 });
 
-            m_drawPacket = drawPacketBuilder.End();
+            return sharedData;
+        }
 
-            if (m_drawPacket)
-            {
-                m_activeShaders = shaderList;
-                m_materialSrg = m_material->GetRHIShaderResourceGroup();
-                return true;
-            }
-            else
-            {
-                return false;
-            }
+        const MeshDrawPacket::ShaderList& MeshDrawPacket::GetActiveShaderList() const
+        {
+            static const ShaderList EmptyShaderList;
+            return m_sharedData ? m_sharedData->m_activeShaders : EmptyShaderList;
         }
 
         const RHI::ConstPtr<RHI::ConstantsLayout> MeshDrawPacket::GetRootConstantsLayout() const
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/MeshDrawPacketCache.h>
+
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        bool MeshDrawPacketCacheKey::operator==(const MeshDrawPacketCacheKey& other) const
+        {
+            return m_modelLod == other.m_modelLod &&
+                m_modelLodMeshIndex == other.m_modelLodMeshIndex &&
+                m_material == other.m_material &&
+                m_materialChangeId == other.m_materialChangeId &&
+                m_shaderOptions == other.m_shaderOptions &&
+                m_materialModelUvMap == other.m_materialModelUvMap &&
+                m_drawListFilter == other.m_drawListFilter &&
+                m_sortKey == other.m_sortKey &&
+                m_stencilRef == other.m_stencilRef &&
+                m_forceRootShaderVariant == other.m_forceRootShaderVariant;
+        }
+
+        size_t MeshDrawPacketCacheKey::GetHash() const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(
+                seed,
+                m_modelLod,
+                m_modelLodMeshIndex,
+                m_material,
+                m_materialChangeId,
+                m_drawListFilter.to_ullong(),
+                m_sortKey,
+                m_stencilRef,
+                m_forceRootShaderVariant);
+
+            for (const auto& [optionName, optionValue] : m_shaderOptions)
+            {
+                AZStd::hash_combine(seed, optionName.GetHash(), optionValue.GetIndex());
+            }
+
+            // The map is unordered, so its entries are combined in an order independent way
+            size_t uvMapHash = 0;
+            for (const auto& [semantic, uvName] : m_materialModelUvMap)
+            {
+                size_t entryHash = AZStd::hash<RHI::ShaderSemantic>{}(semantic);
+                AZStd::hash_combine(entryHash, uvName.GetHash());
+                uvMapHash += entryHash;
+            }
+            AZStd::hash_combine(seed, uvMapHash);
+            return seed;
+        }
+
+        Ptr<MeshDrawPacket::SharedData> MeshDrawPacketCache::Find(const MeshDrawPacketCacheKey& key) const
+        {
+            AZStd::shared_lock<decltype(m_mutex)> lock(m_mutex);
+            auto entryIt = m_entries.find(key);
+            return entryIt != m_entries.end() ? entryIt->second : nullptr;
+        }
+
+        void MeshDrawPacketCache::Insert(MeshDrawPacketCacheKey key, Ptr<MeshDrawPacket::SharedData> sharedData)
+        {
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            m_entries.insert_or_assign(AZStd::move(key), AZStd::move(sharedData));
+        }
+
+        void MeshDrawPacketCache::RemoveUnused()
+        {
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            AZStd::erase_if(m_entries, [](const auto& entry)
+                {
+                    // The cache holds the only reference
+                    return entry.second->use_count() == 1;
+                });
+        }
+
+        void MeshDrawPacketCache::Clear()
+        {
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            m_entries.clear();
+        }
+
+        size_t MeshDrawPacketCache::GetEntryCount() const
+        {
+            AZStd::shared_lock<decltype(m_mutex)> lock(m_mutex);
+            return m_entries.size();
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -1510,6 +1510,12 @@ namespace AZ
             UpdateAttachmentCopy(params);
         }
 
+        void Pass::FrameBeginParallel()
+        {
+            FrameBeginParallelInternal();
+            m_flags.m_frameBeginParallelDone = true;
+        }
+
         void Pass::FrameEnd()
         {
             if (m_state == PassState::Rendering)
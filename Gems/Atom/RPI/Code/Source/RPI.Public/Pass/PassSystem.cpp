@@ -9,11 +9,15 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <AzCore/Serialization/Json/JsonUtils.h>
 
@@ -46,6 +50,62 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_passSystemParallelFrameBegin, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Update the connected bindings and draw lists of the passes on worker threads before the serial FrameBegin.");
+
+        namespace
+        {
+            // Number of passes processed by one task of the parallel FrameBegin
+            constexpr size_t PassesPerFrameBeginTask = 16;
+
+            // Calls taskFunction(begin, end) for chunks of [0, count) on the task graph or the job system and waits for all of them
+            template<typename TaskFunction>
+            void ParallelForChunks(size_t count, size_t chunkSize, const TaskFunction& taskFunction)
+            {
+                if (count <= chunkSize)
+                {
+                    if (count > 0)
+                    {
+                        taskFunction(size_t{ 0 }, count);
+                    }
+                    return;
+                }
+
+                auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+                if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+                {
+                    static const AZ::TaskDescriptor frameBeginTGDesc{ "RPI::PassSystem::FrameBeginParallel", "Graphics" };
+                    AZ::TaskGraph frameBeginTG{ "RPI::PassSystem::FrameBeginParallel" };
+                    for (size_t begin = 0; begin < count; begin += chunkSize)
+                    {
+                        const size_t end = AZStd::min(begin + chunkSize, count);
+                        frameBeginTG.AddTask(frameBeginTGDesc, [&taskFunction, begin, end]()
+                            {
+                                taskFunction(begin, end);
+                            });
+                    }
+                    AZ::TaskGraphEvent frameBeginTGEvent{ "RPI::PassSystem::FrameBeginParallel Wait" };
+                    frameBeginTG.Submit(&frameBeginTGEvent);
+                    frameBeginTGEvent.Wait();
+                }
+                else
+                {
+                    AZ::JobCompletion jobCompletion;
+                    for (size_t begin = 0; begin < count; begin += chunkSize)
+                    {
+                        const size_t end = AZStd::min(begin + chunkSize, count);
+                        auto jobLambda = [&taskFunction, begin, end]()
+                        {
+                            taskFunction(begin, end);
+                        };
+                        AZ::Job* job = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr); // Auto-deletes
+                        job->SetDependent(&jobCompletion);
+                        job->Start();
+                    }
+                    jobCompletion.StartAndWaitForCompletion();
+                }
+            }
+        } // namespace
 
         PassSystemInterface* PassSystemInterface::Get()
         {
@@ -220,12 +280,101 @@ namespace AZ
             m_state = PassSystemState::Rendering;
             Pass::FramePrepareParams params{ &frameGraphBuilder };
 
+            if (r_passSystemParallelFrameBegin)
+            {
+                FrameBeginParallel();
+            }
+            else
+            {
+                for (RenderPipeline*& pipeline : m_renderPipelines)
+                {
+                    if (pipeline->GetRenderMode() != RenderPipeline::RenderMode::NoRender)
+                    {
+                        pipeline->m_passTree.m_rootPass->UpdateConnectedBindings();
+                    }
+                }
+                m_passesWithoutPipeline.m_rootPass->UpdateConnectedBindings();
+            }
+
+            // Attachments and scope producers are registered with the frame graph serially and in tree order,
+            // so the frame graph is built the same way every frame regardless of how the parallel work was scheduled
             for (RenderPipeline*& pipeline : m_renderPipelines)
             {
                 pipeline->PassSystemFrameBegin(params);
             }
-            m_passesWithoutPipeline.m_rootPass->UpdateConnectedBindings();
             m_passesWithoutPipeline.m_rootPass->FrameBegin(params);
+
+            for (Pass* pass : m_frameBeginPasses)
+            {
+                pass->m_flags.m_frameBeginParallelDone = false;
+            }
+            m_frameBeginPasses.clear();
+        }
+
+        void PassSystem::FrameBeginParallel()
+        {
+            AZ_PROFILE_SCOPE(RPI, "PassSystem: FrameBeginParallel");
+
+            AZStd::vector<Pass*> rootPasses;
+            rootPasses.reserve(m_renderPipelines.size() + 1);
+            for (RenderPipeline* pipeline : m_renderPipelines)
+            {
+                if (pipeline->GetRenderMode() != RenderPipeline::RenderMode::NoRender)
+                {
+                    rootPasses.push_back(pipeline->m_passTree.m_rootPass.get());
+                }
+            }
+            rootPasses.push_back(m_passesWithoutPipeline.m_rootPass.get());
+
+            // Bindings only connect passes of the same tree, so every pipeline can update its tree independently
+            {
+                AZ_PROFILE_SCOPE(RPI, "PassSystem: UpdateConnectedBindings");
+                ParallelForChunks(rootPasses.size(), 1, [&rootPasses](size_t begin, size_t end)
+                    {
+                        for (size_t index = begin; index < end; ++index)
+                        {
+                            rootPasses[index]->UpdateConnectedBindings();
+                        }
+                    });
+            }
+
+            for (Pass* rootPass : rootPasses)
+            {
+                CollectFrameBeginPasses(rootPass);
+            }
+
+            ParallelForChunks(m_frameBeginPasses.size(), PassesPerFrameBeginTask, [this](size_t begin, size_t end)
+                {
+                    AZ_PROFILE_SCOPE(RPI, "PassSystem: FrameBeginParallel Task");
+                    for (size_t index = begin; index < end; ++index)
+                    {
+                        m_frameBeginPasses[index]->FrameBeginParallel();
+                    }
+                });
+        }
+
+        void PassSystem::CollectFrameBeginPasses(Pass* pass)
+        {
+            // Same early outs as Pass::FrameBegin
+            if (!pass->IsEnabled())
+            {
+                return;
+            }
+            if (pass->m_flags.m_isPipelineRoot &&
+                (pass->m_pipeline == nullptr || pass->m_pipeline->GetRenderMode() == RenderPipeline::RenderMode::NoRender))
+            {
+                return;
+            }
+
+            m_frameBeginPasses.push_back(pass);
+
+            if (ParentPass* parentPass = pass->AsParent())
+            {
+                for (const Ptr<Pass>& child : parentPass->GetChildren())
+                {
+                    CollectFrameBeginPasses(child.get());
+                }
+            }
         }
 
         void PassSystem::FrameEnd()
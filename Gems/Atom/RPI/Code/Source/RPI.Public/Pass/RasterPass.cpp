@@ -144,7 +144,12 @@ namespace AZ
                     m_viewportState = params.m_viewportState;
                 }
             }
-            UpdateDrawList();
+            // The draw list is usually built by FrameBeginParallelInternal on a worker thread
+            if (!m_flags.m_frameBeginParallelDone)
+            {
+                UpdateDrawList();
+            }
+            PassSystemInterface::Get()->IncrementFrameDrawItemCount(m_drawItemCount);
 
             RenderPass::FrameBeginInternal(params);
         }
@@ -160,10 +165,19 @@ namespace AZ
             RenderPass::InitializeInternal();
         }
 
+        void RasterPass::FrameBeginParallelInternal()
+        {
+            UpdateDrawList();
+        }
+
         void RasterPass::UpdateDrawList()
         {
-             // DrawLists from dynamic draw
-            AZStd::vector<RHI::DrawListView> drawLists = DynamicDrawInterface::Get()->GetDrawListsForPass(this);
+             // DrawLists from dynamic draw. The dynamic draw system is only registered once the RPI system assets are initialized.
+            AZStd::vector<RHI::DrawListView> drawLists;
+            if (DynamicDrawInterface* dynamicDraw = DynamicDrawInterface::Get())
+            {
+                drawLists = dynamicDraw->GetDrawListsForPass(this);
+            }
 
             // Get DrawList from view
             const AZStd::vector<ViewPtr>& views = m_pipeline->GetViews(GetPipelineViewTag());
@@ -186,7 +200,6 @@ namespace AZ
             {
                 m_drawListView = viewDrawList;
                 m_drawItemCount += static_cast<uint32_t>(viewDrawList.size());
-                PassSystemInterface::Get()->IncrementFrameDrawItemCount(m_drawItemCount);
                 return;
             }
 
@@ -198,7 +211,6 @@ namespace AZ
             {
                 m_drawItemCount += static_cast<uint32_t>(drawList.size());
             }
-            PassSystemInterface::Get()->IncrementFrameDrawItemCount(m_drawItemCount);
             m_combinedDrawList.resize(m_drawItemCount);
             RHI::DrawItemProperties* currentBuffer = m_combinedDrawList.data();
             for (auto drawList : drawLists)
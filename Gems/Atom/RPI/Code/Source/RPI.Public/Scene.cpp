@@ -10,6 +10,7 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawSystem.h>
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/MeshDrawPacketCache.h>
 #include <Atom/RPI.Public/Pass/FullscreenTrianglePass.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -107,6 +108,7 @@ namespace AZ
         {
             m_id = AZ::Uuid::CreateRandom();
             m_cullingScene = aznew CullingScene();
+            m_meshDrawPacketCache = AZStd::make_unique<MeshDrawPacketCache>();
             SceneRequestBus::Handler::BusConnect(m_id);
             m_drawFilterTagRegistry = RHI::DrawFilterTagRegistry::Create();
         }
@@ -175,6 +177,7 @@ namespace AZ
 
             m_activated = false;
             m_pipelineStatesLookup.clear();
+            m_meshDrawPacketCache->Clear();
             m_dynamicDrawSystem = nullptr;
         }
 
@@ -451,6 +454,7 @@ namespace AZ
                     {
                         FeatureProcessor::SimulatePacket jobPacket = m_simulatePacket;
                         jobPacket.m_parentJob = nullptr;
+                        jobPacket.m_isTaskGraphWorker = true;
                         featureProcessor->Simulate(jobPacket);
                     });
             }
@@ -593,7 +597,12 @@ namespace AZ
             static const AZ::TaskDescriptor processCullablesDescriptor{"AZ::RPI::Scene::ProcessCullables", "Graphics"};
             AZ::TaskGraphEvent processCullablesTGEvent{ "ProcessCullables Wait" };
             AZ::TaskGraph processCullablesTG{ "ProcessCullables" };
-            if (parallelOctreeTraversal)
+            if (m_cullingScene->IsMultiViewCullingEnabled())
+            {
+                // A single traversal culls all views, it adds its worklists to processCullablesTG
+                m_cullingScene->ProcessCullablesMultiView(*this, m_renderPacket.m_views, nullptr, &processCullablesTG, &processCullablesTGEvent);
+            }
+            else if (parallelOctreeTraversal)
             {
                 for (ViewPtr& viewPtr : m_renderPacket.m_views)
                 {
@@ -650,11 +659,12 @@ namespace AZ
             // Launch CullingSystem::ProcessCullables() jobs (will run concurrently with FeatureProcessor::Render() jobs)
             const bool parallelOctreeTraversal = m_cullingScene->GetDebugContext().m_parallelOctreeTraversal;
             m_cullingScene->BeginCulling(*this, m_renderPacket.m_views);
-            for (ViewPtr& viewPtr : m_renderPacket.m_views)
+            if (m_cullingScene->IsMultiViewCullingEnabled())
             {
-                AZ::Job* processCullablesJob = AZ::CreateJobFunction([this, &viewPtr](AZ::Job& thisJob)
+                // A single traversal culls all views
+                AZ::Job* processCullablesJob = AZ::CreateJobFunction([this](AZ::Job& thisJob)
                     {
-                        m_cullingScene->ProcessCullablesJobs(*this, *viewPtr, thisJob); // can't call directly because ProcessCullables needs a parent job
+                        m_cullingScene->ProcessCullablesMultiView(*this, m_renderPacket.m_views, &thisJob);
                     },
                     true, nullptr); //auto-deletes
                 if (parallelOctreeTraversal)
@@ -667,6 +677,26 @@ namespace AZ
                     processCullablesJob->StartAndWaitForCompletion();
                 }
             }
+            else
+            {
+                for (ViewPtr& viewPtr : m_renderPacket.m_views)
+                {
+                    AZ::Job* processCullablesJob = AZ::CreateJobFunction([this, &viewPtr](AZ::Job& thisJob)
+                        {
+                            m_cullingScene->ProcessCullablesJobs(*this, *viewPtr, thisJob); // can't call directly because ProcessCullables needs a parent job
+                        },
+                        true, nullptr); //auto-deletes
+                    if (parallelOctreeTraversal)
+                    {
+                        processCullablesJob->SetDependent(collectDrawPacketsCompletion);
+                        processCullablesJob->Start();
+                    }
+                    else
+                    {
+                        processCullablesJob->StartAndWaitForCompletion();
+                    }
+                }
+            }
 
             WaitAndCleanCompletionJob(collectDrawPacketsCompletion);
         }
@@ -886,6 +916,9 @@ namespace AZ
                 fp->OnRenderEnd();
             }
 
+            // Draw packets are only rebuilt during the frame, so this is when their old shared data is released
+            m_meshDrawPacketCache->RemoveUnused();
+
             for (auto& pipeline : m_pipelines)
             {
                 for (auto& pipelineView : pipeline->GetPipelineViews())
@@ -1058,6 +1091,11 @@ namespace AZ
             return m_cullingScene;
         }
 
+        MeshDrawPacketCache& Scene::GetMeshDrawPacketCache() const
+        {
+            return *m_meshDrawPacketCache;
+        }
+
         void Scene::RebuildPipelineStatesLookup()
         {
             AZ_PROFILE_SCOPE(RPI, "Scene: RebuildPipelineStatesLookup");
@@ -1152,6 +1190,9 @@ namespace AZ
                 }
             }
             m_pipelineStatesLookupNeedsRebuild = false;
+
+            // The cached draw items were configured with the old pipeline states
+            m_meshDrawPacketCache->Clear();
             SceneNotificationBus::Event(m_id, &SceneNotification::OnPipelineStateLookupRebuilt);
         }
 
@@ -152,6 +152,7 @@ namespace AZ
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
                 m_shaderVariants.clear();
             }
+            m_variantSearchCache.Clear();
             auto rootShaderVariantAsset = shaderAsset.GetRootVariantAsset(m_supervariantIndex);
             m_rootVariant.Init(m_asset, rootShaderVariantAsset, m_supervariantIndex);
 
@@ -456,7 +457,15 @@ namespace AZ
 
         ShaderVariantSearchResult Shader::FindVariantStableId(const ShaderVariantId& shaderVariantId) const
         {
+            // Read the generation first, a result searched in a tree that is replaced meanwhile is then never returned from the cache.
+            const uint32_t variantTreeGeneration = m_asset->GetVariantTreeGeneration();
+            if (AZStd::optional<ShaderVariantSearchResult> cachedResult = m_variantSearchCache.Find(shaderVariantId, variantTreeGeneration))
+            {
+                return *cachedResult;
+            }
+
             ShaderVariantSearchResult variantSearchResult = m_asset->FindVariantStableId(shaderVariantId);
+            m_variantSearchCache.Insert(shaderVariantId, variantTreeGeneration, variantSearchResult);
             return variantSearchResult;
         }
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/ShaderVariantSearchCache.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            //! Only generations with the lowest bit set had a variant tree, see ShaderAsset::GetVariantTreeGeneration().
+            bool IsCacheableGeneration(uint32_t variantTreeGeneration)
+            {
+                return (variantTreeGeneration & 1) != 0;
+            }
+        }
+
+        ShaderVariantSearchCache::~ShaderVariantSearchCache()
+        {
+            delete[] m_slots.load(AZStd::memory_order_acquire);
+        }
+
+        AZStd::optional<ShaderVariantSearchResult> ShaderVariantSearchCache::Find(
+            const ShaderVariantId& shaderVariantId, uint32_t variantTreeGeneration) const
+        {
+            const Slot* slots = m_slots.load(AZStd::memory_order_acquire);
+            if (!slots || !IsCacheableGeneration(variantTreeGeneration))
+            {
+                return AZStd::nullopt;
+            }
+
+            const uint32_t epoch = m_epoch.load(AZStd::memory_order_acquire);
+            const KeyWords keyWords = GetKeyWords(shaderVariantId);
+            const uint64_t hash = GetHash(keyWords);
+
+            for (uint32_t probe = 0; probe < MaxProbeCount; ++probe)
+            {
+                const Slot& slot = slots[(hash + probe) % SlotCount];
+                const uint32_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+                if (sequence == 0)
+                {
+                    // Inserts use the first free slot, so the key can't be further along.
+                    break;
+                }
+                if (sequence & 1)
+                {
+                    continue;
+                }
+
+                bool isMatch = slot.m_epoch.load(AZStd::memory_order_relaxed) == epoch &&
+                    slot.m_variantTreeGeneration.load(AZStd::memory_order_relaxed) == variantTreeGeneration;
+                for (uint32_t wordIndex = 0; wordIndex < KeyWordCount; ++wordIndex)
+                {
+                    isMatch &= slot.m_keyWords[wordIndex].load(AZStd::memory_order_relaxed) == keyWords[wordIndex];
+                }
+                const uint32_t stableId = slot.m_stableId.load(AZStd::memory_order_relaxed);
+                const uint32_t dynamicOptionCount = slot.m_dynamicOptionCount.load(AZStd::memory_order_relaxed);
+
+                // If the slot was rewritten while it was read the values may be torn, skip it.
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if (slot.m_sequence.load(AZStd::memory_order_relaxed) != sequence)
+                {
+                    continue;
+                }
+
+                if (isMatch)
+                {
+                    return ShaderVariantSearchResult{ ShaderVariantStableId{ stableId }, dynamicOptionCount };
+                }
+            }
+            return AZStd::nullopt;
+        }
+
+        void ShaderVariantSearchCache::Insert(
+            const ShaderVariantId& shaderVariantId, uint32_t variantTreeGeneration, const ShaderVariantSearchResult& searchResult)
+        {
+            if (!IsCacheableGeneration(variantTreeGeneration))
+            {
+                return;
+            }
+
+            Slot* slots = GetOrCreateSlots();
+            const uint32_t epoch = m_epoch.load(AZStd::memory_order_acquire);
+            const KeyWords keyWords = GetKeyWords(shaderVariantId);
+            const uint64_t hash = GetHash(keyWords);
+
+            // Take the first slot that is unused or holds an outdated entry, otherwise evict one of the probed slots.
+            Slot* targetSlot = &slots[(hash + (hash >> 32) % MaxProbeCount) % SlotCount];
+            for (uint32_t probe = 0; probe < MaxProbeCount; ++probe)
+            {
+                Slot& slot = slots[(hash + probe) % SlotCount];
+                const uint32_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+                if (sequence & 1)
+                {
+                    continue;
+                }
+
+                const bool isCurrent = sequence != 0 && slot.m_epoch.load(AZStd::memory_order_relaxed) == epoch &&
+                    slot.m_variantTreeGeneration.load(AZStd::memory_order_relaxed) == variantTreeGeneration;
+                if (!isCurrent)
+                {
+                    targetSlot = &slot;
+                    break;
+                }
+
+                bool isSameKey = true;
+                for (uint32_t wordIndex = 0; wordIndex < KeyWordCount; ++wordIndex)
+                {
+                    isSameKey &= slot.m_keyWords[wordIndex].load(AZStd::memory_order_relaxed) == keyWords[wordIndex];
+                }
+                if (isSameKey)
+                {
+                    // Another thread got there first.
+                    return;
+                }
+            }
+
+            uint32_t sequence = targetSlot->m_sequence.load(AZStd::memory_order_relaxed);
+            if ((sequence & 1) || !targetSlot->m_sequence.compare_exchange_strong(sequence, sequence + 1, AZStd::memory_order_acquire))
+            {
+                // Someone else is writing this slot. Dropping the insert is fine, the next miss will insert it again.
+                return;
+            }
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+
+            targetSlot->m_epoch.store(epoch, AZStd::memory_order_relaxed);
+            targetSlot->m_variantTreeGeneration.store(variantTreeGeneration, AZStd::memory_order_relaxed);
+            for (uint32_t wordIndex = 0; wordIndex < KeyWordCount; ++wordIndex)
+            {
+                targetSlot->m_keyWords[wordIndex].store(keyWords[wordIndex], AZStd::memory_order_relaxed);
+            }
+            targetSlot->m_stableId.store(searchResult.GetStableId().GetIndex(), AZStd::memory_order_relaxed);
+            targetSlot->m_dynamicOptionCount.store(searchResult.GetDynamicOptionCount(), AZStd::memory_order_relaxed);
+
+            // Zero is reserved for slots that were never written.
+            const uint32_t nextSequence = sequence + 2;
+            targetSlot->m_sequence.store(nextSequence != 0 ? nextSequence : 2, AZStd::memory_order_release);
+        }
+
+        void ShaderVariantSearchCache::Clear()
+        {
+            m_epoch.fetch_add(1, AZStd::memory_order_acq_rel);
+        }
+
+        ShaderVariantSearchCache::KeyWords ShaderVariantSearchCache::GetKeyWords(const ShaderVariantId& shaderVariantId)
+        {
+            const ShaderVariantKey maskedKey = shaderVariantId.m_key & shaderVariantId.m_mask;
+            constexpr uint32_t WordsPerKey = KeyWordCount / 2;
+
+            KeyWords keyWords;
+            for (uint32_t wordIndex = 0; wordIndex < WordsPerKey; ++wordIndex)
+            {
+                keyWords[wordIndex] = maskedKey.data()[wordIndex];
+                keyWords[WordsPerKey + wordIndex] = shaderVariantId.m_mask.data()[wordIndex];
+            }
+            return keyWords;
+        }
+
+        uint64_t ShaderVariantSearchCache::GetHash(const KeyWords& keyWords)
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (uint32_t word : keyWords)
+            {
+                hash = (hash ^ word) * 0x100000001b3ull;
+            }
+            return hash ^ (hash >> 29);
+        }
+
+        ShaderVariantSearchCache::Slot* ShaderVariantSearchCache::GetOrCreateSlots()
+        {
+            Slot* slots = m_slots.load(AZStd::memory_order_acquire);
+            if (!slots)
+            {
+                Slot* newSlots = new Slot[SlotCount];
+                if (m_slots.compare_exchange_strong(slots, newSlots, AZStd::memory_order_acq_rel))
+                {
+                    slots = newSlots;
+                }
+                else
+                {
+                    // Another thread allocated the slots first, slots now points to them.
+                    delete[] newSlots;
+                }
+            }
+            return slots;
+        }
+    } // namespace RPI
+} // namespace AZ
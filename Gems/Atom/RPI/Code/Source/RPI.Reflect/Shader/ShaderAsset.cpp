@@ -237,10 +237,22 @@ namespace AZ
                     // The variant tree could be under construction or simply doesn't exist at all.
                     return variantSearchResult;
                 }
+                UpdateVariantTreeGeneration();
             }
             return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
         }
 
+        uint32_t ShaderAsset::GetVariantTreeGeneration() const
+        {
+            return m_variantTreeGeneration.load(AZStd::memory_order_acquire);
+        }
+
+        void ShaderAsset::UpdateVariantTreeGeneration()
+        {
+            const uint32_t generation = (m_variantTreeGeneration.load(AZStd::memory_order_relaxed) | 1) + 1;
+            m_variantTreeGeneration.store(m_shaderVariantTree ? (generation | 1) : generation, AZStd::memory_order_release);
+        }
+
         Data::Asset<ShaderVariantAsset> ShaderAsset::GetVariantAsset(
             ShaderVariantStableId shaderVariantStableId, SupervariantIndex supervariantIndex) const
         {
@@ -630,6 +642,7 @@ namespace AZ
             {
                 m_shaderVariantTree = shaderVariantTreeAsset;
             }
+            UpdateVariantTreeGeneration();
             lock.unlock();
         }
 
@@ -25,13 +25,16 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<ShaderVariantTreeAsset, AZ::Data::AssetData>()
-                    ->Version(1)
+                    ->Version(2) // Added the flat lookup
                     ->Field("ShaderHash", &ShaderVariantTreeAsset::m_shaderHash)
                     ->Field("Nodes", &ShaderVariantTreeAsset::m_nodes)
+                    ->Field("FlatLookupSeeds", &ShaderVariantTreeAsset::m_flatLookupSeeds)
+                    ->Field("FlatLookupEntries", &ShaderVariantTreeAsset::m_flatLookupEntries)
                     ;
             }
 
             ShaderVariantTreeNode::Reflect(context);
+            ShaderVariantTreeFlatEntry::Reflect(context);
         }
 
         Data::AssetId ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(const Data::AssetId& shaderAssetId)
@@ -72,6 +75,11 @@ namespace AZ
 
         ShaderVariantSearchResult ShaderVariantTreeAsset::FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const
         {
+            if (AZStd::optional<ShaderVariantSearchResult> exactResult = FindExactVariantStableId(shaderVariantId))
+            {
+                return *exactResult;
+            }
+
             struct NodeToVisit
             {
                 uint32_t m_branchCount; // Number of static branches
@@ -171,6 +179,40 @@ namespace AZ
             return ShaderVariantSearchResult{ bestFitStableId, optionCount - totalBranchCount };
         }
 
+        AZStd::optional<ShaderVariantSearchResult> ShaderVariantTreeAsset::FindExactVariantStableId(const ShaderVariantId& shaderVariantId) const
+        {
+            // The root variant is not in the flat lookup, and unused entries have an empty id.
+            if (m_flatLookupEntries.empty() || shaderVariantId.IsEmpty())
+            {
+                return AZStd::nullopt;
+            }
+
+            const uint64_t bucketIndex = HashShaderVariantId(shaderVariantId, 0) % m_flatLookupSeeds.size();
+            const uint64_t entryIndex = HashShaderVariantId(shaderVariantId, m_flatLookupSeeds[bucketIndex]) % m_flatLookupEntries.size();
+            const ShaderVariantTreeFlatEntry& entry = m_flatLookupEntries[entryIndex];
+            if (entry.m_shaderVariantId != shaderVariantId)
+            {
+                return AZStd::nullopt;
+            }
+            return ShaderVariantSearchResult{ entry.m_stableId, entry.m_dynamicOptionCount };
+        }
+
+        uint64_t ShaderVariantTreeAsset::HashShaderVariantId(const ShaderVariantId& shaderVariantId, uint32_t seed)
+        {
+            const ShaderVariantKey maskedKey = shaderVariantId.m_key & shaderVariantId.m_mask;
+
+            // FNV-1a over the words, followed by the splitmix64 finalizer so the low bits used by the modulo are well mixed.
+            uint64_t hash = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+            for (size_t wordIndex = 0; wordIndex < maskedKey.num_words(); ++wordIndex)
+            {
+                hash = (hash ^ maskedKey.data()[wordIndex]) * 0x100000001b3ull;
+                hash = (hash ^ shaderVariantId.m_mask.data()[wordIndex]) * 0x100000001b3ull;
+            }
+            hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+            hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+            return hash ^ (hash >> 31);
+        }
+
         const ShaderVariantTreeNode& ShaderVariantTreeAsset::GetNode(uint32_t index) const
         {
             AZ_Assert(index < m_nodes.size(), "Invalid Node Index");
@@ -259,6 +301,19 @@ namespace AZ
             }
         }
 
+        void ShaderVariantTreeFlatEntry::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantTreeFlatEntry>()
+                    ->Version(0)
+                    ->Field("ShaderVariantId", &ShaderVariantTreeFlatEntry::m_shaderVariantId)
+                    ->Field("StableId", &ShaderVariantTreeFlatEntry::m_stableId)
+                    ->Field("DynamicOptionCount", &ShaderVariantTreeFlatEntry::m_dynamicOptionCount)
+                    ;
+            }
+        }
+
         ShaderVariantTreeNode::ShaderVariantTreeNode()
             : m_stableId(ShaderVariantStableId{ ShaderVariantTreeAsset::UnspecifiedIndex })
             , m_offset(0)
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/FrameGraphAttachmentDatabase.h>
+#include <Atom/RHI/FrameGraphBuilder.h>
+
+namespace UnitTest
+{
+    //! Frame graph builder for the stub RHI, used to run PassSystem::FrameUpdate without a frame scheduler.
+    //! Attachments go to a local database and scope producers are ignored.
+    class FrameGraphBuilderStub final
+        : public AZ::RHI::FrameGraphBuilder
+    {
+    public:
+        AZ::RHI::FrameGraphAttachmentInterface GetAttachmentDatabase() override
+        {
+            return AZ::RHI::FrameGraphAttachmentInterface(m_attachmentDatabase);
+        }
+
+        AZ::RHI::ResultCode ImportScopeProducer([[maybe_unused]] AZ::RHI::ScopeProducer& scopeProducer) override
+        {
+            return AZ::RHI::ResultCode::Success;
+        }
+
+        void Clear()
+        {
+            m_attachmentDatabase.Clear();
+        }
+
+    private:
+        AZ::RHI::FrameGraphAttachmentDatabase m_attachmentDatabase;
+    };
+} // namespace UnitTest
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/MeshDrawPacketCache.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class MeshDrawPacketCacheTests
+        : public RPITestFixture
+    {
+    protected:
+        //! The cache only compares the model and material addresses, so the key doesn't need real instances
+        MeshDrawPacketCacheKey CreateKey(uintptr_t material)
+        {
+            MeshDrawPacketCacheKey key;
+            key.m_modelLod = reinterpret_cast<const ModelLod*>(uintptr_t{ 0x1000 });
+            key.m_modelLodMeshIndex = 2;
+            key.m_material = reinterpret_cast<const Material*>(material);
+            key.m_materialChangeId = 5;
+            key.m_shaderOptions = { { Name("o_enableShadows"), ShaderOptionValue(1) }, { Name("o_quality"), ShaderOptionValue(3) } };
+            key.m_materialModelUvMap = { { RHI::ShaderSemantic(Name("UV"), 0), Name("UV0") }, { RHI::ShaderSemantic(Name("UV"), 1), Name("Lightmap") } };
+            key.m_drawListFilter.set();
+            key.m_sortKey = 7;
+            key.m_stencilRef = 1;
+            return key;
+        }
+    };
+
+    TEST_F(MeshDrawPacketCacheTests, Key_EqualSettings_MatchAndHashEqual)
+    {
+        const MeshDrawPacketCacheKey key = CreateKey(0x2000);
+        MeshDrawPacketCacheKey sameKey = CreateKey(0x2000);
+        // The uv map is unordered, so its insertion order must not change the hash
+        sameKey.m_materialModelUvMap.clear();
+        sameKey.m_materialModelUvMap.emplace(RHI::ShaderSemantic(Name("UV"), 1), Name("Lightmap"));
+        sameKey.m_materialModelUvMap.emplace(RHI::ShaderSemantic(Name("UV"), 0), Name("UV0"));
+
+        EXPECT_TRUE(key == sameKey);
+        EXPECT_EQ(key.GetHash(), sameKey.GetHash());
+    }
+
+    TEST_F(MeshDrawPacketCacheTests, Key_AnyDifferentSetting_DoesNotMatch)
+    {
+        const MeshDrawPacketCacheKey key = CreateKey(0x2000);
+
+        AZStd::vector<MeshDrawPacketCacheKey> differentKeys(10, key);
+        differentKeys[0].m_modelLod = reinterpret_cast<const ModelLod*>(uintptr_t{ 0x1100 });
+        differentKeys[1].m_modelLodMeshIndex = 3;
+        differentKeys[2].m_material = reinterpret_cast<const Material*>(uintptr_t{ 0x2100 });
+        differentKeys[3].m_materialChangeId = 6;
+        differentKeys[4].m_shaderOptions[1].second = ShaderOptionValue(2);
+        differentKeys[5].m_materialModelUvMap.erase(RHI::ShaderSemantic(Name("UV"), 1));
+        differentKeys[6].m_drawListFilter.reset(4);
+        differentKeys[7].m_stencilRef = 0;
+        differentKeys[8].m_forceRootShaderVariant = true;
+        differentKeys[9].m_sortKey = 8;
+
+        for (const MeshDrawPacketCacheKey& differentKey : differentKeys)
+        {
+            EXPECT_FALSE(key == differentKey);
+        }
+    }
+
+    TEST_F(MeshDrawPacketCacheTests, Find_AfterInsert_ReturnsSharedData)
+    {
+        MeshDrawPacketCache cache;
+        EXPECT_EQ(cache.Find(CreateKey(0x2000)), nullptr);
+
+        Ptr<MeshDrawPacket::SharedData> sharedData = aznew MeshDrawPacket::SharedData();
+        cache.Insert(CreateKey(0x2000), sharedData);
+        EXPECT_EQ(cache.Find(CreateKey(0x2000)), sharedData);
+        EXPECT_EQ(cache.Find(CreateKey(0x3000)), nullptr);
+
+        Ptr<MeshDrawPacket::SharedData> rebuiltData = aznew MeshDrawPacket::SharedData();
+        cache.Insert(CreateKey(0x2000), rebuiltData);
+        EXPECT_EQ(cache.Find(CreateKey(0x2000)), rebuiltData);
+        EXPECT_EQ(cache.GetEntryCount(), 1u);
+    }
+
+    TEST_F(MeshDrawPacketCacheTests, RemoveUnused_KeepsDataThatIsStillReferenced)
+    {
+        MeshDrawPacketCache cache;
+        Ptr<MeshDrawPacket::SharedData> usedData = aznew MeshDrawPacket::SharedData();
+        cache.Insert(CreateKey(0x2000), usedData);
+        cache.Insert(CreateKey(0x3000), aznew MeshDrawPacket::SharedData());
+
+        cache.RemoveUnused();
+        EXPECT_EQ(cache.GetEntryCount(), 1u);
+        EXPECT_EQ(cache.Find(CreateKey(0x2000)), usedData);
+
+        cache.Clear();
+        EXPECT_EQ(cache.GetEntryCount(), 0u);
+        EXPECT_EQ(usedData->use_count(), 1u);
+    }
+} // namespace UnitTest
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <Atom/RHI/DrawList.h>
+
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/Pass.h>
+#include <Atom/RPI.Public/Pass/PassSystem.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#include <Common/FrameGraphBuilderStub.h>
+#include <Common/RPITestFixture.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace PassSystemBenchmarkUtils
+    {
+        constexpr size_t PassesPerParent = 64;
+        constexpr size_t DrawItemsPerPass = 256;
+
+        //! Pass that copies and sorts a draw list every frame, like a raster pass does with the draw lists of its view.
+        //! The sort either runs in FrameBeginInternal (the serial tree walk) or in FrameBeginParallelInternal.
+        class DrawListSortPass final
+            : public Pass
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(DrawListSortPass, SystemAllocator);
+
+            DrawListSortPass(const PassDescriptor& descriptor, bool sortInParallel, uint32_t seed)
+                : Pass(descriptor)
+                , m_sortInParallel(sortInParallel)
+            {
+                // The draw item pointers are never dereferenced by the sort, they only need distinct addresses
+                SimpleLcgRandom random(seed);
+                m_unsortedDrawList.resize(DrawItemsPerPass);
+                for (RHI::DrawItemProperties& item : m_unsortedDrawList)
+                {
+                    item.m_item = reinterpret_cast<const RHI::DrawItem*>(static_cast<uintptr_t>((random.GetRandom() % 4096 + 1) * 16));
+                    item.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16);
+                    item.m_depth = random.GetRandomFloat() * 100.0f;
+                }
+            }
+
+        protected:
+            void FrameBeginInternal([[maybe_unused]] FramePrepareParams params) override
+            {
+                if (!m_sortInParallel)
+                {
+                    UpdateDrawList();
+                }
+            }
+
+            void FrameBeginParallelInternal() override
+            {
+                if (m_sortInParallel)
+                {
+                    UpdateDrawList();
+                }
+            }
+
+        private:
+            void UpdateDrawList()
+            {
+                m_drawList = m_unsortedDrawList;
+                SortDrawList(m_drawList);
+            }
+
+            bool m_sortInParallel = false;
+            RHI::DrawList m_unsortedDrawList;
+            RHI::DrawList m_drawList;
+        };
+
+        //! RPITestFixture is a gtest fixture, this exposes its set up and tear down to the benchmark fixture
+        class PassSystemBenchmarkEnvironment
+            : public UnitTest::RPITestFixture
+        {
+        public:
+            void SetUpEnvironment()
+            {
+                SetUp();
+            }
+
+            void TearDownEnvironment()
+            {
+                TearDown();
+            }
+
+        protected:
+            void TestBody() override
+            {
+            }
+        };
+    } // namespace PassSystemBenchmarkUtils
+
+    //! Runs PassSystem::FrameUpdate and FrameEnd on a synthetic tree of state.range(0) passes without a render pipeline,
+    //! grouped under parent passes like the subtrees of a pipeline. state.range(1) selects whether the per pass work
+    //! runs in the parallel stage or in the serial tree walk.
+    class PassSystemFrameUpdateBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        void RunFrames(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_passSystem->FrameUpdate(m_frameGraphBuilder);
+                m_passSystem->FrameEnd();
+                m_frameGraphBuilder.Clear();
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+    private:
+        void internalSetUp(const benchmark::State& state)
+        {
+            using namespace PassSystemBenchmarkUtils;
+
+            m_environment = AZStd::make_unique<PassSystemBenchmarkEnvironment>();
+            m_environment->SetUpEnvironment();
+            m_passSystem = azrtti_cast<PassSystem*>(PassSystemInterface::Get());
+
+            const size_t passCount = aznumeric_cast<size_t>(state.range(0));
+            const bool sortInParallel = state.range(1) != 0;
+            for (size_t parentIndex = 0; parentIndex * PassesPerParent < passCount; ++parentIndex)
+            {
+                Ptr<ParentPass> parentPass = ParentPass::Create(PassDescriptor(Name(AZStd::string::format("Parent%zu", parentIndex))));
+                m_passSystem->AddPassWithoutPipeline(parentPass);
+
+                const size_t passIndexEnd = AZStd::min(passCount, (parentIndex + 1) * PassesPerParent);
+                for (size_t passIndex = parentIndex * PassesPerParent; passIndex < passIndexEnd; ++passIndex)
+                {
+                    Ptr<Pass> pass = aznew DrawListSortPass(
+                        PassDescriptor(Name(AZStd::string::format("Pass%zu", passIndex))), sortInParallel, static_cast<uint32_t>(passIndex + 1));
+                    parentPass->AddChild(pass, true);
+                }
+            }
+            m_passSystem->ProcessQueuedChanges();
+        }
+
+        void internalTearDown()
+        {
+            m_passSystem = nullptr;
+            m_frameGraphBuilder.Clear();
+            m_environment->TearDownEnvironment();
+            m_environment.reset();
+        }
+
+        AZStd::unique_ptr<PassSystemBenchmarkUtils::PassSystemBenchmarkEnvironment> m_environment;
+        UnitTest::FrameGraphBuilderStub m_frameGraphBuilder;
+        PassSystem* m_passSystem = nullptr;
+    };
+
+    static void PassSystemFrameUpdateArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t passCount : { 256, 1024, 4096 })
+        {
+            for (int64_t sortInParallel : { 0, 1 })
+            {
+                benchmark->Args({ passCount, sortInParallel });
+            }
+        }
+        benchmark->ArgNames({ "Passes", "Parallel" });
+        benchmark->Unit(benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_DEFINE_F(PassSystemFrameUpdateBenchmarkFixture, FrameUpdate_DrawListSortPasses)(benchmark::State& state)
+    {
+        RunFrames(state);
+    }
+    BENCHMARK_REGISTER_F(PassSystemFrameUpdateBenchmarkFixture, FrameUpdate_DrawListSortPasses)->Apply(PassSystemFrameUpdateArguments);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
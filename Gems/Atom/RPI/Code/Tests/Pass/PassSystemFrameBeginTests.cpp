@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RHI/DrawItem.h>
+#include <Atom/RHI/DrawList.h>
+
+#include <Atom/RPI.Public/Pass/PassSystem.h>
+#include <Atom/RPI.Public/Pass/RasterPass.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+#include <Atom/RPI.Reflect/Pass/PassTemplate.h>
+#include <Atom/RPI.Reflect/Pass/RasterPassData.h>
+
+#include <AzCore/Math/Random.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Common/FrameGraphBuilderStub.h>
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    //! Runs PassSystem::FrameUpdate on raster passes with r_passSystemParallelFrameBegin on and off,
+    //! and checks that building the draw lists in the parallel stage gives the same result as the serial walk.
+    class PassSystemFrameBeginTests
+        : public RPITestFixture
+    {
+    protected:
+        //! Raster pass that exposes the draw list it builds during FrameBegin
+        class TestRasterPass final
+            : public RasterPass
+        {
+        public:
+            AZ_RTTI(TestRasterPass, "{9C244275-AD56-4CB4-97D0-160A144FC45F}", RasterPass);
+            AZ_CLASS_ALLOCATOR(TestRasterPass, SystemAllocator);
+
+            explicit TestRasterPass(const PassDescriptor& descriptor)
+                : RasterPass(descriptor)
+            {
+            }
+
+            RHI::DrawListView GetDrawListView() const
+            {
+                return m_drawListView;
+            }
+        };
+
+        //! What the passes of the pipeline built in one frame
+        struct FrameResult
+        {
+            AZStd::vector<RHI::DrawList> m_drawLists;
+            AZStd::vector<uint32_t> m_drawItemCounts;
+            PassSystemFrameStatistics m_statistics;
+        };
+
+        static constexpr const char* DrawListNames[] = { "forward", "depth", "transparent", "shadow" };
+        static constexpr size_t DrawItemsPerList = 24;
+
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            m_passSystem = azrtti_cast<PassSystem*>(PassSystemInterface::Get());
+            m_viewTag = PipelineViewTag("MainCamera");
+
+            m_scene = Scene::CreateScene(SceneDescriptor());
+            m_scene->Activate();
+
+            RenderPipelineDescriptor pipelineDesc;
+            pipelineDesc.m_name = "ParallelFrameBeginPipeline";
+            pipelineDesc.m_mainViewTagName = m_viewTag.GetCStr();
+            m_pipeline = RenderPipeline::CreateRenderPipeline(pipelineDesc);
+            m_scene->AddRenderPipeline(m_pipeline);
+
+            for (const char* drawListName : DrawListNames)
+            {
+                AZStd::shared_ptr<RasterPassData> passData = AZStd::make_shared<RasterPassData>();
+                passData->m_drawListTag = Name(drawListName);
+                passData->m_pipelineViewTag = m_viewTag.GetCStr();
+                AZStd::shared_ptr<PassTemplate> passTemplate = AZStd::make_shared<PassTemplate>();
+                passTemplate->m_passData = passData;
+
+                PassDescriptor passDesc;
+                passDesc.m_passName = Name(drawListName);
+                passDesc.m_passTemplate = passTemplate;
+                Ptr<TestRasterPass> pass = aznew TestRasterPass(passDesc);
+                m_pipeline->GetRootPass()->AddChild(pass, true);
+                m_passes.push_back(pass);
+            }
+            m_pipeline->UpdatePasses();
+
+            m_view = View::CreateView(Name("ParallelFrameBeginView"), View::UsageCamera);
+            m_pipeline->SetPersistentView(m_viewTag, m_view);
+
+            RHI::DrawListMask drawListMask;
+            for (const Ptr<TestRasterPass>& pass : m_passes)
+            {
+                drawListMask.set(pass->GetDrawListTag().GetIndex());
+            }
+            m_view->SetDrawListMask(drawListMask);
+
+            // Every pass gets a different number of draw items so a list ending up on the wrong pass is caught
+            SimpleLcgRandom random(7);
+            m_drawItems.reserve(DrawItemsPerList * m_passes.size() * (m_passes.size() + 1) / 2);
+            for (size_t passIndex = 0; passIndex < m_passes.size(); ++passIndex)
+            {
+                for (size_t itemIndex = 0; itemIndex < DrawItemsPerList * (passIndex + 1); ++itemIndex)
+                {
+                    m_drawItems.emplace_back(RHI::MultiDevice::AllDevices);
+
+                    RHI::DrawItemProperties drawItemProperties;
+                    drawItemProperties.m_item = &m_drawItems.back();
+                    drawItemProperties.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 8);
+                    drawItemProperties.m_depth = random.GetRandomFloat() * 100.0f;
+                    m_view->AddDrawItem(m_passes[passIndex]->GetDrawListTag(), drawItemProperties);
+                }
+            }
+            m_view->FinalizeDrawListsJob(nullptr);
+        }
+
+        void TearDown() override
+        {
+            r_passSystemParallelFrameBegin = true;
+
+            m_passes.clear();
+            m_view = nullptr;
+            m_scene->RemoveRenderPipeline(m_pipeline->GetId());
+            m_pipeline = nullptr;
+            m_scene->Deactivate();
+            m_scene = nullptr;
+            m_drawItems.clear();
+            m_frameGraphBuilder.Clear();
+            m_viewTag = PipelineViewTag();
+            m_passSystem = nullptr;
+
+            RPITestFixture::TearDown();
+        }
+
+        FrameResult RunFrame(bool parallelFrameBegin)
+        {
+            r_passSystemParallelFrameBegin = parallelFrameBegin;
+
+            FrameResult result;
+            m_passSystem->FrameUpdate(m_frameGraphBuilder);
+            for (const Ptr<TestRasterPass>& pass : m_passes)
+            {
+                RHI::DrawListView drawListView = pass->GetDrawListView();
+                result.m_drawLists.emplace_back(drawListView.begin(), drawListView.end());
+                result.m_drawItemCounts.push_back(pass->GetDrawItemCount());
+            }
+            result.m_statistics = m_passSystem->GetFrameStatistics();
+            m_passSystem->FrameEnd();
+            m_frameGraphBuilder.Clear();
+
+            return result;
+        }
+
+        static void ExpectSameFrameResult(const FrameResult& expected, const FrameResult& actual)
+        {
+            ASSERT_EQ(expected.m_drawLists.size(), actual.m_drawLists.size());
+            for (size_t passIndex = 0; passIndex < expected.m_drawLists.size(); ++passIndex)
+            {
+                EXPECT_TRUE(expected.m_drawLists[passIndex] == actual.m_drawLists[passIndex]) << "Draw list of pass " << passIndex;
+            }
+            EXPECT_EQ(expected.m_drawItemCounts, actual.m_drawItemCounts);
+            EXPECT_EQ(expected.m_statistics.m_numRenderPassesExecuted, actual.m_statistics.m_numRenderPassesExecuted);
+            EXPECT_EQ(expected.m_statistics.m_totalDrawItemsRendered, actual.m_statistics.m_totalDrawItemsRendered);
+            EXPECT_EQ(expected.m_statistics.m_maxDrawItemsRenderedInAPass, actual.m_statistics.m_maxDrawItemsRenderedInAPass);
+        }
+
+        PipelineViewTag m_viewTag;
+        PassSystem* m_passSystem = nullptr;
+        ScenePtr m_scene;
+        RenderPipelinePtr m_pipeline;
+        ViewPtr m_view;
+        AZStd::vector<Ptr<TestRasterPass>> m_passes;
+        AZStd::vector<RHI::DrawItem> m_drawItems;
+        FrameGraphBuilderStub m_frameGraphBuilder;
+    };
+
+    TEST_F(PassSystemFrameBeginTests, ParallelFrameBegin_MatchesSerialFrameBegin)
+    {
+        const FrameResult serialResult = RunFrame(false);
+
+        // Sanity check that the passes picked up the view's draw lists at all
+        uint32_t expectedTotal = 0;
+        for (size_t passIndex = 0; passIndex < m_passes.size(); ++passIndex)
+        {
+            const uint32_t expectedCount = static_cast<uint32_t>(DrawItemsPerList * (passIndex + 1));
+            EXPECT_EQ(serialResult.m_drawItemCounts[passIndex], expectedCount);
+            EXPECT_EQ(serialResult.m_drawLists[passIndex].size(), expectedCount);
+            expectedTotal += expectedCount;
+        }
+        EXPECT_EQ(serialResult.m_statistics.m_numRenderPassesExecuted, m_passes.size());
+        EXPECT_EQ(serialResult.m_statistics.m_totalDrawItemsRendered, expectedTotal);
+
+        const FrameResult parallelResult = RunFrame(true);
+        ExpectSameFrameResult(serialResult, parallelResult);
+
+        // Switching back restores the serial path, which must not reuse the state of the parallel frame
+        const FrameResult serialAgainResult = RunFrame(false);
+        ExpectSameFrameResult(serialResult, serialAgainResult);
+    }
+
+    TEST_F(PassSystemFrameBeginTests, ParallelFrameBegin_DisabledPass_IsSkippedLikeSerial)
+    {
+        m_passes[1]->SetEnabled(false);
+        m_pipeline->UpdatePasses();
+
+        const FrameResult serialResult = RunFrame(false);
+        EXPECT_EQ(serialResult.m_statistics.m_numRenderPassesExecuted, m_passes.size() - 1);
+
+        const FrameResult parallelResult = RunFrame(true);
+        ExpectSameFrameResult(serialResult, parallelResult);
+    }
+} // namespace UnitTest
@@ -1959,6 +1959,76 @@ namespace UnitTest
         EXPECT_EQ(resultG.GetStableId().GetIndex(), stableId5);
     }
 
+    TEST_F(ShaderTests, ShaderVariantTreeAsset_FlatLookup_MatchesTreeSearch)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        auto shaderAsset = CreateShaderAsset();
+        auto shaderVariantTreeAsset = CreateShaderVariantTreeAssetForSearch(shaderAsset);
+
+        RPI::ShaderOptionGroup shaderOptionGroup(m_shaderOptionGroupLayoutForVariants);
+
+        // The root is never in the flat lookup
+        EXPECT_FALSE(shaderVariantTreeAsset->FindExactVariantStableId(shaderOptionGroup.GetShaderVariantId()).has_value());
+
+        // Index 4 - [Fuchsia, Quality::Auto, 50, Off]
+        shaderOptionGroup.SetValue(Name("Color"), Name("Fuchsia"));
+        shaderOptionGroup.SetValue(Name("Quality"), Name("Quality::Auto"));
+        shaderOptionGroup.SetValue(Name("NumberSamples"), Name("50"));
+        shaderOptionGroup.SetValue(Name("Raytracing"), Name("Off"));
+        auto exactResult = shaderVariantTreeAsset->FindExactVariantStableId(shaderOptionGroup.GetShaderVariantId());
+        ASSERT_TRUE(exactResult.has_value());
+        EXPECT_EQ(exactResult->GetStableId().GetIndex(), 4u);
+        EXPECT_TRUE(exactResult->IsFullyBaked());
+
+        // Index 6 - [Teal]
+        shaderOptionGroup.Clear();
+        shaderOptionGroup.SetValue(Name("Color"), Name("Teal"));
+        exactResult = shaderVariantTreeAsset->FindExactVariantStableId(shaderOptionGroup.GetShaderVariantId());
+        ASSERT_TRUE(exactResult.has_value());
+        EXPECT_EQ(exactResult->GetStableId().GetIndex(), 6u);
+        EXPECT_FALSE(exactResult->IsFullyBaked());
+
+        // [Teal, Quality::Poor] is not in the tree, only the tree search can find its best fit
+        shaderOptionGroup.SetValue(Name("Quality"), Name("Quality::Poor"));
+        EXPECT_FALSE(shaderVariantTreeAsset->FindExactVariantStableId(shaderOptionGroup.GetShaderVariantId()).has_value());
+        EXPECT_EQ(shaderVariantTreeAsset->FindVariantStableId(shaderAsset->GetShaderOptionGroupLayout(), shaderOptionGroup.GetShaderVariantId()).GetStableId().GetIndex(), 6u);
+    }
+
+    TEST_F(ShaderTests, ShaderVariantSearchCache_FindAfterInsert_ReturnsResultForSameGenerationOnly)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        RPI::ShaderOptionGroup shaderOptionGroup(m_shaderOptionGroupLayoutForVariants);
+        shaderOptionGroup.SetValue(Name("Color"), Name("Teal"));
+        const ShaderVariantId tealId = shaderOptionGroup.GetShaderVariantId();
+        shaderOptionGroup.SetValue(Name("Color"), Name("Fuchsia"));
+        const ShaderVariantId fuchsiaId = shaderOptionGroup.GetShaderVariantId();
+
+        ShaderVariantSearchCache cache;
+        const uint32_t generation = 3;
+        EXPECT_FALSE(cache.Find(tealId, generation).has_value());
+
+        cache.Insert(tealId, generation, ShaderVariantSearchResult{ ShaderVariantStableId{ 6 }, 3 });
+        auto cachedResult = cache.Find(tealId, generation);
+        ASSERT_TRUE(cachedResult.has_value());
+        EXPECT_EQ(cachedResult->GetStableId().GetIndex(), 6u);
+        EXPECT_EQ(cachedResult->GetDynamicOptionCount(), 3u);
+        EXPECT_FALSE(cache.Find(fuchsiaId, generation).has_value());
+
+        // A replaced variant tree invalidates the result
+        EXPECT_FALSE(cache.Find(tealId, generation + 2).has_value());
+
+        // Results searched without a variant tree are not cached
+        cache.Insert(fuchsiaId, generation + 1, ShaderVariantSearchResult{ ShaderVariantStableId{ 0 }, 4 });
+        EXPECT_FALSE(cache.Find(fuchsiaId, generation + 1).has_value());
+
+        cache.Clear();
+        EXPECT_FALSE(cache.Find(tealId, generation).has_value());
+    }
+
     TEST_F(ShaderTests, ShaderAsset_SpecializationConstants)
     {
         {
@@ -101,6 +101,27 @@ namespace UnitTest
             }
         }
 
+        // Culls all views with a single traversal, in the same way RPI::Scene::PrepareRender does when multi-view culling is enabled
+        void CullMultiView(TestCameraList& views)
+        {
+            m_cullingScene->BeginCulling(*m_testScene, views);
+
+            TaskGraphEvent processCullablesTGEvent{ "ProcessCullables Wait" };
+            TaskGraph processCullablesTG{ "ProcessCullables" };
+            m_cullingScene->ProcessCullablesMultiView(*m_testScene, views, nullptr, &processCullablesTG, &processCullablesTGEvent);
+            if (!processCullablesTG.IsEmpty())
+            {
+                processCullablesTG.Submit(&processCullablesTGEvent);
+                processCullablesTGEvent.Wait();
+            }
+            m_cullingScene->EndCulling(*m_testScene, views);
+
+            for (ViewPtr& viewPtr : views)
+            {
+                viewPtr->FinalizeVisibleObjectList();
+            }
+        }
+
         enum ViewIndex
         {
             YPositive = 0,
@@ -255,4 +276,24 @@ namespace UnitTest
             m_cullingScene->UnregisterCullable(object);
         }
     }
+
+    TEST_F(CullingTests, VisibleObjectListTest_MultiView_MatchesPerViewCulling)
+    {
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        CullMultiView(m_views);
+
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 4);
+        EXPECT_EQ(m_views[XNegative]->GetVisibleObjectList().size(), 3);
+        EXPECT_EQ(m_views[YNegative]->GetVisibleObjectList().size(), 2);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 1);
+
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->UnregisterCullable(object);
+        }
+    }
 }
@@ -17,6 +17,7 @@ set(FILES
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
     Include/Atom/RPI.Public/MeshDrawPacket.h
+    Include/Atom/RPI.Public/MeshDrawPacketCache.h
     Include/Atom/RPI.Public/PipelinePassChanges.h
     Include/Atom/RPI.Public/PipelineState.h
     Include/Atom/RPI.Public/RenderPipeline.h
@@ -109,6 +110,7 @@ set(FILES
     Include/Atom/RPI.Public/Shader/ShaderSystem.h
     Include/Atom/RPI.Public/Shader/ShaderSystemInterface.h
     Include/Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h
+    Include/Atom/RPI.Public/Shader/ShaderVariantSearchCache.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystem.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystemInterface.h
     Include/Atom/RPI.Public/GpuQuery/GpuQueryTypes.h
@@ -124,6 +126,7 @@ set(FILES
     Source/RPI.Public/FeatureProcessor.cpp
     Source/RPI.Public/FeatureProcessorFactory.cpp
     Source/RPI.Public/MeshDrawPacket.cpp
+    Source/RPI.Public/MeshDrawPacketCache.cpp
     Source/RPI.Public/PipelinePassChanges.cpp
     Source/RPI.Public/PipelineState.cpp
     Source/RPI.Public/RenderPipeline.cpp
@@ -197,6 +200,7 @@ set(FILES
     Source/RPI.Public/Shader/ShaderResourceGroupPool.cpp
     Source/RPI.Public/Shader/ShaderSystem.cpp
     Source/RPI.Public/Shader/ShaderVariantAsyncLoader.cpp
+    Source/RPI.Public/Shader/ShaderVariantSearchCache.cpp
     Source/RPI.Public/ColorManagement/GeneratedTransforms/ColorConversionConstants.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/LinearSrgb_To_AcesCg.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/AcesCg_To_LinearSrgb.inl
@@ -13,6 +13,7 @@ set(FILES
     Tests/Common/ErrorMessageFinder.cpp
     Tests/Common/ErrorMessageFinder.h
     Tests/Common/ErrorMessageFinderTests.cpp
+    Tests/Common/FrameGraphBuilderStub.h
     Tests/Common/JsonTestUtils.cpp
     Tests/Common/JsonTestUtils.h
     Tests/Common/RPITestFixture.cpp
@@ -37,8 +38,11 @@ set(FILES
     Tests/Material/MaterialPropertyIdTests.cpp
     Tests/Material/MaterialPropertyValueSourceDataTests.cpp
     Tests/Material/MaterialTests.cpp
+    Tests/Model/MeshDrawPacketCacheTests.cpp
     Tests/Model/ModelTests.cpp
     Tests/Model/SkinJointIdPaddingTests.cpp
+    Tests/Pass/PassSystemBenchmarks.cpp
+    Tests/Pass/PassSystemFrameBeginTests.cpp
     Tests/Pass/PassTests.cpp
     Tests/Shader/ShaderTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupBufferTests.cpp
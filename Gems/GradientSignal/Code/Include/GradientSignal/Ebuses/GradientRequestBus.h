@@ -15,6 +15,8 @@
 
 namespace GradientSignal
 {
+    class GradientProgramBuilder;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator);
@@ -75,6 +77,15 @@ namespace GradientSignal
             }
         }
 
+        /**
+         * Adds the operations that evaluate this gradient to a gradient program, so that it can be evaluated without EBus calls.
+         * The operations need to push exactly one list of values, see GradientProgramBuilder. Like GetValues, this needs to be
+         * thread-safe.
+         * \param builder The builder of the gradient program.
+         * \return False if the gradient can't be compiled, in which case the program queries it through GetValues instead.
+         */
+        virtual bool CompileGradientProgram([[maybe_unused]] GradientProgramBuilder& builder) const { return false; }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+
+namespace GradientSignal
+{
+    class GradientSampler;
+
+    //! A gradient network flattened into a linear list of operations that run over blocks of positions.
+    //! GetValues returns the same values as GradientSampler::GetValues on the root of the network, without the EBus dispatch and the
+    //! intermediate value list of every gradient in the chain. Gradients that can't be compiled are queried through
+    //! GradientRequestBus::GetValues for each block instead.
+    //! The program holds copies of the gradient settings, so its owner needs to compile it again whenever the composition of the
+    //! network changes (LmbrCentral::DependencyNotificationBus::OnCompositionChanged). It should do that on its next query rather than
+    //! in the notification, because a gradient entity that is being deactivated sends it before its gradient components disconnect.
+    class GradientProgram
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator);
+
+        //! Number of positions that each operation processes at a time.
+        static constexpr size_t BlockSize = 256;
+
+        //! Compiles the network that the sampler refers to, including the sampler settings.
+        static GradientProgram Compile(const GradientSampler& sampler);
+
+        //! Compiles the network of the gradient on the entity.
+        static GradientProgram Compile(const AZ::EntityId& gradientId);
+
+        //! Evaluates the program for a list of positions. Thread safe.
+        //! \param positions The input list of positions to query.
+        //! \param outValues The output list of values. This list is expected to be the same size as the positions list.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        bool IsEmpty() const;
+        size_t GetOperationCount() const;
+
+        //! Number of gradients in the program that are queried through the EBus.
+        size_t GetBusGradientCount() const;
+
+    private:
+        friend class GradientProgramBuilder;
+
+        enum class OperationType : AZ::u8
+        {
+            Constant,       //!< Pushes a list of values set to m_values[0].
+            BusGradient,    //!< Pushes the values of m_gradientId, queried through GradientRequestBus::GetValues.
+            PushTransform,  //!< Pushes the positions transformed by m_transforms[m_index].
+            PopTransform,   //!< Pops the transformed positions.
+            Clamp,          //!< Clamps the top values to 0-1.
+            Invert,         //!< Replaces the top values with 1 - value.
+            Scale,          //!< Multiplies the top values by m_values[0].
+            Threshold,      //!< Replaces the top values with 0 when they are <= m_values[0], and 1 otherwise.
+            Levels,         //!< Applies GetLevels to the top values, with the parameters in m_values.
+            Mix,            //!< Pops the top values and mixes them into the values below with m_mixingOperation and opacity m_values[0].
+            Function,       //!< Runs m_functions[m_index] over the top values.
+        };
+
+        struct Operation
+        {
+            OperationType m_type = OperationType::Constant;
+            MixedGradientLayer::MixingOperation m_mixingOperation = MixedGradientLayer::MixingOperation::Initialize;
+            AZ::u32 m_index = 0;
+            AZStd::array<float, 5> m_values = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+            AZ::EntityId m_gradientId;
+        };
+
+        static void Mix(
+            MixedGradientLayer::MixingOperation operation, float opacity, AZStd::span<const float> layerValues, AZStd::span<float> inOutValues);
+
+        AZStd::vector<Operation> m_operations;
+        AZStd::vector<AZ::Matrix3x4> m_transforms;
+        AZStd::vector<AZStd::function<void(AZStd::span<float>)>> m_functions;
+
+        //! Deepest stacks of value lists and transformed position lists the operations reach, which sizes the scratch buffers.
+        size_t m_maxValueDepth = 0;
+        size_t m_maxTransformDepth = 0;
+    };
+
+    //! Builds a GradientProgram. Gradients add their operations in GradientRequests::CompileGradientProgram.
+    //! The operations work on a stack of value lists: gradients push one list of values, and modifiers change the top list in place.
+    class GradientProgramBuilder
+    {
+    public:
+        //! Adds the operations of the gradient on the entity, which push one list of values.
+        //! The gradient is queried through the EBus when it doesn't compile itself.
+        void AddGradient(const AZ::EntityId& gradientId);
+
+        //! Adds the operations of the gradient that the sampler refers to, followed by the sampler transform, invert, levels and opacity.
+        void AddSampler(const GradientSampler& sampler);
+
+        void AddConstant(float value);
+        void AddClamp();
+        void AddInvert();
+        void AddScale(float scale);
+        void AddThreshold(float threshold);
+        void AddLevels(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
+
+        //! Pops the top values, which are a layer sampled with the given opacity, and mixes them into the values below the way
+        //! MixedGradientComponent blends its layers.
+        void AddMix(MixedGradientLayer::MixingOperation operation, float opacity);
+
+        //! Adds a function that changes the top values in place, for modifiers that don't have a built-in operation.
+        //! The function is called from multiple threads, so it must only use data it holds a copy of.
+        void AddFunction(AZStd::function<void(AZStd::span<float>)> function);
+
+        GradientProgram Build();
+
+    private:
+        void AddOperation(const GradientProgram::Operation& operation);
+        void PushTransform(const AZ::Matrix3x4& transform);
+        void PopTransform();
+
+        GradientProgram m_program;
+        size_t m_valueDepth = 0;
+        size_t m_transformDepth = 0;
+
+        //! Gradients being compiled, used to detect cyclic references.
+        AZStd::vector<AZ::EntityId> m_gradientStack;
+    };
+} // namespace GradientSignal
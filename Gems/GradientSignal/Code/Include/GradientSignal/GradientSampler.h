@@ -63,6 +63,8 @@ namespace GradientSignal
         bool ValidateGradientEntityId();
 
     private:
+        friend class GradientProgramBuilder;
+
         AZ::Matrix3x4 GetTransformMatrix() const;
 
         // Pass-through for UIElement attribute
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AzCore/std/containers/span.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -37,6 +39,14 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Creates the Perlin 'natural' noise factor values of a list of positions, four positions at a time with SIMD.
+        * The values match the ones of the single position version.
+        */
+        void GenerateOctaveNoise(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence,
+            float initialFrequency = 1.0f) const;
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
@@ -45,6 +55,9 @@ namespace GradientSignal
     private:
         void PrepareTable(int seed);
 
+        AZ::Simd::Vec4::FloatType GenerateNoise(
+            AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z) const;
+
         AZStd::array<int, 512> m_permutationTable;
     };
 
@@ -254,19 +254,12 @@ namespace GradientSignal
         {
             LmbrCentral::ShapeComponentRequestsBus::Event(
                 m_configuration.m_shapeConstraintEntityId,
-                [positions, shapeConstraintBounds, &inBounds](LmbrCentral::ShapeComponentRequestsBus::Events* shape)
+                [positions, &inBounds](LmbrCentral::ShapeComponentRequestsBus::Events* shape)
                 {
+                    // Check all the points against the shape geometry in one call. Points outside of the shape AABB are outside
+                    // of the shape as well.
                     inBounds.resize(positions.size(), false);
-
-                    for (size_t index = 0; index < positions.size(); index++)
-                    {
-                        // Check the AABB first.
-                        if (shapeConstraintBounds.Contains(positions[index]))
-                        {
-                            // The point is in the AABB, so check against the actual shape geometry.
-                            inBounds[index] = shape->IsPointInside(positions[index]);
-                        }
-                    }
+                    shape->IsPointInsideBatch(positions, inBounds);
                 });
         }
 
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -156,6 +157,14 @@ namespace GradientSignal
         }
     }
 
+    bool InvertGradientComponent::CompileGradientProgram(GradientProgramBuilder& builder) const
+    {
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddClamp();
+        builder.AddInvert();
+        return true;
+    }
+
     bool InvertGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -12,6 +12,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
@@ -208,6 +209,17 @@ namespace GradientSignal
                 m_configuration.m_outputMin, m_configuration.m_outputMax);
     }
 
+    bool LevelsGradientComponent::CompileGradientProgram(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddLevels(
+            m_configuration.m_inputMid, m_configuration.m_inputMin, m_configuration.m_inputMax, m_configuration.m_outputMin,
+            m_configuration.m_outputMax);
+        return true;
+    }
+
     bool LevelsGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -372,6 +373,26 @@ namespace GradientSignal
 
 
 
+    bool MixedGradientComponent::CompileGradientProgram(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        // Layer blends combine with the values below them, so start from 0 like GetValues does.
+        builder.AddConstant(0.0f);
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                builder.AddSampler(layer.m_gradientSampler);
+                builder.AddMix(layer.m_operation, layer.m_gradientSampler.m_opacity);
+            }
+        }
+
+        builder.AddClamp();
+        return true;
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
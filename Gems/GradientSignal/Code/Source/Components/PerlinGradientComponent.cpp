@@ -215,24 +215,38 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
-
         AZStd::shared_lock lock(m_queryMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        if (!m_perlinImprovedNoise)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
 
-            if (!wasPointRejected)
+        // Transform the positions in blocks, so that the noise of each block can be generated a few positions at a time.
+        constexpr size_t BlockSize = 256;
+        AZStd::array<AZ::Vector3, BlockSize> uvws;
+        AZStd::array<bool, BlockSize> wasPointRejected;
+
+        for (size_t blockStart = 0; blockStart < positions.size(); blockStart += BlockSize)
+        {
+            const size_t blockCount = AZStd::min(positions.size() - blockStart, BlockSize);
+            for (size_t index = 0; index < blockCount; index++)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                m_gradientTransform.TransformPositionToUVW(positions[blockStart + index], uvws[index], wasPointRejected[index]);
             }
-            else
+
+            AZStd::span<float> blockValues = outValues.subspan(blockStart, blockCount);
+            m_perlinImprovedNoise->GenerateOctaveNoise(
+                AZStd::span<const AZ::Vector3>(uvws.data(), blockCount), blockValues, m_configuration.m_octave,
+                m_configuration.m_amplitude, m_configuration.m_frequency);
+
+            for (size_t index = 0; index < blockCount; index++)
             {
-                outValues[index] = 0.0f;
+                if (wasPointRejected[index])
+                {
+                    blockValues[index] = 0.0f;
+                }
             }
         }
     }
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -183,6 +184,25 @@ namespace GradientSignal
         }
     }
 
+    bool PosterizeGradientComponent::CompileGradientProgram(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+        const PosterizeGradientConfig::ModeType mode = m_configuration.m_mode;
+
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddFunction(
+            [bands, mode](AZStd::span<float> values)
+            {
+                for (auto& value : values)
+                {
+                    value = PosterizeValue(value, bands, mode);
+                }
+            });
+        return true;
+    }
+
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
@@ -165,6 +166,47 @@ namespace GradientSignal
     }
 
 
+    void RandomGradientComponent::GetRandomValues(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, AZStd::size_t seed) const
+    {
+        using AZ::Simd::Vec4;
+
+        // The float math of the hash inputs runs four positions at a time in the same order of operations as GetRandomValue.
+        // The hashing itself stays scalar, because it works on 64-bit values that don't fit in the 32-bit SIMD lanes.
+        const Vec4::FloatType seeds = Vec4::Splat(static_cast<float>(seed));
+        for (size_t index = 0; index < positions.size(); index += Vec4::ElementCount)
+        {
+            // The last group of positions is padded with copies of its first position.
+            const size_t groupCount = AZStd::min(positions.size() - index, aznumeric_cast<size_t>(Vec4::ElementCount));
+            alignas(16) float groupX[Vec4::ElementCount];
+            alignas(16) float groupY[Vec4::ElementCount];
+            for (size_t lane = 0; lane < Vec4::ElementCount; ++lane)
+            {
+                const AZ::Vector3& position = positions[index + ((lane < groupCount) ? lane : 0)];
+                groupX[lane] = position.GetX();
+                groupY[lane] = position.GetY();
+            }
+            const Vec4::FloatType x = Vec4::LoadAligned(groupX);
+            const Vec4::FloatType y = Vec4::LoadAligned(groupY);
+
+            alignas(16) float hashInputs[3][Vec4::ElementCount];
+            Vec4::StoreAligned(hashInputs[0], Vec4::Add(Vec4::Mul(x, seeds), y));
+            Vec4::StoreAligned(hashInputs[1], Vec4::Add(Vec4::Mul(y, seeds), x));
+            Vec4::StoreAligned(hashInputs[2], Vec4::Mul(Vec4::Mul(x, y), seeds));
+
+            for (size_t lane = 0; lane < groupCount; ++lane)
+            {
+                AZStd::size_t result = 0;
+                AZStd::hash_combine<float>(result, hashInputs[0][lane]);
+                AZStd::hash_combine<float>(result, hashInputs[1][lane]);
+                AZStd::hash_combine<float>(result, hashInputs[2][lane]);
+
+                outValues[index + lane] =
+                    static_cast<float>(result % std::numeric_limits<AZ::u8>::max()) / static_cast<float>(std::numeric_limits<AZ::u8>::max());
+            }
+        }
+    }
+
     float RandomGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
         AZStd::shared_lock lock(m_queryMutex);
@@ -195,22 +237,31 @@ namespace GradientSignal
 
         AZStd::shared_lock lock(m_queryMutex);
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
         const AZStd::size_t seed = m_configuration.m_randomSeed +
             AZStd::size_t(2); // Add 2 to avoid seeds 0 and 1, which can create strange patterns with this particular algorithm
 
-        for (size_t index = 0; index < positions.size(); index++)
-        {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+        // Transform the positions in blocks, so that the values of each block can be generated a few positions at a time.
+        constexpr size_t BlockSize = 256;
+        AZStd::array<AZ::Vector3, BlockSize> uvws;
+        AZStd::array<bool, BlockSize> wasPointRejected;
 
-            if (!wasPointRejected)
+        for (size_t blockStart = 0; blockStart < positions.size(); blockStart += BlockSize)
+        {
+            const size_t blockCount = AZStd::min(positions.size() - blockStart, BlockSize);
+            for (size_t index = 0; index < blockCount; index++)
             {
-                outValues[index] = GetRandomValue(uvw, seed);
+                m_gradientTransform.TransformPositionToUVW(positions[blockStart + index], uvws[index], wasPointRejected[index]);
             }
-            else
+
+            AZStd::span<float> blockValues = outValues.subspan(blockStart, blockCount);
+            GetRandomValues(AZStd::span<const AZ::Vector3>(uvws.data(), blockCount), blockValues, seed);
+
+            for (size_t index = 0; index < blockCount; index++)
             {
-                outValues[index] = 0.0f;
+                if (wasPointRejected[index])
+                {
+                    blockValues[index] = 0.0f;
+                }
             }
         }
     }
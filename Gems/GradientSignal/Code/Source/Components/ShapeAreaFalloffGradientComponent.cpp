@@ -216,23 +216,32 @@ namespace GradientSignal
             {
                 shapeConnected = true;
 
-                for (size_t index = 0; index < positions.size(); index++)
+                // Get the distances of all the points in one call, so that the shape only locks and updates its cached data once.
+                if (m_configuration.m_is3dFalloff)
                 {
-                    AZ::Vector3 queryPoint = positions[index];
-                    if (!m_configuration.m_is3dFalloff)
+                    shapeRequests->DistanceFromPointBatch(positions, outValues);
+                }
+                else
+                {
+                    // Calculate the shape falloff distance in the XY plane only by using the shape center as our Z location.
+                    AZStd::vector<AZ::Vector3> queryPoints(positions.begin(), positions.end());
+                    for (AZ::Vector3& queryPoint : queryPoints)
                     {
-                        // Calculate the shape falloff distance in the XY plane only by using the shape center as our Z location.
                         queryPoint.SetZ(m_cachedShapeCenter.GetZ());
                     }
+                    shapeRequests->DistanceFromPointBatch(queryPoints, outValues);
+                }
 
-                    float distance = shapeRequests->DistanceFromPoint(queryPoint);
+                for (float& value : outValues)
+                {
+                    const float distance = value;
 
                     // Since this is outer falloff, distance should give us values from 1.0 at the minimum distance to 0.0 at the maximum
                     // distance. The statement is written specifically to handle the 0 falloff case as well. For 0 falloff, all points
                     // inside the shape (0 distance) return 1.0, and all points outside the shape return 0. This works because division by 0
                     // gives infinity, which gets clamped by the GetMax() to 0.  However, if distance == 0, it would give us NaN, so we have
                     // the separate conditional check to handle that case and clamp to 1.0.
-                    outValues[index] = (distance <= 0.0f) ? 1.0f : AZ::GetMax(1.0f - (distance / falloffWidth), 0.0f);
+                    value = (distance <= 0.0f) ? 1.0f : AZ::GetMax(1.0f - (distance / falloffWidth), 0.0f);
                 }
             });
 
@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
@@ -192,6 +193,19 @@ namespace GradientSignal
         m_configuration.m_smoothStep.GetSmoothedValues(outValues);
     }
 
+    bool SmoothStepGradientComponent::CompileGradientProgram(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddFunction(
+            [smoothStep = m_configuration.m_smoothStep](AZStd::span<float> values)
+            {
+                smoothStep.GetSmoothedValues(values);
+            });
+        return true;
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
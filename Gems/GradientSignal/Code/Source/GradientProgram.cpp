@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/Util.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        //! Runs a SIMD function over a list of values whose size is a multiple of 4.
+        template<typename Function>
+        void TransformValues(AZStd::span<float> values, Function function)
+        {
+            for (size_t index = 0; index < values.size(); index += Vec4::ElementCount)
+            {
+                Vec4::StoreUnaligned(values.data() + index, function(Vec4::LoadUnaligned(values.data() + index)));
+            }
+        }
+
+        constexpr size_t AlignToSimd(size_t count)
+        {
+            return (count + Vec4::ElementCount - 1) & ~static_cast<size_t>(Vec4::ElementCount - 1);
+        }
+    } // namespace
+
+    GradientProgram GradientProgram::Compile(const GradientSampler& sampler)
+    {
+        GradientProgramBuilder builder;
+        builder.AddSampler(sampler);
+        return builder.Build();
+    }
+
+    GradientProgram GradientProgram::Compile(const AZ::EntityId& gradientId)
+    {
+        GradientProgramBuilder builder;
+        builder.AddGradient(gradientId);
+        return builder.Build();
+    }
+
+    bool GradientProgram::IsEmpty() const
+    {
+        return m_operations.empty();
+    }
+
+    size_t GradientProgram::GetOperationCount() const
+    {
+        return m_operations.size();
+    }
+
+    size_t GradientProgram::GetBusGradientCount() const
+    {
+        return AZStd::count_if(
+            m_operations.begin(), m_operations.end(),
+            [](const Operation& operation)
+            {
+                return operation.m_type == OperationType::BusGradient;
+            });
+    }
+
+    void GradientProgram::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        if (m_operations.empty())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // The stacks of value lists and transformed position lists are sized for a single block and reused for every block.
+        AZStd::vector<float> valueStack(m_maxValueDepth * BlockSize, 0.0f);
+        AZStd::vector<AZ::Vector3> transformStack(m_maxTransformDepth * BlockSize);
+
+        for (size_t blockStart = 0; blockStart < positions.size(); blockStart += BlockSize)
+        {
+            const size_t count = AZStd::min(BlockSize, positions.size() - blockStart);
+
+            // The SIMD operations run over the values padded to a multiple of 4. The padding values are never returned.
+            const size_t simdCount = AlignToSimd(count);
+
+            const AZStd::span<const AZ::Vector3> blockPositions = positions.subspan(blockStart, count);
+            size_t valueDepth = 0;
+            size_t transformDepth = 0;
+
+            auto getValues = [&valueStack](size_t depth, size_t valueCount)
+            {
+                return AZStd::span<float>(valueStack.data() + (depth * BlockSize), valueCount);
+            };
+
+            auto getPositions = [&transformStack, &blockPositions, &transformDepth, count]()
+            {
+                return (transformDepth == 0)
+                    ? blockPositions
+                    : AZStd::span<const AZ::Vector3>(transformStack.data() + ((transformDepth - 1) * BlockSize), count);
+            };
+
+            for (const Operation& operation : m_operations)
+            {
+                switch (operation.m_type)
+                {
+                case OperationType::Constant:
+                    {
+                        AZStd::span<float> values = getValues(valueDepth++, simdCount);
+                        AZStd::fill(values.begin(), values.end(), operation.m_values[0]);
+                    }
+                    break;
+                case OperationType::BusGradient:
+                    {
+                        // Clear the values first, so they are well defined even if the gradient isn't connected to the bus.
+                        AZStd::span<float> values = getValues(valueDepth++, count);
+                        AZStd::fill(values.begin(), values.end(), 0.0f);
+                        GradientRequestBus::Event(operation.m_gradientId, &GradientRequestBus::Events::GetValues, getPositions(), values);
+                    }
+                    break;
+                case OperationType::PushTransform:
+                    {
+                        const AZ::Matrix3x4& transform = m_transforms[operation.m_index];
+                        const AZStd::span<const AZ::Vector3> inPositions = getPositions();
+                        AZ::Vector3* outPositions = transformStack.data() + (transformDepth * BlockSize);
+                        for (size_t index = 0; index < count; index++)
+                        {
+                            outPositions[index] = transform * inPositions[index];
+                        }
+                        transformDepth++;
+                    }
+                    break;
+                case OperationType::PopTransform:
+                    transformDepth--;
+                    break;
+                case OperationType::Clamp:
+                    {
+                        const Vec4::FloatType zero = Vec4::ZeroFloat();
+                        const Vec4::FloatType one = Vec4::Splat(1.0f);
+                        TransformValues(getValues(valueDepth - 1, simdCount), [zero, one](Vec4::FloatArgType value)
+                            {
+                                return Vec4::Clamp(value, zero, one);
+                            });
+                    }
+                    break;
+                case OperationType::Invert:
+                    {
+                        const Vec4::FloatType one = Vec4::Splat(1.0f);
+                        TransformValues(getValues(valueDepth - 1, simdCount), [one](Vec4::FloatArgType value)
+                            {
+                                return Vec4::Sub(one, value);
+                            });
+                    }
+                    break;
+                case OperationType::Scale:
+                    {
+                        const Vec4::FloatType scale = Vec4::Splat(operation.m_values[0]);
+                        TransformValues(getValues(valueDepth - 1, simdCount), [scale](Vec4::FloatArgType value)
+                            {
+                                return Vec4::Mul(value, scale);
+                            });
+                    }
+                    break;
+                case OperationType::Threshold:
+                    {
+                        const Vec4::FloatType threshold = Vec4::Splat(operation.m_values[0]);
+                        const Vec4::FloatType one = Vec4::Splat(1.0f);
+                        TransformValues(getValues(valueDepth - 1, simdCount), [threshold, one](Vec4::FloatArgType value)
+                            {
+                                return Vec4::And(Vec4::CmpGt(value, threshold), one);
+                            });
+                    }
+                    break;
+                case OperationType::Levels:
+                    for (float& value : getValues(valueDepth - 1, count))
+                    {
+                        value = GetLevels(
+                            value, operation.m_values[0], operation.m_values[1], operation.m_values[2], operation.m_values[3],
+                            operation.m_values[4]);
+                    }
+                    break;
+                case OperationType::Mix:
+                    Mix(operation.m_mixingOperation, operation.m_values[0], getValues(valueDepth - 1, simdCount),
+                        getValues(valueDepth - 2, simdCount));
+                    valueDepth--;
+                    break;
+                case OperationType::Function:
+                    m_functions[operation.m_index](getValues(valueDepth - 1, count));
+                    break;
+                }
+            }
+
+            AZ_Assert((valueDepth == 1) && (transformDepth == 0), "Gradient program left %zu value lists on the stack.", valueDepth);
+
+            const AZStd::span<float> values = getValues(0, count);
+            AZStd::copy(values.begin(), values.end(), outValues.begin() + blockStart);
+        }
+    }
+
+    void GradientProgram::Mix(
+        MixedGradientLayer::MixingOperation operation, float opacity, AZStd::span<const float> layerValues, AZStd::span<float> inOutValues)
+    {
+        AZ_Assert((inOutValues.size() % Vec4::ElementCount) == 0, "Mixed value lists need to be padded to a multiple of 4.");
+
+        // This matches the layer blending in MixedGradientComponent::GetValues. The "Initialize" operation erases the accumulated values.
+        const float inverseOpacity = (operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - opacity);
+        const Vec4::FloatType opacityVec = Vec4::Splat(opacity);
+        const Vec4::FloatType inverseOpacityVec = Vec4::Splat(inverseOpacity);
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType two = Vec4::Splat(2.0f);
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+
+        auto mixValues = [&](auto&& operationFunction)
+        {
+            for (size_t index = 0; index < inOutValues.size(); index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType prevValue = Vec4::LoadUnaligned(inOutValues.data() + index);
+
+                // The layer values include the opacity, so it needs to be divided back out before running the operation.
+                const Vec4::FloatType currentUnpremultiplied = Vec4::Div(Vec4::LoadUnaligned(layerValues.data() + index), opacityVec);
+                const Vec4::FloatType operationResult = operationFunction(prevValue, currentUnpremultiplied);
+                Vec4::StoreUnaligned(
+                    inOutValues.data() + index,
+                    Vec4::Add(Vec4::Mul(prevValue, inverseOpacityVec), Vec4::Mul(operationResult, opacityVec)));
+            }
+        };
+
+        switch (operation)
+        {
+        case MixedGradientLayer::MixingOperation::Multiply:
+            mixValues([](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Mul(prevValue, current);
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Screen:
+            mixValues([one](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, prevValue), Vec4::Sub(one, current)));
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Add:
+            mixValues([](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Add(prevValue, current);
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Subtract:
+            mixValues([](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Sub(prevValue, current);
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Min:
+            mixValues([](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Min(prevValue, current);
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Max:
+            mixValues([](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Max(prevValue, current);
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Average:
+            mixValues([two](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return Vec4::Div(Vec4::Add(prevValue, current), two);
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Overlay:
+            mixValues([one, two, half](Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    const Vec4::FloatType lightResult =
+                        Vec4::Sub(one, Vec4::Mul(Vec4::Mul(two, Vec4::Sub(one, prevValue)), Vec4::Sub(one, current)));
+                    const Vec4::FloatType darkResult = Vec4::Mul(Vec4::Mul(two, prevValue), current);
+                    return Vec4::Select(lightResult, darkResult, Vec4::CmpGtEq(prevValue, half));
+                });
+            break;
+        case MixedGradientLayer::MixingOperation::Initialize:
+        case MixedGradientLayer::MixingOperation::Normal:
+        default:
+            mixValues([]([[maybe_unused]] Vec4::FloatArgType prevValue, Vec4::FloatArgType current)
+                {
+                    return current;
+                });
+            break;
+        }
+    }
+
+    void GradientProgramBuilder::AddGradient(const AZ::EntityId& gradientId)
+    {
+        if (!gradientId.IsValid())
+        {
+            AddConstant(0.0f);
+            return;
+        }
+
+        if (AZStd::find(m_gradientStack.begin(), m_gradientStack.end(), gradientId) != m_gradientStack.end())
+        {
+            // GradientSampler returns 0 for cyclic references, so the program does the same.
+            AZ_ErrorOnce(
+                "GradientSignal", false, "Detected cyclic dependencies with gradient entity references on entity id %s",
+                gradientId.ToString().c_str());
+            AddConstant(0.0f);
+            return;
+        }
+
+        // Remember where the program is, so that the operations of a gradient that fails to compile can be rolled back.
+        const size_t operationCount = m_program.m_operations.size();
+        const size_t transformCount = m_program.m_transforms.size();
+        const size_t functionCount = m_program.m_functions.size();
+        const size_t valueDepth = m_valueDepth;
+        const size_t transformDepth = m_transformDepth;
+
+        bool compiled = false;
+        m_gradientStack.push_back(gradientId);
+        GradientRequestBus::EventResult(compiled, gradientId, &GradientRequestBus::Events::CompileGradientProgram, *this);
+        m_gradientStack.pop_back();
+
+        if (!compiled || (m_valueDepth != valueDepth + 1) || (m_transformDepth != transformDepth))
+        {
+            AZ_Warning(
+                "GradientSignal", !compiled, "Gradient on entity id %s compiled into an unbalanced gradient program.",
+                gradientId.ToString().c_str());
+
+            m_program.m_operations.resize(operationCount);
+            m_program.m_transforms.resize(transformCount);
+            m_program.m_functions.resize(functionCount);
+            m_valueDepth = valueDepth;
+            m_transformDepth = transformDepth;
+
+            GradientProgram::Operation operation;
+            operation.m_type = GradientProgram::OperationType::BusGradient;
+            operation.m_gradientId = gradientId;
+            AddOperation(operation);
+        }
+    }
+
+    void GradientProgramBuilder::AddSampler(const GradientSampler& sampler)
+    {
+        // This follows GradientSampler::GetValues.
+        if (sampler.m_opacity <= 0.0f || !sampler.m_gradientId.IsValid())
+        {
+            AddConstant(0.0f);
+            return;
+        }
+
+        const bool useTransform = sampler.m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(sampler);
+        if (useTransform)
+        {
+            // We use the inverse here because we're going from world space to gradient space.
+            PushTransform(sampler.GetTransformMatrix().GetInverseFull());
+        }
+
+        AddGradient(sampler.m_gradientId);
+
+        if (useTransform)
+        {
+            PopTransform();
+        }
+
+        if (sampler.m_invertInput)
+        {
+            AddInvert();
+        }
+
+        if (sampler.m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(sampler))
+        {
+            AddLevels(sampler.m_inputMid, sampler.m_inputMin, sampler.m_inputMax, sampler.m_outputMin, sampler.m_outputMax);
+        }
+
+        if (sampler.m_opacity != 1.0f)
+        {
+            AddScale(sampler.m_opacity);
+        }
+    }
+
+    void GradientProgramBuilder::AddConstant(float value)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Constant;
+        operation.m_values[0] = value;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddClamp()
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Clamp;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddInvert()
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Invert;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddScale(float scale)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Scale;
+        operation.m_values[0] = scale;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddThreshold(float threshold)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Threshold;
+        operation.m_values[0] = threshold;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddLevels(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Levels;
+        operation.m_values = { inputMid, inputMin, inputMax, outputMin, outputMax };
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddMix(MixedGradientLayer::MixingOperation mixingOperation, float opacity)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Mix;
+        operation.m_mixingOperation = mixingOperation;
+        operation.m_values[0] = opacity;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddFunction(AZStd::function<void(AZStd::span<float>)> function)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::Function;
+        operation.m_index = aznumeric_cast<AZ::u32>(m_program.m_functions.size());
+        m_program.m_functions.push_back(AZStd::move(function));
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::PushTransform(const AZ::Matrix3x4& transform)
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::PushTransform;
+        operation.m_index = aznumeric_cast<AZ::u32>(m_program.m_transforms.size());
+        m_program.m_transforms.push_back(transform);
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::PopTransform()
+    {
+        GradientProgram::Operation operation;
+        operation.m_type = GradientProgram::OperationType::PopTransform;
+        AddOperation(operation);
+    }
+
+    void GradientProgramBuilder::AddOperation(const GradientProgram::Operation& operation)
+    {
+        switch (operation.m_type)
+        {
+        case GradientProgram::OperationType::Constant:
+        case GradientProgram::OperationType::BusGradient:
+            m_valueDepth++;
+            m_program.m_maxValueDepth = AZStd::max(m_program.m_maxValueDepth, m_valueDepth);
+            break;
+        case GradientProgram::OperationType::PushTransform:
+            m_transformDepth++;
+            m_program.m_maxTransformDepth = AZStd::max(m_program.m_maxTransformDepth, m_transformDepth);
+            break;
+        case GradientProgram::OperationType::PopTransform:
+            AZ_Assert(m_transformDepth > 0, "Gradient program transform popped without a matching push.");
+            m_transformDepth--;
+            break;
+        case GradientProgram::OperationType::Mix:
+            AZ_Assert(m_valueDepth > 1, "Gradient program mix needs two value lists on the stack.");
+            m_valueDepth--;
+            break;
+        default:
+            AZ_Assert(m_valueDepth > 0, "Gradient program modifier needs a value list on the stack.");
+            break;
+        }
+
+        m_program.m_operations.push_back(operation);
+    }
+
+    GradientProgram GradientProgramBuilder::Build()
+    {
+        AZ_Assert(
+            (m_valueDepth == 1) && (m_transformDepth == 0), "Gradient program needs to leave exactly one value list on the stack (%zu).",
+            m_valueDepth);
+
+        GradientProgram program = AZStd::move(m_program);
+        m_program = {};
+        m_valueDepth = 0;
+        m_transformDepth = 0;
+        return program;
+    }
+} // namespace GradientSignal
@@ -8,6 +8,8 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/limits.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +62,35 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // The SIMD versions below keep the exact order of operations of the scalar versions above, so both produce the same values.
+        using AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Branchless form of the gradient table: u is x for the first 8 entries and y otherwise, v is y for the first 4 entries,
+            // x for entries 0xC and 0xE and z otherwise. Bit 0 negates u and bit 1 negates v.
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType u = Vec4::Select(x, y, Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x8))));
+            const Vec4::FloatType vMaskX = Vec4::CastToFloat(Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(0xC)), Vec4::CmpEq(h, Vec4::Splat(0xE))));
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, vMaskX), Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x4))));
+
+            const Vec4::Int32Type signBit = Vec4::Splat(AZStd::numeric_limits<int32_t>::min());
+            const Vec4::FloatType uSign = Vec4::CastToFloat(Vec4::And(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0x1)), Vec4::Splat(0x1)), signBit));
+            const Vec4::FloatType vSign = Vec4::CastToFloat(Vec4::And(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0x2)), Vec4::Splat(0x2)), signBit));
+            return Vec4::Add(Vec4::Xor(u, uSign), Vec4::Xor(v, vSign));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType t3 = Vec4::Mul(Vec4::Mul(t, t), t);
+            return Vec4::Mul(t3, Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +123,65 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency) const
+    {
+        using AZ::Simd::Vec4;
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        float maxValue = 0.0f;               // Used for normalizing result to 0.0 - 1.0
+        float amplitude = 1.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            maxValue += amplitude;
+            amplitude *= persistence;
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const Vec4::FloatType maxValues = Vec4::Splat(maxValue);
+        const size_t count = AZStd::min(positions.size(), outValues.size());
+        for (size_t index = 0; index < count; index += Vec4::ElementCount)
+        {
+            // The last group of positions is padded with copies of its first position.
+            const size_t groupCount = AZStd::min(count - index, aznumeric_cast<size_t>(Vec4::ElementCount));
+            alignas(16) float groupX[Vec4::ElementCount];
+            alignas(16) float groupY[Vec4::ElementCount];
+            alignas(16) float groupZ[Vec4::ElementCount];
+            for (size_t lane = 0; lane < Vec4::ElementCount; ++lane)
+            {
+                const AZ::Vector3& position = positions[index + ((lane < groupCount) ? lane : 0)];
+                groupX[lane] = position.GetX();
+                groupY[lane] = position.GetY();
+                groupZ[lane] = position.GetZ();
+            }
+            const Vec4::FloatType x = Vec4::LoadAligned(groupX);
+            const Vec4::FloatType y = Vec4::LoadAligned(groupY);
+            const Vec4::FloatType z = Vec4::LoadAligned(groupZ);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencies = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = GenerateNoise(Vec4::Mul(x, frequencies), Vec4::Mul(y, frequencies), Vec4::Mul(z, frequencies));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            alignas(16) float groupValues[Vec4::ElementCount];
+            Vec4::StoreAligned(groupValues, Vec4::Div(total, maxValues));
+            AZStd::copy(groupValues, groupValues + groupCount, outValues.begin() + index);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -138,6 +228,69 @@ namespace GradientSignal
         return (PerlinImprovedNoiseDetails::Lerp(y1, y2, w) + 1.0f) / 2.0f;
     }
 
+    AZ::Simd::Vec4::FloatType PerlinImprovedNoise::GenerateNoise(
+        AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z) const
+    {
+        using AZ::Simd::Vec4;
+        using namespace PerlinImprovedNoiseDetails;
+
+        const Vec4::Int32Type fx = Vec4::ConvertToInt(Vec4::Floor(x));
+        const Vec4::Int32Type fy = Vec4::ConvertToInt(Vec4::Floor(y));
+        const Vec4::Int32Type fz = Vec4::ConvertToInt(Vec4::Floor(z));
+        const Vec4::FloatType xf = Vec4::Sub(x, Vec4::ConvertToFloat(fx));
+        const Vec4::FloatType yf = Vec4::Sub(y, Vec4::ConvertToFloat(fy));
+        const Vec4::FloatType zf = Vec4::Sub(z, Vec4::ConvertToFloat(fz));
+        const Vec4::FloatType u = Fade(xf);
+        const Vec4::FloatType v = Fade(yf);
+        const Vec4::FloatType w = Fade(zf);
+
+        const Vec4::Int32Type mask = Vec4::Splat(255);
+        alignas(16) int32_t xi0[Vec4::ElementCount];
+        alignas(16) int32_t yi0[Vec4::ElementCount];
+        alignas(16) int32_t zi0[Vec4::ElementCount];
+        Vec4::StoreAligned(xi0, Vec4::And(fx, mask));
+        Vec4::StoreAligned(yi0, Vec4::And(fy, mask));
+        Vec4::StoreAligned(zi0, Vec4::And(fz, mask));
+
+        // There's no gather in AZ::Simd, so the permutation table lookups of the 8 cube corners are done per lane.
+        const AZStd::array<int, 512>& p = m_permutationTable;
+        alignas(16) int32_t aaa[Vec4::ElementCount], aba[Vec4::ElementCount], aab[Vec4::ElementCount], abb[Vec4::ElementCount];
+        alignas(16) int32_t baa[Vec4::ElementCount], bba[Vec4::ElementCount], bab[Vec4::ElementCount], bbb[Vec4::ElementCount];
+        for (size_t lane = 0; lane < Vec4::ElementCount; ++lane)
+        {
+            const int a = p[xi0[lane]] + yi0[lane];
+            const int b = p[xi0[lane] + 1] + yi0[lane];
+            const int aa = p[a] + zi0[lane];
+            const int ab = p[a + 1] + zi0[lane];
+            const int ba = p[b] + zi0[lane];
+            const int bb = p[b + 1] + zi0[lane];
+            aaa[lane] = p[aa];
+            aba[lane] = p[ab];
+            aab[lane] = p[aa + 1];
+            abb[lane] = p[ab + 1];
+            baa[lane] = p[ba];
+            bba[lane] = p[bb];
+            bab[lane] = p[ba + 1];
+            bbb[lane] = p[bb + 1];
+        }
+
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+        const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+        const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+        Vec4::FloatType x1, x2, y1, y2;
+        x1 = Lerp(Gradient(Vec4::LoadAligned(aaa), xf, yf, zf), Gradient(Vec4::LoadAligned(baa), xf1, yf, zf), u);
+        x2 = Lerp(Gradient(Vec4::LoadAligned(aba), xf, yf1, zf), Gradient(Vec4::LoadAligned(bba), xf1, yf1, zf), u);
+        y1 = Lerp(x1, x2, v);
+        x1 = Lerp(Gradient(Vec4::LoadAligned(aab), xf, yf, zf1), Gradient(Vec4::LoadAligned(bab), xf1, yf, zf1), u);
+        x2 = Lerp(Gradient(Vec4::LoadAligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadAligned(bbb), xf1, yf1, zf1), u);
+        y2 = Lerp(x1, x2, v);
+
+        // For convenience we bound it to 0 - 1 (theoretical min/max before is -1 - 1)
+        return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+    }
+
     void PerlinImprovedNoise::PrepareTable(int seed)
     {
         AZStd::array<int, 256> randtable;
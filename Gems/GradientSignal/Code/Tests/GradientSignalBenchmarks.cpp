@@ -20,6 +20,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -74,6 +75,51 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_RandomGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ShapeAreaFalloffGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Noise Kernels
+
+    // Compares generating Perlin noise one position at a time (state.range(0) == 0) against generating it for the whole list of
+    // positions with SIMD (state.range(0) == 1), without the gradient transform and EBus overhead of the gradient component.
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_PerlinImprovedNoise)(benchmark::State& state)
+    {
+        const bool useList = (state.range(0) != 0);
+        const int64_t queryRange = state.range(1);
+        const int octaves = 4;
+        const float persistence = 0.5f;
+        const float frequency = 0.01f;
+
+        GradientSignal::PerlinImprovedNoise perlinNoise(12345);
+        AZStd::vector<AZ::Vector3> positions(queryRange * queryRange);
+        GradientSignalTestHelpers::FillQueryPositions(positions, aznumeric_cast<float>(queryRange), aznumeric_cast<float>(queryRange));
+        AZStd::vector<float> values(positions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useList)
+            {
+                perlinNoise.GenerateOctaveNoise(positions, values, octaves, persistence, frequency);
+            }
+            else
+            {
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    const AZ::Vector3& position = positions[index];
+                    values[index] =
+                        perlinNoise.GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), octaves, persistence, frequency);
+                }
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_PerlinImprovedNoise)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "List", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
     // --------------------------------------------------------------------------------------
     // Gradient Modifiers
 
@@ -10,6 +10,9 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
+#include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
 {
@@ -128,6 +131,107 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
-}
 
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_ModifierChain_MatchesSamplerGetValues)
+    {
+        // Chain every modifier that compiles into program operations on top of a gradient that's queried through the EBus.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        auto constantEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestMixedGradient(TestShapeHalfBounds, invertEntity->GetId(), constantEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, mixedEntity->GetId());
+        auto referenceEntity = BuildTestReferenceGradient(TestShapeHalfBounds, posterizeEntity->GetId());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = referenceEntity->GetId();
+        GradientSignalTestHelpers::CompareGetValuesAndGradientProgram(gradientSampler, 0.0f, TestShapeHalfBounds * 2.0f);
+
+        // Only the random gradient at the bottom of the chain should be left for the EBus.
+        const GradientSignal::GradientProgram program = GradientSignal::GradientProgram::Compile(gradientSampler);
+        EXPECT_EQ(program.GetBusGradientCount(), 1u);
+
+        auto thresholdEntity = BuildTestThresholdGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        gradientSampler.m_gradientId = thresholdEntity->GetId();
+        GradientSignalTestHelpers::CompareGetValuesAndGradientProgram(gradientSampler, 0.0f, TestShapeHalfBounds * 2.0f);
+    }
 
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_SamplerSettings_MatchSamplerGetValues)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+
+        // Set every sampler setting that changes the values, so that the program has to apply all of them in the right order.
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = levelsEntity->GetId();
+        gradientSampler.m_opacity = 0.8f;
+        gradientSampler.m_invertInput = true;
+        gradientSampler.m_enableTransform = true;
+        gradientSampler.m_translate = AZ::Vector3(3.0f, -7.0f, 0.0f);
+        gradientSampler.m_scale = AZ::Vector3(0.5f, 2.0f, 1.0f);
+        gradientSampler.m_rotate = AZ::Vector3(0.0f, 0.0f, 30.0f);
+        gradientSampler.m_enableLevels = true;
+        gradientSampler.m_inputMid = 0.7f;
+        gradientSampler.m_inputMin = 0.1f;
+        gradientSampler.m_inputMax = 0.95f;
+        gradientSampler.m_outputMin = 0.2f;
+        gradientSampler.m_outputMax = 0.9f;
+        GradientSignalTestHelpers::CompareGetValuesAndGradientProgram(gradientSampler, 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_MixingOperations_MatchSamplerGetValues)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto layerEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+
+        for (auto operation : { GradientSignal::MixedGradientLayer::MixingOperation::Initialize,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Multiply,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Add,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Subtract,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Min,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Max,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Average,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Normal,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Overlay,
+                                GradientSignal::MixedGradientLayer::MixingOperation::Screen })
+        {
+            auto entity = CreateTestEntity(TestShapeHalfBounds);
+            GradientSignal::MixedGradientConfig config;
+
+            GradientSignal::MixedGradientLayer layer;
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Initialize;
+            layer.m_gradientSampler.m_gradientId = baseEntity->GetId();
+            config.m_layers.push_back(layer);
+
+            layer.m_operation = operation;
+            layer.m_gradientSampler.m_gradientId = layerEntity->GetId();
+            layer.m_gradientSampler.m_opacity = 0.6f;
+            config.m_layers.push_back(layer);
+
+            entity->CreateComponent<GradientSignal::MixedGradientComponent>(config);
+            ActivateEntity(entity.get());
+
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = entity->GetId();
+            GradientSignalTestHelpers::CompareGetValuesAndGradientProgram(gradientSampler, 0.0f, TestShapeHalfBounds * 2.0f);
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_CompiledGradients_SkipEBus)
+    {
+        // A network of gradients that all compile themselves shouldn't query anything through the EBus.
+        auto baseEntity = BuildTestConstantGradient(TestShapeHalfBounds, 0.4f);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds, 0.9f);
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, levelsEntity->GetId(), mixedEntity->GetId());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        const GradientSignal::GradientProgram program = GradientSignal::GradientProgram::Compile(gradientSampler);
+        EXPECT_FALSE(program.IsEmpty());
+        EXPECT_EQ(program.GetBusGradientCount(), 0u);
+
+        GradientSignalTestHelpers::CompareGetValuesAndGradientProgram(gradientSampler, 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+}
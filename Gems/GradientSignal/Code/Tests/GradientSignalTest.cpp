@@ -219,6 +219,36 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_ListOfPositionsMatchesSinglePositions)
+    {
+        // The SIMD version of the noise keeps the order of operations of the scalar version, so the values should match exactly.
+        // The position count isn't a multiple of the SIMD width, so that the padded last group of positions is verified as well.
+        GradientSignal::PerlinImprovedNoise perlinNoise(12345);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 1023; ++index)
+        {
+            positions.emplace_back(-100.0f + (index * 0.37f), 50.0f - (index * 0.13f), index * 0.01f);
+        }
+
+        for (int octaves : { 0, 1, 4 })
+        {
+            const float persistence = 0.6f;
+            const float frequency = 0.25f;
+
+            AZStd::vector<float> values(positions.size());
+            perlinNoise.GenerateOctaveNoise(positions, values, octaves, persistence, frequency);
+
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                const AZ::Vector3& position = positions[index];
+                const float expectedValue =
+                    perlinNoise.GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), octaves, persistence, frequency);
+                ASSERT_EQ(expectedValue, values[index]);
+            }
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
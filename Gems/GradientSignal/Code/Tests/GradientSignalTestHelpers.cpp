@@ -11,6 +11,7 @@
 #include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
 #include <AzCore/Math/Aabb.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
@@ -207,6 +208,35 @@ namespace UnitTest
         }
     }
 
+    void GradientSignalTestHelpers::CompareGetValuesAndGradientProgram(
+        const GradientSignal::GradientSampler& gradientSampler, float queryMin, float queryMax)
+    {
+        // Build up a list of positions that doesn't fill a whole number of program blocks, so that the partial last block
+        // is verified as well.
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = queryMin; y < queryMax; y += 1.0f)
+        {
+            for (float x = queryMin; x < queryMax; x += 1.0f)
+            {
+                positions.emplace_back(x, y, 0.0f);
+            }
+        }
+        positions.emplace_back(queryMax, queryMax, 0.0f);
+
+        AZStd::vector<float> samplerResults(positions.size());
+        gradientSampler.GetValues(positions, samplerResults);
+
+        const GradientSignal::GradientProgram program = GradientSignal::GradientProgram::Compile(gradientSampler);
+        AZStd::vector<float> programResults(positions.size());
+        program.GetValues(positions, programResults);
+
+        for (size_t positionIndex = 0; positionIndex < positions.size(); positionIndex++)
+        {
+            // The program runs the same math on the same inputs, so only allow for differences in the order of float operations.
+            ASSERT_NEAR(samplerResults[positionIndex], programResults[positionIndex], 0.00001f);
+        }
+    }
+
 #ifdef HAVE_BENCHMARK
 
     void GradientSignalTestHelpers::FillQueryPositions(AZStd::vector<AZ::Vector3>& positions, float height, float width)
@@ -17,6 +17,11 @@
 #include <Atom/RPI.Reflect/Image/ImageMipChainAsset.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 
+namespace GradientSignal
+{
+    class GradientSampler;
+}
+
 namespace UnitTest
 {
     //! Helper method to build a AZ::RHI::ImageSubresourceLayout
@@ -95,6 +100,9 @@ namespace UnitTest
     public:
         static void CompareGetValueAndGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax);
 
+        //! Verifies that the GradientProgram compiled from the sampler returns the same values as the sampler GetValues.
+        static void CompareGetValuesAndGradientProgram(const GradientSignal::GradientSampler& gradientSampler, float queryMin, float queryMax);
+
 #ifdef HAVE_BENCHMARK
         // We use an enum to list out the different types of GetValue() benchmarks to run so that way we can condense our test cases
         // to just take the value in as a benchmark argument and switch on it. Otherwise, we would need to write a different benchmark
@@ -7,6 +7,7 @@
 #
 
 set(FILES
+    Include/GradientSignal/GradientProgram.h
     Include/GradientSignal/GradientSampler.h
     Include/GradientSignal/GradientTransform.h
     Include/GradientSignal/SmoothStep.h
@@ -75,6 +76,7 @@ set(FILES
     Source/Components/SurfaceMaskGradientComponent.cpp
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
+    Source/GradientProgram.cpp
     Source/GradientSampler.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
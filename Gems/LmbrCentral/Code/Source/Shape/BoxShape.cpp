@@ -178,6 +178,58 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outIsInside.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, &m_mutex, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = aabb.Contains(points[index]);
+            }
+        }
+        else
+        {
+            const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = obb.Contains(points[index]);
+            }
+        }
+    }
+
+    void BoxShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outDistancesSquared.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, &m_mutex, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = aabb.GetDistanceSq(points[index]);
+            }
+        }
+        else
+        {
+            const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = obb.GetDistanceSq(points[index]);
+            }
+        }
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         AZStd::shared_lock lock(m_mutex);
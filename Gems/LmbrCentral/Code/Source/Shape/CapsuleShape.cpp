@@ -189,6 +189,46 @@ namespace LmbrCentral
         return clampedDistance * clampedDistance;
     }
 
+    void CapsuleShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outIsInside.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
+
+        const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
+        const float internalHeightSquared = m_intersectionDataCache.m_internalHeight * m_intersectionDataCache.m_internalHeight;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            // Same checks as IsPointInside: the bottom sphere, then the top sphere and the cylinder between them.
+            const AZ::Vector3& point = points[index];
+            outIsInside[index] = AZ::Intersect::PointSphere(m_intersectionDataCache.m_basePlaneCenterPoint, radiusSquared, point) ||
+                (!m_intersectionDataCache.m_isSphere &&
+                 (AZ::Intersect::PointSphere(m_intersectionDataCache.m_topPlaneCenterPoint, radiusSquared, point) ||
+                  AZ::Intersect::PointCylinder(
+                      m_intersectionDataCache.m_basePlaneCenterPoint, m_intersectionDataCache.m_axisVector, internalHeightSquared,
+                      radiusSquared, point)));
+        }
+    }
+
+    void CapsuleShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outDistancesSquared.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const float distanceSq = AZ::Intersect::PointSegmentDistanceSq(
+                points[index], m_intersectionDataCache.m_basePlaneCenterPoint, m_intersectionDataCache.m_topPlaneCenterPoint);
+            const float clampedDistance = AZStd::max(AZ::Sqrt(distanceSq) - m_intersectionDataCache.m_radius, 0.0f);
+            outDistancesSquared[index] = clampedDistance * clampedDistance;
+        }
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         AZStd::shared_lock lock(m_mutex);
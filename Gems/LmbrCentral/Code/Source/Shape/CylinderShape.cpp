@@ -23,6 +23,78 @@
 
 namespace LmbrCentral
 {
+    namespace
+    {
+        //! The values of the cylinder axis that the distance of every point is calculated from.
+        struct CylinderAxis
+        {
+            CylinderAxis(const AZ::Vector3& baseCenterPoint, const AZ::Vector3& cylinderAxis, float radius)
+                : m_centerPoint((cylinderAxis * 0.5) + baseCenterPoint)
+                , m_axisUnit(cylinderAxis.GetNormalized())
+                , m_halfLength(cylinderAxis.GetLength() * 0.5f)
+                , m_radius(radius)
+            {
+            }
+
+            AZ::Vector3 m_centerPoint;
+            AZ::Vector3 m_axisUnit;
+            float m_halfLength = 0.0f;
+            float m_radius = 0.0f;
+        };
+
+        float DistanceSquaredFromCylinderAxis(const CylinderAxis& cylinderAxis, const AZ::Vector3& point)
+        {
+            // Use the cylinder axis' center point to determine distance by
+            // splitting into Voronoi regions and using symmetry.
+            // The regions are:
+            // - Inside
+            // - Beyond cylinder radius but between two disc ends.
+            // - Within cylinder radius but beyond two disc ends.
+            // - Beyond cylinder radius and beyond two disc ends.
+            const float radius = cylinderAxis.m_radius;
+            const float halfLength = cylinderAxis.m_halfLength;
+
+            // the vector from the center of the axis to the test point
+            const AZ::Vector3 pointToCenter = point - cylinderAxis.m_centerPoint;
+
+            // distance point is from center (projected onto axis)
+            // the abs here takes advantage of symmetry.
+            float x = AZ::Abs(pointToCenter.Dot(cylinderAxis.m_axisUnit));
+
+            // squared distance from point to center (hypotenuse)
+            float n2 = pointToCenter.GetLengthSq();
+
+            // squared distance from point to center perpendicular to axis (pythagorean)
+            float y2 = n2 - x * x;
+
+            float distanceSquared = 0.f;
+
+            if (x < halfLength) // point is between the two ends
+            {
+                if (y2 > radius * radius)   // point is outside of radius
+                {
+                    distanceSquared = (AZ::Sqrt(y2) - radius) * (AZ::Sqrt(y2) - radius);
+                }
+                // else point is inside cylinder, distance is zero.
+            }
+            else if (y2 < radius * radius)
+            {
+                // point is within radius
+                // point projects into a disc at either end, grab the "parallel" distance only
+                distanceSquared = (x - halfLength) * (x - halfLength);
+            }
+            else
+            {
+                // point is outside of radius
+                // point projects onto the edge of the disc, grab distance in two directions,
+                // combine "parallel" and "perpendicular" distances.
+                distanceSquared = (AZ::Sqrt(y2) - radius) * (AZ::Sqrt(y2) - radius) + (x - halfLength) * (x - halfLength);
+            }
+
+            return distanceSquared;
+        }
+    } // namespace
+
     void CylinderShape::Reflect(AZ::ReflectContext* context)
     {
         CylinderShapeConfig::Reflect(context);
@@ -259,58 +331,54 @@ namespace LmbrCentral
             AZ::Vector3 diff = m_intersectionDataCache.m_baseCenterPoint - point;
             return diff.GetLengthSq();
         }
-        // Use the cylinder axis' center point to determine distance by
-        // splitting into Voronoi regions and using symmetry.
-        // The regions are:
-        // - Inside
-        // - Beyond cylinder radius but between two disc ends.
-        // - Within cylinder radius but beyond two disc ends.
-        // - Beyond cylinder radius and beyond two disc ends.
-        float radius = m_intersectionDataCache.m_radius;
 
-        const AZ::Vector3 cylinderAxis = m_intersectionDataCache.m_axisVector;
-        float halfLength = cylinderAxis.GetLength() * 0.5f;
-        const AZ::Vector3 cylinderAxisUnit = cylinderAxis.GetNormalized();
+        const CylinderAxis cylinderAxis(
+            m_intersectionDataCache.m_baseCenterPoint, m_intersectionDataCache.m_axisVector, m_intersectionDataCache.m_radius);
+        return DistanceSquaredFromCylinderAxis(cylinderAxis, point);
+    }
 
-        // get the center of the axis and the vector from center to the test point
-        const AZ::Vector3 centerPoint = (cylinderAxis * 0.5) + m_intersectionDataCache.m_baseCenterPoint;
-        const AZ::Vector3 pointToCenter = point - centerPoint;
+    void CylinderShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outIsInside.size());
 
-        // distance point is from center (projected onto axis)
-        // the abs here takes advantage of symmetry.
-        float x = AZ::Abs(pointToCenter.Dot(cylinderAxisUnit));
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
 
-        // squared distance from point to center (hypotenuse)
-        float n2 = pointToCenter.GetLengthSq();
+        const float heightSquared = powf(m_intersectionDataCache.m_height, 2.0f);
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outIsInside[index] = AZ::Intersect::PointCylinder(
+                m_intersectionDataCache.m_baseCenterPoint, m_intersectionDataCache.m_axisVector, heightSquared, radiusSquared,
+                points[index]);
+        }
+    }
 
-        // squared distance from point to center perpendicular to axis (pythagorean)
-        float y2 = n2 - x * x;
+    void CylinderShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outDistancesSquared.size());
 
-        float distanceSquared = 0.f;
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
 
-        if (x < halfLength) // point is between the two ends
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
         {
-            if (y2 > radius * radius)   // point is outside of radius
+            for (size_t index = 0; index < points.size(); ++index)
             {
-                distanceSquared = (AZ::Sqrt(y2) - radius) * (AZ::Sqrt(y2) - radius);
+                outDistancesSquared[index] = (m_intersectionDataCache.m_baseCenterPoint - points[index]).GetLengthSq();
             }
-            // else point is inside cylinder, distance is zero.
+            return;
         }
-        else if (y2 < radius * radius)
-        {
-            // point is within radius
-            // point projects into a disc at either end, grab the "parallel" distance only
-            distanceSquared = (x - halfLength) * (x - halfLength);
-        }
-        else
+
+        // The axis values are the same for every point, so only calculate them once.
+        const CylinderAxis cylinderAxis(
+            m_intersectionDataCache.m_baseCenterPoint, m_intersectionDataCache.m_axisVector, m_intersectionDataCache.m_radius);
+        for (size_t index = 0; index < points.size(); ++index)
         {
-            // point is outside of radius
-            // point projects onto the edge of the disc, grab distance in two directions,
-            // combine "parallel" and "perpendicular" distances.
-            distanceSquared = (AZ::Sqrt(y2) - radius) * (AZ::Sqrt(y2) - radius) + (x - halfLength) * (x - halfLength);
+            outDistancesSquared[index] = DistanceSquaredFromCylinderAxis(cylinderAxis, points[index]);
         }
-
-        return distanceSquared;
     }
 
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
@@ -408,6 +408,41 @@ namespace LmbrCentral
         return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);
     }
 
+    void PolygonPrismShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outIsInside.size());
+
+        PolygonPrismSharedLockGuard lock(m_mutex, m_uniqueLockThreadId);
+        m_intersectionDataCache.UpdateIntersectionParams(
+            m_currentTransform, *m_polygonPrism, lock.GetMutexForIntersectionDataCache(), m_currentNonUniformScale);
+
+        const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            // initial early aabb rejection test
+            // note: will implicitly do height test too
+            outIsInside[index] =
+                aabb.Contains(points[index]) && PolygonPrismUtil::IsPointInside(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
+    void PolygonPrismShape::DistanceSquaredFromPointBatch(
+        AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outDistancesSquared.size());
+
+        PolygonPrismSharedLockGuard lock(m_mutex, m_uniqueLockThreadId);
+        m_intersectionDataCache.UpdateIntersectionParams(
+            m_currentTransform, *m_polygonPrism, lock.GetMutexForIntersectionDataCache(), m_currentNonUniformScale);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         PolygonPrismSharedLockGuard lock(m_mutex, m_uniqueLockThreadId);
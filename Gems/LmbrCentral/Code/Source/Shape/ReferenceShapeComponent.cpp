@@ -274,6 +274,45 @@ namespace LmbrCentral
         return result;
     }
 
+    void ReferenceShapeComponent::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+    {
+        AZStd::fill(outIsInside.begin(), outIsInside.end(), false);
+
+        AZStd::shared_lock lock(m_mutex);
+        if (AllowRequest())
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInsideBatch, points, outIsInside);
+        }
+    }
+
+    void ReferenceShapeComponent::DistanceFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistances) const
+    {
+        AZStd::fill(outDistances.begin(), outDistances.end(), FLT_MAX);
+
+        AZStd::shared_lock lock(m_mutex);
+        if (AllowRequest())
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceFromPointBatch, points,
+                outDistances);
+        }
+    }
+
+    void ReferenceShapeComponent::DistanceSquaredFromPointBatch(
+        AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+    {
+        AZStd::fill(outDistancesSquared.begin(), outDistancesSquared.end(), FLT_MAX);
+
+        AZStd::shared_lock lock(m_mutex);
+        if (AllowRequest())
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPointBatch, points,
+                outDistancesSquared);
+        }
+    }
+
     AZ::Vector3 ReferenceShapeComponent::GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) const
     {
         AZ::Vector3 result = AZ::Vector3::CreateZero();
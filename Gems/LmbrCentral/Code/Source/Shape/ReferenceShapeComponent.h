@@ -84,6 +84,9 @@ namespace LmbrCentral
         bool IsPointInside(const AZ::Vector3& point) const override;
         float DistanceFromPoint(const AZ::Vector3& point) const override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const override;
+        void DistanceFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistances) const override;
+        void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) const override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const override;
 
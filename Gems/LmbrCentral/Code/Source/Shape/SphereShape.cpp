@@ -131,6 +131,40 @@ namespace LmbrCentral
         return clampedDistance * clampedDistance;
     }
 
+    void SphereShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outIsInside.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
+
+        const AZ::Vector3 center = m_intersectionDataCache.m_position;
+        const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outIsInside[index] = AZ::Intersect::PointSphere(center, radiusSquared, points[index]);
+        }
+    }
+
+    void SphereShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outDistancesSquared.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
+
+        const AZ::Vector3 center = m_intersectionDataCache.m_position;
+        const float radius = m_intersectionDataCache.m_radius;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const float distance = (center - points[index]).GetLength() - radius;
+            const float clampedDistance = AZStd::max(distance, 0.0f);
+            outDistancesSquared[index] = clampedDistance * clampedDistance;
+        }
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         AZStd::shared_lock lock(m_mutex);
@@ -290,6 +290,30 @@ namespace LmbrCentral
         return AZStd::max(0.0f, (sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * uniformScale);
     }
 
+    void TubeShape::DistanceFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistances) const
+    {
+        AZ_Assert(points.size() == outDistances.size(), "input and output lists are different sizes (%zu vs %zu).",
+            points.size(), outDistances.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        AZ::Transform worldFromLocalNormalized = m_currentTransform;
+        const float uniformScale = worldFromLocalNormalized.ExtractUniformScale();
+        const AZ::Transform localFromWorldNormalized = worldFromLocalNormalized.GetInverse();
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3 localPoint = localFromWorldNormalized.TransformPoint(points[index]) / uniformScale;
+
+            const auto splineQueryResult = m_spline->GetNearestAddressPosition(localPoint);
+            const float variableRadius =
+                m_variableRadius.GetElementInterpolated(splineQueryResult.m_splineAddress, Lerpf);
+
+            // Make sure the distance is clamped to 0 for all points that exist within the tube.
+            outDistances[index] =
+                AZStd::max(0.0f, (sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * uniformScale);
+        }
+    }
+
     float TubeShape::DistanceSquaredFromPoint(const AZ::Vector3& point) const
     {
         float distance = DistanceFromPoint(point);
@@ -45,6 +45,7 @@ namespace LmbrCentral
         bool IsPointInside(const AZ::Vector3& point) const  override;
         float DistanceFromPoint(const AZ::Vector3& point) const override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void DistanceFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistances) const override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const override;
 
         // TubeShapeComponentRequestsBus
@@ -694,6 +694,20 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMax(), IsClose(shapeAabb.GetMax()));
     }
 
+    TEST_F(BoxShapeTest, BatchPointQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        CreateBoxWithNonUniformScale(
+            entity,
+            AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion(0.26f, 0.74f, 0.22f, 0.58f), AZ::Vector3(12.0f, -16.0f, 3.0f)),
+            AZ::Vector3(0.5f, 2.0f, 3.0f),
+            AZ::Vector3(4.0f, 3.0f, 7.0f));
+
+        ExpectBatchPointQueriesMatchPointQueries(
+            entity, AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, -28.0f, -9.0f), AZ::Vector3(24.0f, -4.0f, 15.0f)));
+    }
+
     TEST_F(BoxShapeTest, ShapeHasThreadsafeGetSetCalls)
     {
         // Verify that setting values from one thread and querying values from multiple other threads in parallel produces
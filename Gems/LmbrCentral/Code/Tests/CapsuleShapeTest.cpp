@@ -388,6 +388,20 @@ namespace UnitTest
         EXPECT_NEAR(distance, 2.0f, 1e-2f);
     }
 
+    TEST_F(CapsuleShapeTest, BatchPointQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        CreateCapsule(
+            entity,
+            AZ::Transform::CreateTranslation(AZ::Vector3(27.0f, 28.0f, 38.0f)) * AZ::Transform::CreateRotationX(AZ::Constants::QuarterPi) *
+                AZ::Transform::CreateUniformScale(2.5f),
+            0.5f,
+            2.0f);
+
+        ExpectBatchPointQueriesMatchPointQueries(
+            entity, AZ::Aabb::CreateFromMinMax(AZ::Vector3(22.0f, 23.0f, 33.0f), AZ::Vector3(32.0f, 33.0f, 43.0f)));
+    }
+
     TEST_F(CapsuleShapeTest, ShapeHasThreadsafeGetSetCalls)
     {
         // Verify that setting values from one thread and querying values from multiple other threads in parallel produces
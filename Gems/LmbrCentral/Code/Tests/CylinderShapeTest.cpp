@@ -14,6 +14,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CylinderShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace UnitTest
@@ -546,6 +547,18 @@ namespace UnitTest
         ::testing::ValuesIn(CylinderShapeDistanceFromPointTest::ShouldPass)
     );
 
+    TEST_F(CylinderShapeTest, BatchPointQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        CreateCylinder(
+            AZ::Transform::CreateTranslation(AZ::Vector3(5.0f, 5.0f, 5.0f)) * AZ::Transform::CreateRotationY(AZ::Constants::QuarterPi) *
+                AZ::Transform::CreateUniformScale(1.5f),
+            2.0f, 6.0f, entity);
+
+        ExpectBatchPointQueriesMatchPointQueries(
+            entity, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-5.0f, -5.0f, -5.0f), AZ::Vector3(15.0f, 15.0f, 15.0f)));
+    }
+
     TEST_F(CylinderShapeTest, ShapeHasThreadsafeGetSetCalls)
     {
         // Verify that setting values from one thread and querying values from multiple other threads in parallel produces
@@ -16,6 +16,7 @@
 #include <Shape/PolygonPrismShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace UnitTest
@@ -849,6 +850,28 @@ namespace UnitTest
         EXPECT_TRUE(polygonPrismMesh.m_triangles.empty());
     }
 
+    TEST_F(PolygonPrismShapeTest, BatchPointQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        CreatePolygonPrismWithNonUniformScale(
+            AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(AZ::Constants::QuarterPi), AZ::Vector3(2.0f, -1.0f, 3.0f)),
+            4.0f,
+            AZStd::vector<AZ::Vector2>(
+            {
+                AZ::Vector2(0.0f, 0.0f),
+                AZ::Vector2(0.0f, 6.0f),
+                AZ::Vector2(3.0f, 3.0f),
+                AZ::Vector2(6.0f, 6.0f),
+                AZ::Vector2(6.0f, 0.0f)
+            }),
+            AZ::Vector3(1.5f, 0.5f, 2.0f),
+            entity);
+
+        ExpectBatchPointQueriesMatchPointQueries(
+            entity, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-8.0f, -8.0f, -2.0f), AZ::Vector3(12.0f, 12.0f, 14.0f)));
+    }
+
     TEST_F(PolygonPrismShapeTest, ShapeHasThreadsafeGetSetCalls)
     {
         // Verify that setting values from one thread and querying values from multiple other threads in parallel produces
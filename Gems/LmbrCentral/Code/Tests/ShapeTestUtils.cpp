@@ -8,6 +8,8 @@
 
 #include <ShapeTestUtils.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/UnitTest/TestTypes.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 namespace UnitTest
@@ -19,4 +21,50 @@ namespace UnitTest
             inside, entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, point);
         return inside;
     }
+
+    void ExpectBatchPointQueriesMatchPointQueries(const AZ::Entity& entity, const AZ::Aabb& queryBounds)
+    {
+        constexpr int pointsPerAxis = 12;
+        const AZ::Vector3 step = queryBounds.GetExtents() / static_cast<float>(pointsPerAxis - 1);
+
+        AZStd::vector<AZ::Vector3> points;
+        points.reserve(pointsPerAxis * pointsPerAxis * pointsPerAxis);
+        for (int z = 0; z < pointsPerAxis; ++z)
+        {
+            for (int y = 0; y < pointsPerAxis; ++y)
+            {
+                for (int x = 0; x < pointsPerAxis; ++x)
+                {
+                    points.push_back(
+                        queryBounds.GetMin() +
+                        step * AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), aznumeric_cast<float>(z)));
+                }
+            }
+        }
+
+        AZStd::vector<bool> batchInside(points.size(), false);
+        AZStd::vector<float> batchDistances(points.size(), -1.0f);
+        AZStd::vector<float> batchDistancesSquared(points.size(), -1.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, points, batchInside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceFromPointBatch, points, batchDistances);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPointBatch, points, batchDistancesSquared);
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            float distance = -1.0f;
+            float distanceSquared = -1.0f;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                distance, entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceFromPoint, points[i]);
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                distanceSquared, entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[i]);
+
+            EXPECT_EQ(batchInside[i], IsPointInside(entity, points[i]));
+            // the batched queries hoist some of the math out of the loop, so allow for small rounding differences
+            EXPECT_NEAR(batchDistances[i], distance, 1e-3f * AZStd::max(1.0f, distance));
+            EXPECT_NEAR(batchDistancesSquared[i], distanceSquared, 1e-3f * AZStd::max(1.0f, distanceSquared));
+        }
+    }
 } // namespace UnitTest
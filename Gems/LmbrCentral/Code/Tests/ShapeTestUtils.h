@@ -10,6 +10,7 @@
 
 namespace AZ
 {
+    class Aabb;
     class Entity;
     class Vector3;
 } // namespace AZ
@@ -17,4 +18,8 @@ namespace AZ
 namespace UnitTest
 {
     bool IsPointInside(const AZ::Entity& entity, const AZ::Vector3& point);
+
+    //! Checks that the batched point queries of the shape on the entity match the single point queries,
+    //! over a grid of points covering the given bounds.
+    void ExpectBatchPointQueriesMatchPointQueries(const AZ::Entity& entity, const AZ::Aabb& queryBounds);
 } // namespace UnitTest
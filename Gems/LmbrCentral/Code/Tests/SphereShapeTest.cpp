@@ -343,6 +343,19 @@ namespace UnitTest
         EXPECT_NEAR(distance, 2.5f, 1e-2f);
     }
 
+    TEST_F(SphereShapeTest, BatchPointQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        CreateSphere(
+            entity,
+            AZ::Transform::CreateTranslation(AZ::Vector3(-30.0f, -30.0f, 22.0f)) * AZ::Transform::CreateUniformScale(2.0f),
+            1.2f,
+            AZ::Vector3(0.5f, -0.5f, 1.0f));
+
+        ExpectBatchPointQueriesMatchPointQueries(
+            entity, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-35.0f, -35.0f, 17.0f), AZ::Vector3(-25.0f, -25.0f, 27.0f)));
+    }
+
     TEST_F(SphereShapeTest, ShapeHasThreadsafeGetSetCalls)
     {
         // Verify that setting values from one thread and querying values from multiple other threads in parallel produces
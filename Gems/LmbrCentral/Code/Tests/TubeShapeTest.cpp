@@ -14,6 +14,7 @@
 #include <Shape/SplineComponent.h>
 #include <Shape/TubeShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace UnitTest
@@ -440,6 +441,18 @@ namespace UnitTest
         }
     }
 
+    TEST_F(TubeShapeTest, BatchPointQueriesMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        CreateTube(
+            AZ::Transform::CreateTranslation(AZ::Vector3(5.0f, 5.0f, 5.0f)) * AZ::Transform::CreateRotationZ(AZ::Constants::QuarterPi) *
+                AZ::Transform::CreateUniformScale(2.0f),
+            1.0f, entity);
+
+        ExpectBatchPointQueriesMatchPointQueries(
+            entity, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-5.0f, -5.0f, 0.0f), AZ::Vector3(15.0f, 15.0f, 10.0f)));
+    }
+
     TEST_F(TubeShapeTest, ShapeHasThreadsafeGetSetCalls)
     {
         // Verify that setting values from one thread and querying values from multiple other threads in parallel produces
@@ -14,6 +14,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -159,6 +160,46 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) const = 0;
 
+        /// @brief Checks if each point in a list is inside the shape or outside it
+        /// Shapes override this to take their lock and update their cached data once for the whole list.
+        /// @param points List of points to be tested
+        /// @param outIsInside Output list of whether each point is inside the shape, expected to be the same size as points
+        virtual void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outIsInside) const
+        {
+            AZ_Assert(points.size() == outIsInside.size(), "input and output lists are different sizes (%zu vs %zu).",
+                points.size(), outIsInside.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min distance each point in a list is from the shape
+        /// @param points List of points to calculate distances from
+        /// @param outDistances Output list of distances, expected to be the same size as points
+        virtual void DistanceFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistances) const
+        {
+            DistanceSquaredFromPointBatch(points, outDistances);
+            for (float& distance : outDistances)
+            {
+                distance = sqrtf(distance);
+            }
+        }
+
+        /// @brief Returns the min squared distance each point in a list is from the shape
+        /// Shapes override this to take their lock and update their cached data once for the whole list.
+        /// @param points List of points to calculate square distances from
+        /// @param outDistancesSquared Output list of square distances, expected to be the same size as points
+        virtual void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) const
+        {
+            AZ_Assert(points.size() == outDistancesSquared.size(), "input and output lists are different sizes (%zu vs %zu).",
+                points.size(), outDistancesSquared.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/) const
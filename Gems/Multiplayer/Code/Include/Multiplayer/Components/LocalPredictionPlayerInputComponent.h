@@ -113,6 +113,9 @@ namespace Multiplayer
 #endif
 
 #if AZ_TRAIT_SERVER
+        // Newest input of each recently accepted input array, clients may delta encode against any of these once acknowledged
+        NetworkInputHistory m_acknowledgedInputs;
+
         double m_clientBankedTime = 0.0;
         AZ::TimeMs m_lastInputReceivedTimeMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_lastCorrectionSentTimeMs = AZ::Time::ZeroTimeMs;
@@ -10,6 +10,8 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -54,6 +56,11 @@ namespace Multiplayer
             const Physics::ShapeConfiguration* m_shapeConfig = nullptr;
             AZ::Transform m_colliderOffSetTransform;
             const AZ::u32 m_jointIndex = 0;
+
+            // Primitive description used when recording into the HitVolumeHistory
+            HitVolumeShapeType m_shapeType = HitVolumeShapeType::Sphere;
+            AZ::Vector3 m_shapeDimensions = AZ::Vector3::CreateZero();
+            bool m_isRecordable = false;
         };
 
         AZ_MULTIPLAYER_COMPONENT(Multiplayer::NetworkHitVolumesComponent, s_networkHitVolumesComponentConcreteUuid, Multiplayer::NetworkHitVolumesComponentBase);
@@ -68,11 +75,14 @@ namespace Multiplayer
 
     private:
         void OnPreRender(float deltaTime);
+        void OnHostFrameCompleted();
         void OnTransformUpdate(const AZ::Transform& transform);
         void OnSyncRewind();
 
         void CreateHitVolumes();
         void DestroyHitVolumes();
+        void UpdateHitVolumeTransforms();
+        void RecordHitVolumeHistory();
 
         //! ActorComponentNotificationBus::Handler
         //! @{
@@ -96,6 +106,7 @@ namespace Multiplayer
 
         Multiplayer::EntitySyncRewindEvent::Handler m_syncRewindHandler;
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderHandler;
+        Multiplayer::HostFrameCompletedEvent::Handler m_hostFrameCompletedHandler;
         AZ::TransformChangedEvent::Handler m_transformChangedHandler;
 
         AzFramework::DebugDisplayRequests* m_debugDisplay = nullptr;
@@ -40,5 +40,10 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Multiplayer tick phases
+        MultiplayerStat_TickEntitiesTimeUs,         // Time spent ticking locally simulated network entities
+        MultiplayerStat_NotifyEntitiesTimeUs,       // Time spent dispatching deferred rpcs and collecting dirty entities
+        MultiplayerStat_UpdateConnectionsTimeUs,    // Time spent gathering and sending entity updates to all connections
     };
 }
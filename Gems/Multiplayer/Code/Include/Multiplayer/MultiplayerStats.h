@@ -49,6 +49,24 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Phases of the multiplayer tick that are timed individually.
+        enum class TickPhase : uint8_t
+        {
+            TickEntities,       // Ticking locally simulated network entities
+            NotifyEntities,     // Dispatching deferred rpcs and collecting dirty entities
+            UpdateConnections,  // Gathering and sending entity updates to every connection
+            Count
+        };
+        static const uint32_t TickPhaseCount = static_cast<uint32_t>(TickPhase::Count);
+
+        struct TickPhaseTiming
+        {
+            AZ::TimeUs m_lastTimeUs = AZ::Time::ZeroTimeUs;
+            AZ::TimeUs m_totalTimeUs = AZ::Time::ZeroTimeUs;
+            uint64_t m_totalCalls = 0;
+        };
+        AZStd::array<TickPhaseTiming, TickPhaseCount> m_tickPhaseTimings;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -58,6 +76,7 @@ namespace Multiplayer
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+        void RecordTickPhaseTime(TickPhase phase, AZ::TimeUs phaseTime);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
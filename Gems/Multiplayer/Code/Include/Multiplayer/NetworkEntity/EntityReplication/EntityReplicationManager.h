@@ -121,6 +121,8 @@ namespace Multiplayer
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
+        AZ::TimeMs GetProxyUpdateOverdueMs(const EntityReplicator& replicator, const ReplicationSet& replicationSet) const;
+        uint32_t GetAffordableProxyUpdateCount();
 
         void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
@@ -218,6 +220,11 @@ namespace Multiplayer
         uint32_t m_maxPayloadSize = 0;
         Mode m_updateMode = Mode::Invalid;
 
+        // Per connection bandwidth budget, refilled at sv_ReplicationBandwidthLimit bytes per second and drained by sent updates
+        AZ::TimeMs m_bandwidthBudgetUpdateTimeMs = AZ::Time::ZeroTimeMs;
+        double m_bandwidthBudgetBytes = 0.0;
+        float m_averageUpdateMessageSize = 0.0f;
+
         friend class EntityReplicator;
     };
 }
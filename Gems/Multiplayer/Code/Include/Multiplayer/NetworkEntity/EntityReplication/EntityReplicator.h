@@ -87,6 +87,8 @@ namespace Multiplayer
         EntityMigrationMessage GenerateMigrationPacket();
         //! After sending a generated packet, record the sent packet id for tracking acknowledgements.
         void RecordSentPacketId(AzNetworking::PacketId sentId);
+        //! Returns the frame time at which an update for this entity was last sent, used to throttle replication of low LOD entities.
+        AZ::TimeMs GetLastSentTimeMs() const;
 
         // Interface for ReplicationManager to manage receiving entity changes
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges);
@@ -156,6 +158,7 @@ namespace Multiplayer
         AzNetworking::IConnection* m_connection;
         NetEntityRole m_boundLocalNetworkRole;
         NetEntityRole m_remoteNetworkRole;
+        AZ::TimeMs m_lastSentTimeMs = AZ::Time::ZeroTimeMs;
 
         bool m_wasMigrated = false;
         bool m_isForwardingRpc = false;
@@ -50,4 +50,9 @@ namespace Multiplayer
     {
         m_wasMigrated = wasMigrated;
     }
+
+    inline AZ::TimeMs EntityReplicator::GetLastSentTimeMs() const
+    {
+        return m_lastSentTimeMs;
+    }
 }
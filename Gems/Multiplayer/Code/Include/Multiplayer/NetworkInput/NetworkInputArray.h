@@ -12,15 +12,19 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace Multiplayer
 {
     //! @class NetworkInputArray
     //! @brief An array of network inputs. Used to mitigate loss of input packets on the server. Compresses subsequent elements.
+    //! When delta serialization is enabled, the newest element can additionally be encoded against an input the server has
+    //! already acknowledged. Arrays received this way must be resolved with ApplyBaseline() before their inputs can be read.
     class NetworkInputArray final
     {
     public:
         static constexpr uint32_t MaxElements = 8; // Never try to replicate a list larger than this amount
+        static constexpr uint32_t MaxBaselineAge = 32; // Never encode against an acknowledged input older than this many inputs
 
         NetworkInputArray();
         NetworkInputArray(const ConstNetworkEntityHandle& entityHandle);
@@ -31,6 +35,24 @@ namespace Multiplayer
 
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Encodes the newest element as a delta against an input the server has acknowledged, rather than in full.
+        //! This has no effect unless net_useInputDeltaSerialization is enabled.
+        //! @param baseline the acknowledged input to encode against, the receiver must still have this input available
+        void SetBaseline(const NetworkInput& baseline);
+
+        //! Returns true if this array was received encoded against an acknowledged input and has not yet been resolved.
+        //! @return boolean true if ApplyBaseline() must be invoked before the inputs in this array are valid
+        bool RequiresBaseline() const;
+
+        //! Returns the client input id of the acknowledged input this array was encoded against.
+        //! @return the client input id of the baseline input
+        ClientInputId GetBaselineInputId() const;
+
+        //! Reconstructs the inputs in this array from the acknowledged input they were encoded against.
+        //! @param baseline the acknowledged input matching GetBaselineInputId()
+        //! @return boolean true if all inputs were successfully reconstructed
+        bool ApplyBaseline(const NetworkInput& baseline);
+
     private:
 
         struct Wrapper // Strictly a workaround to deal with the private constructor of NetworkInput
@@ -41,7 +63,13 @@ namespace Multiplayer
             NetworkInput m_networkInput;
         };
 
+        struct PendingDeltas; // Deltas received against a baseline, held until ApplyBaseline() is invoked
+
         ConstNetworkEntityHandle m_owner;
         AZStd::array<Wrapper, MaxElements> m_inputs;
+        Wrapper m_baseline;
+        ClientInputId m_baselineInputId = ClientInputId{ 0 };
+        bool m_hasBaseline = false;
+        AZStd::shared_ptr<PendingDeltas> m_pendingDeltas;
     };
 }
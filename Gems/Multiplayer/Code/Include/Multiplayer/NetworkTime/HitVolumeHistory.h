@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! The primitive shape types a hit volume snapshot can hold.
+    enum class HitVolumeShapeType : uint8_t
+    {
+        Sphere,  //!< Dimensions x holds the radius
+        Capsule, //!< Dimensions x holds the radius, y holds the total height along the local z axis
+        Box      //!< Dimensions hold the half extents
+    };
+
+    //! The result of a rewound hit volume raycast.
+    struct HitVolumeRaycastResult
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        float m_distance = 0.0f;
+        uint32_t m_hitVolumeIndex = 0; //!< Index of the hit volume within its owning entity
+    };
+
+    //! @class HitVolumeHistory
+    //! @brief Ring buffer of per host frame hit volume snapshots used for lag compensated queries.
+    //! Each snapshot stores the world space hit volumes of every recorded entity in structure-of-arrays form,
+    //! so that queries against a past host frame can run without rewinding and re-syncing the live physics scene.
+    class HitVolumeHistory
+    {
+    public:
+        HitVolumeHistory() = default;
+        ~HitVolumeHistory() = default;
+
+        //! Records a single world space hit volume for the provided host frame.
+        //! Recording for a frame newer than the current head advances the ring buffer and recycles the oldest snapshot.
+        //! Recording for a frame older than the current head is ignored.
+        //! @param frameId        the host frame the hit volume belongs to
+        //! @param netEntityId    the network entity that owns the hit volume
+        //! @param hitVolumeIndex the index of the hit volume within its owning entity
+        //! @param shapeType      the primitive shape of the hit volume
+        //! @param worldTransform the world space transform of the hit volume
+        //! @param dimensions     the shape dimensions, see HitVolumeShapeType
+        void RecordHitVolume
+        (
+            HostFrameId frameId,
+            NetEntityId netEntityId,
+            uint32_t hitVolumeIndex,
+            HitVolumeShapeType shapeType,
+            const AZ::Transform& worldTransform,
+            const AZ::Vector3& dimensions
+        );
+
+        //! Returns true if a snapshot exists for the provided host frame.
+        //! @param frameId the host frame to check
+        //! @return boolean true if the history contains the frame
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Returns the number of hit volumes recorded for the provided host frame.
+        //! @param frameId the host frame to check
+        //! @return the number of hit volumes in the snapshot, 0 if the frame is not present
+        uint32_t GetHitVolumeCount(HostFrameId frameId) const;
+
+        //! Performs a raycast against the hit volumes recorded for a past host frame.
+        //! @param frameId     the host frame to query
+        //! @param origin      the world space ray origin
+        //! @param direction   the normalized ray direction
+        //! @param maxDistance the maximum distance along the ray to consider
+        //! @param ignoreId    an entity to exclude from the query, useful for 'don't hit the shooter' semantics
+        //! @param outResult   the closest hit, if any
+        //! @return boolean true if a hit volume was hit
+        bool Raycast
+        (
+            HostFrameId frameId,
+            const AZ::Vector3& origin,
+            const AZ::Vector3& direction,
+            float maxDistance,
+            NetEntityId ignoreId,
+            HitVolumeRaycastResult& outResult
+        ) const;
+
+        //! Gathers all entities with a bounding sphere overlapping the query sphere for a past host frame.
+        //! Each overlapping entity is reported only once.
+        //! @param frameId     the host frame to query
+        //! @param center      the world space center of the query sphere
+        //! @param radius      the radius of the query sphere
+        //! @param outEntities the set of overlapping entities, appended to
+        //! @return the number of entities appended
+        uint32_t OverlapSphere
+        (
+            HostFrameId frameId,
+            const AZ::Vector3& center,
+            float radius,
+            AZStd::vector<NetEntityId>& outEntities
+        ) const;
+
+        //! Clears all recorded snapshots.
+        void Clear();
+
+    private:
+
+        //! A single host frame worth of hit volumes, stored as structure-of-arrays.
+        //! The broadphase arrays (center and bounding radius) are kept separate so a query can reject entries without touching the narrowphase data.
+        struct Snapshot
+        {
+            void Reset(HostFrameId frameId);
+
+            HostFrameId m_frameId = InvalidHostFrameId;
+
+            // Broadphase
+            AZStd::vector<float> m_centerX;
+            AZStd::vector<float> m_centerY;
+            AZStd::vector<float> m_centerZ;
+            AZStd::vector<float> m_boundingRadius;
+
+            // Narrowphase
+            AZStd::vector<AZ::Quaternion> m_rotation;
+            AZStd::vector<AZ::Vector3> m_dimensions;
+            AZStd::vector<HitVolumeShapeType> m_shapeType;
+
+            // Identification
+            AZStd::vector<NetEntityId> m_netEntityId;
+            AZStd::vector<uint32_t> m_hitVolumeIndex;
+        };
+
+        const Snapshot* FindSnapshot(HostFrameId frameId) const;
+
+        AZStd::array<Snapshot, RewindHistorySize> m_snapshots;
+        HostFrameId m_headFrameId = InvalidHostFrameId;
+        uint32_t m_headIndex = 0;
+    };
+}
@@ -8,12 +8,16 @@
 
 #pragma once
 
+#include <AzCore/EBus/Event.h>
 #include <AzCore/Time/ITime.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
 
 namespace Multiplayer
 {
+    using HostFrameCompletedEvent = AZ::Event<HostFrameId>;
+
     //! @class INetworkTime
     //! @brief This is an AZ::Interface<> for managing multiplayer specific time related operations.
     class INetworkTime
@@ -39,6 +43,10 @@ namespace Multiplayer
         //! Increments the hosts current frameId.
         virtual void IncrementHostFrameId() = 0;
 
+        //! Adds a handler invoked once per host frame, just before the hosts frameId is incremented.
+        //! @param handler the handler to add, it receives the frameId of the frame that just completed
+        virtual void AddHostFrameCompletedHandler(HostFrameCompletedEvent::Handler& handler) = 0;
+
         //! Retrieves the hosts current timeMs (may be rewound on the server during backward reconciliation).
         //! @return the hosts current timeMs
         virtual AZ::TimeMs GetHostTimeMs() const = 0;
@@ -71,6 +79,10 @@ namespace Multiplayer
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Retrieves the per host frame hit volume snapshots, used to run lag compensated queries without rewinding the physics scene.
+        //! @return reference to the hit volume history
+        virtual HitVolumeHistory& GetHitVolumeHistory() = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
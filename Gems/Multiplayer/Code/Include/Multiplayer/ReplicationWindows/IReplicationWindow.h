@@ -13,6 +13,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/Time/ITime.h>
 
 namespace Multiplayer
 {
@@ -22,6 +23,7 @@ namespace Multiplayer
     {
         NetEntityRole m_netEntityRole = NetEntityRole::InvalidRole;
         float m_priority = 0.0f;
+        AZ::TimeMs m_sendIntervalMs = AZ::Time::ZeroTimeMs; // Minimum time between updates to this entity, zero sends every tick
     };
     using ReplicationSet = AZStd::map<ConstNetworkEntityHandle, EntityReplicationData>;
     using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
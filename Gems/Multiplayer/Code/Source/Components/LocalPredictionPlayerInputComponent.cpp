@@ -189,18 +189,45 @@ namespace Multiplayer
             return;
         }
 
+        // Inputs encoded against an acknowledged input must be reconstructed from our history before they can be read
+        NetworkInputArray resolvedInputArray;
+        const NetworkInputArray* receivedInputArray = &inputArray;
+        if (inputArray.RequiresBaseline())
+        {
+            const ClientInputId baselineInputId = inputArray.GetBaselineInputId();
+            const NetworkInput* baseline = nullptr;
+            for (AZStd::size_t i = m_acknowledgedInputs.Size(); i > 0; --i)
+            {
+                if (m_acknowledgedInputs[i - 1].GetClientInputId() == baselineInputId)
+                {
+                    baseline = &m_acknowledgedInputs[i - 1];
+                    break;
+                }
+            }
+
+            resolvedInputArray = inputArray;
+            if ((baseline == nullptr) || !resolvedInputArray.ApplyBaseline(*baseline))
+            {
+                // Can happen after a migration, clear the acknowledgement so the client falls back to sending full inputs
+                AZLOG(NET_Prediction, "Discarding move input encoded against unknown baseline (baseline: %u)", aznumeric_cast<uint32_t>(baselineInputId));
+                SetAckedInputId(ClientInputId{ 0 });
+                return;
+            }
+            receivedInputArray = &resolvedInputArray;
+        }
+
         // After receiving the first input from the client, start the update event to check for slow hacking.
         // Also initialize the lastClientInputId to one before the oldest available one in the inputArray so that
         // we process everything available to us on the first call.
         if (!m_updateBankedTimeEvent.IsScheduled())
         {
             // This subtraction intentionally wraps around.
-            m_lastClientInputId = inputArray[NetworkInputArray::MaxElements - 1].GetClientInputId() - ClientInputId(1);
+            m_lastClientInputId = (*receivedInputArray)[NetworkInputArray::MaxElements - 1].GetClientInputId() - ClientInputId(1);
 
             m_updateBankedTimeEvent.Enqueue(sv_InputUpdateTimeMs, true);
         }
 
-        const ClientInputId clientInputId = inputArray[0].GetClientInputId();
+        const ClientInputId clientInputId = (*receivedInputArray)[0].GetClientInputId();
         if (!AzNetworking::SequenceMoreRecent(clientInputId, m_lastClientInputId))
         {
             AZLOG(NET_Prediction, "Discarding old or out of order move input (current: %u, received %u)",
@@ -213,9 +240,17 @@ namespace Multiplayer
         m_lastInputReceivedTimeMs = currentTimeMs;
 
         // Keep track of last inputs received, also allows us to update frame ids
-        m_lastInputReceived = inputArray;
+        m_lastInputReceived = *receivedInputArray;
         SetLastInputId(m_lastInputReceived[0].GetClientInputId()); // Set this variable in case of migration
 
+        // Acknowledge the newest input so the client can delta encode subsequent inputs against it
+        m_acknowledgedInputs.PushBack(m_lastInputReceived[0]);
+        while (m_acknowledgedInputs.Size() > NetworkInputArray::MaxBaselineAge)
+        {
+            m_acknowledgedInputs.PopFront();
+        }
+        SetAckedInputId(clientInputId);
+
         // Since id values can wrap around, we intentionally compare with a "!=" instead of a "<".
         while (m_lastClientInputId != clientInputId)
         {
@@ -650,6 +685,22 @@ namespace Multiplayer
                 inputArray[static_cast<uint32_t>(i)] = m_inputHistory[historyIndex];
             }
 
+            // If the server has acknowledged a recent input that we still have, encode against it rather than sending the newest input in full
+            // The server only retains MaxBaselineAge acknowledged inputs, so anything older is no longer guaranteed to be available
+            const ClientInputId ackedInputId = GetAckedInputId();
+            const uint32_t ackedInputAge = aznumeric_cast<uint32_t>(m_clientInputId - ackedInputId); // The subtraction intentionally wraps around
+            if ((ackedInputId != ClientInputId{ 0 }) && (ackedInputAge > 0) && (ackedInputAge < NetworkInputArray::MaxBaselineAge))
+            {
+                for (AZStd::size_t i = m_inputHistory.Size(); i > 0; --i)
+                {
+                    if (m_inputHistory[i - 1].GetClientInputId() == ackedInputId)
+                    {
+                        inputArray.SetBaseline(m_inputHistory[i - 1]);
+                        break;
+                    }
+                }
+            }
+
 #ifndef AZ_RELEASE_BUILD
             if (cl_EnableDesyncDebugging)
             {
@@ -21,6 +21,7 @@ namespace Multiplayer
     AZ_CVAR(float, bg_DrawDebugHitVolumeLifetime, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The lifetime for hit volume draw-debug shapes");
 
     AZ_CVAR(float, bg_RewindPositionTolerance, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta position is less than this value");
+    AZ_CVAR(bool, sv_RecordHitVolumeHistory, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, authoritative hit volumes are recorded each host frame for lag compensated queries");
     AZ_CVAR(float, bg_RewindOrientationTolerance, 0.001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta orientation is less than this value");
 
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
@@ -40,6 +41,25 @@ namespace Multiplayer
 
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
+        if (const Physics::SphereShapeConfiguration* sphereShape = azrtti_cast<const Physics::SphereShapeConfiguration*>(m_shapeConfig))
+        {
+            m_shapeType = HitVolumeShapeType::Sphere;
+            m_shapeDimensions = AZ::Vector3(sphereShape->m_radius, 0.0f, 0.0f);
+            m_isRecordable = true;
+        }
+        else if (const Physics::CapsuleShapeConfiguration* capsuleShape = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(m_shapeConfig))
+        {
+            m_shapeType = HitVolumeShapeType::Capsule;
+            m_shapeDimensions = AZ::Vector3(capsuleShape->m_radius, capsuleShape->m_height, 0.0f);
+            m_isRecordable = true;
+        }
+        else if (const Physics::BoxShapeConfiguration* boxShape = azrtti_cast<const Physics::BoxShapeConfiguration*>(m_shapeConfig))
+        {
+            m_shapeType = HitVolumeShapeType::Box;
+            m_shapeDimensions = boxShape->m_dimensions * 0.5f;
+            m_isRecordable = true;
+        }
+
         if (m_colliderConfig->m_isExclusive)
         {
             Physics::SystemRequestBus::BroadcastResult(m_physicsShape, &Physics::SystemRequests::CreateShape, *m_colliderConfig, *m_shapeConfig);
@@ -110,6 +130,7 @@ namespace Multiplayer
     NetworkHitVolumesComponent::NetworkHitVolumesComponent()
         : m_syncRewindHandler([this]() { OnSyncRewind(); })
         , m_preRenderHandler([this](float deltaTime) { OnPreRender(deltaTime); })
+        , m_hostFrameCompletedHandler([this](HostFrameId) { OnHostFrameCompleted(); })
         , m_transformChangedHandler([this](const AZ::Transform&, const AZ::Transform& worldTm) { OnTransformUpdate(worldTm); })
     {
         ;
@@ -126,6 +147,10 @@ namespace Multiplayer
         GetNetBindComponent()->AddEntitySyncRewindEventHandler(m_syncRewindHandler);
         GetNetBindComponent()->AddEntityPreRenderEventHandler(m_preRenderHandler);
         GetTransformComponent()->BindTransformChangedEventHandler(m_transformChangedHandler);
+        if (INetworkTime* networkTime = GetNetworkTime())
+        {
+            networkTime->AddHostFrameCompletedHandler(m_hostFrameCompletedHandler);
+        }
         OnTransformUpdate(GetTransformComponent()->GetWorldTM());
 
         // During activation the character controller is not created yet.
@@ -149,6 +174,7 @@ namespace Multiplayer
         m_debugDisplay = nullptr;
         m_syncRewindHandler.Disconnect();
         m_preRenderHandler.Disconnect();
+        m_hostFrameCompletedHandler.Disconnect();
         m_transformChangedHandler.Disconnect();
         DestroyHitVolumes();
         Physics::CharacterNotificationBus::Handler::BusDisconnect();
@@ -156,6 +182,27 @@ namespace Multiplayer
     }
 
     void NetworkHitVolumesComponent::OnPreRender([[maybe_unused]] float deltaTime)
+    {
+        UpdateHitVolumeTransforms();
+
+        if (bg_DrawArticulatedHitVolumes)
+        {
+            DrawDebugHitVolumes();
+        }
+    }
+
+    void NetworkHitVolumesComponent::OnHostFrameCompleted()
+    {
+        // Recorded from the host frame rather than from rendering, so every authoritative entity gets exactly one snapshot per host frame,
+        // including entities that are culled and entities on headless servers
+        if (sv_RecordHitVolumeHistory && IsNetEntityRoleAuthority())
+        {
+            UpdateHitVolumeTransforms();
+            RecordHitVolumeHistory();
+        }
+    }
+
+    void NetworkHitVolumesComponent::UpdateHitVolumeTransforms()
     {
         if (m_animatedHitVolumes.empty())
         {
@@ -169,11 +216,6 @@ namespace Multiplayer
             m_actorComponent->GetJointTransformComponents(hitVolume.m_jointIndex, EMotionFX::Integration::Space::ModelSpace, position, rotation, scale);
             hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
         }
-
-        if (bg_DrawArticulatedHitVolumes)
-        {
-            DrawDebugHitVolumes();
-        }
     }
 
     void NetworkHitVolumesComponent::OnTransformUpdate([[maybe_unused]] const AZ::Transform& transform)
@@ -234,6 +276,31 @@ namespace Multiplayer
         m_animatedHitVolumes.clear();
     }
 
+    void NetworkHitVolumesComponent::RecordHitVolumeHistory()
+    {
+        INetworkTime* networkTime = GetNetworkTime();
+        if (networkTime == nullptr || networkTime->IsTimeRewound())
+        {
+            return;
+        }
+
+        // Snapshots are recorded in world space so rewound queries never need to touch the live physics scene
+        const HostFrameId frameId = networkTime->GetUnalteredHostFrameId();
+        const NetEntityId netEntityId = GetNetEntityId();
+        const AZ::Transform& worldTransform = GetTransformComponent()->GetWorldTM();
+        HitVolumeHistory& hitVolumeHistory = networkTime->GetHitVolumeHistory();
+
+        for (uint32_t hitVolumeIndex = 0; hitVolumeIndex < m_animatedHitVolumes.size(); ++hitVolumeIndex)
+        {
+            const AnimatedHitVolume& hitVolume = m_animatedHitVolumes[hitVolumeIndex];
+            if (hitVolume.m_isRecordable)
+            {
+                hitVolumeHistory.RecordHitVolume(frameId, netEntityId, hitVolumeIndex, hitVolume.m_shapeType,
+                    worldTransform * hitVolume.m_transform.Get(), hitVolume.m_shapeDimensions);
+            }
+        }
+    }
+
     void NetworkHitVolumesComponent::OnActorInstanceCreated([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
     {
         m_actorComponent = EMotionFX::Integration::ActorComponentRequestBus::FindFirstHandler(GetEntity()->GetId());
@@ -263,4 +263,27 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    void MultiplayerStats::RecordTickPhaseTime(TickPhase phase, AZ::TimeUs phaseTime)
+    {
+        TickPhaseTiming& timing = m_tickPhaseTimings[static_cast<uint32_t>(phase)];
+        timing.m_lastTimeUs = phaseTime;
+        timing.m_totalTimeUs += phaseTime;
+        ++timing.m_totalCalls;
+
+        switch (phase)
+        {
+        case TickPhase::TickEntities:
+            SET_PERFORMANCE_STAT(MultiplayerStat_TickEntitiesTimeUs, phaseTime);
+            break;
+        case TickPhase::NotifyEntities:
+            SET_PERFORMANCE_STAT(MultiplayerStat_NotifyEntitiesTimeUs, phaseTime);
+            break;
+        case TickPhase::UpdateConnections:
+            SET_PERFORMANCE_STAT(MultiplayerStat_UpdateConnectionsTimeUs, phaseTime);
+            break;
+        default:
+            break;
+        }
+    }
 } // namespace Multiplayer
@@ -132,7 +132,12 @@ namespace Multiplayer
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
-    
+
+    static AZ::TimeUs GetTimeSinceUs(const AZStd::chrono::steady_clock::time_point& startTime)
+    {
+        const auto duration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        return AZ::TimeUs{ duration.count() };
+    }
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -359,6 +364,10 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TickEntitiesTimeUs, "TickEntitiesTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_NotifyEntitiesTimeUs, "NotifyEntitiesTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_UpdateConnectionsTimeUs, "UpdateConnectionsTimeUs");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -579,7 +588,11 @@ namespace Multiplayer
         const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
         const float serverRateSeconds = static_cast<float>(serverRateMs) / 1000.0f;
 
+        MultiplayerStats& stats = GetStats();
+
+        AZStd::chrono::steady_clock::time_point startPhaseTime = AZStd::chrono::steady_clock::now();
         TickVisibleNetworkEntities(deltaTime, serverRateSeconds);
+        stats.RecordTickPhaseTime(MultiplayerStats::TickPhase::TickEntities, GetTimeSinceUs(startPhaseTime));
 
         if (GetAgentType() == MultiplayerAgentType::ClientServer
          || GetAgentType() == MultiplayerAgentType::DedicatedServer)
@@ -593,6 +606,8 @@ namespace Multiplayer
             m_networkTime.IncrementHostFrameId();
         }
 
+        startPhaseTime = AZStd::chrono::steady_clock::now();
+
         // Handle deferred local rpc messages that were generated during the updates
         m_networkEntityManager.DispatchLocalDeferredRpcMessages();
 
@@ -603,8 +618,8 @@ namespace Multiplayer
         // Let the network system know the frame is done and we can collect dirty bits
         m_networkEntityManager.NotifyEntitiesChanged();
         m_networkEntityManager.NotifyEntitiesDirtied();
+        stats.RecordTickPhaseTime(MultiplayerStats::TickPhase::NotifyEntities, GetTimeSinceUs(startPhaseTime));
 
-        MultiplayerStats& stats = GetStats();
         stats.TickStats(deltaTimeMs);
         stats.m_entityCount = GetNetworkEntityManager()->GetEntityCount();
         stats.m_serverConnectionCount = 0;
@@ -614,7 +629,9 @@ namespace Multiplayer
         UpdatedMetricsConnectionCount();
 
         // Send out the game state update to all connections
+        startPhaseTime = AZStd::chrono::steady_clock::now();
         UpdateConnections();
+        stats.RecordTickPhaseTime(MultiplayerStats::TickPhase::UpdateConnections, GetTimeSinceUs(startPhaseTime));
 
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
@@ -645,9 +662,7 @@ namespace Multiplayer
             m_networkInterface->GetConnectionSet().VisitConnections(visitor);
         }
 
-        const auto duration =
-            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startMultiplayerTickTime);
-        stats.RecordFrameTime(AZ::TimeUs{ duration.count() });
+        stats.RecordFrameTime(GetTimeSinceUs(startMultiplayerTickTime));
     }
 
     void MultiplayerSystemComponent::UpdatedMetricsConnectionCount()
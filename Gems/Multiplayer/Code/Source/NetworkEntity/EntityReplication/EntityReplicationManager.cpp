@@ -23,6 +23,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -35,6 +36,8 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(uint32_t, sv_ReplicationBandwidthLimit, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum entity update bytes per second sent to each connection, proxy updates beyond this are deferred. 0 is unlimited");
+    AZ_CVAR(float, sv_ReplicationBandwidthBurstSec, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null, "Seconds of unused replication bandwidth a connection may accumulate and spend in a single burst");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -184,7 +187,11 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
+        // Proxy updates that are due this frame, along with how overdue they are
+        using ProxyUpdateCandidate = AZStd::pair<AZ::TimeMs, EntityReplicator*>;
+        AZStd::vector<ProxyUpdateCandidate> proxyCandidates;
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -217,15 +224,22 @@ namespace Multiplayer
                             m_remoteEntitiesPendingCreation.insert(entityId);
                         }
 
+                        // Autonomous updates, creates and deletes are never throttled by the proxy send count or bandwidth limits
                         if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
-                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous)
+                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous ||
+                            !replicator->IsRemoteReplicatorEstablished() ||
+                            replicator->IsMarkedForRemoval())
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            // Proxies that aren't due yet stay pending, their changes accumulate in the pending record until they are sent
+                            const AZ::TimeMs overdueMs = GetProxyUpdateOverdueMs(*replicator, replicationSet);
+                            if (overdueMs >= AZ::Time::ZeroTimeMs)
+                            {
+                                proxyCandidates.emplace_back(overdueMs, replicator);
+                            }
                         }
                     }
                 }
@@ -242,9 +256,54 @@ namespace Multiplayer
             }
         }
 
+        // Schedule the most overdue proxies first, anything deferred by the send count or bandwidth limits becomes more overdue
+        // and moves up the queue, so every relevant entity is eventually updated regardless of its net entity id
+        AZStd::sort(proxyCandidates.begin(), proxyCandidates.end(),
+            [](const ProxyUpdateCandidate& lhs, const ProxyUpdateCandidate& rhs) { return lhs.first > rhs.first; });
+
+        const uint32_t maxProxySendCount = AZStd::min(m_replicationWindow->GetMaxProxyEntityReplicatorSendCount(), GetAffordableProxyUpdateCount());
+        const uint32_t proxySendCount = AZStd::min(aznumeric_cast<uint32_t>(proxyCandidates.size()), maxProxySendCount);
+        for (uint32_t i = 0; i < proxySendCount; ++i)
+        {
+            toSendList.push_back(proxyCandidates[i].second);
+        }
+
         return toSendList;
     }
 
+    AZ::TimeMs EntityReplicationManager::GetProxyUpdateOverdueMs(const EntityReplicator& replicator, const ReplicationSet& replicationSet) const
+    {
+        auto iter = replicationSet.find(replicator.GetEntityHandle());
+        const AZ::TimeMs sendIntervalMs = (iter != replicationSet.end()) ? iter->second.m_sendIntervalMs : AZ::Time::ZeroTimeMs;
+        return m_frameTimeMs - replicator.GetLastSentTimeMs() - sendIntervalMs;
+    }
+
+    uint32_t EntityReplicationManager::GetAffordableProxyUpdateCount()
+    {
+        const uint32_t bandwidthLimit = sv_ReplicationBandwidthLimit;
+        if (bandwidthLimit == 0)
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+
+        // Refill the budget for the time elapsed since the last send, capped so an idle connection can't burst indefinitely
+        const double elapsedSec = AZ::TimeMsToSecondsDouble(m_frameTimeMs - m_bandwidthBudgetUpdateTimeMs);
+        const double maxBudgetBytes = bandwidthLimit * static_cast<double>(sv_ReplicationBandwidthBurstSec);
+        m_bandwidthBudgetBytes = AZStd::min(m_bandwidthBudgetBytes + bandwidthLimit * elapsedSec, maxBudgetBytes);
+        m_bandwidthBudgetUpdateTimeMs = m_frameTimeMs;
+
+        if (m_bandwidthBudgetBytes <= 0.0)
+        {
+            return 0;
+        }
+
+        // Actual message sizes aren't known until the updates are serialized, so estimate from the recent average
+        // Any overspend is paid back from the next frames budget
+        const double estimatedMessageSize = AZStd::max(static_cast<double>(m_averageUpdateMessageSize), 1.0);
+        const double affordableCount = m_bandwidthBudgetBytes / estimatedMessageSize + 1.0;
+        return static_cast<uint32_t>(AZStd::min(affordableCount, static_cast<double>(AZStd::numeric_limits<uint32_t>::max())));
+    }
+
     void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
@@ -285,6 +344,17 @@ namespace Multiplayer
             }
         }
 
+        if (!entityUpdates.empty() && (sv_ReplicationBandwidthLimit > 0))
+        {
+            // Track the cost of updates against this connections bandwidth budget
+            constexpr float AverageUpdateSizeWeight = 0.1f;
+            const float averageMessageSize = static_cast<float>(pendingPacketSize) / static_cast<float>(entityUpdates.size());
+            m_averageUpdateMessageSize = (m_averageUpdateMessageSize > 0.0f)
+                ? m_averageUpdateMessageSize + (averageMessageSize - m_averageUpdateMessageSize) * AverageUpdateSizeWeight
+                : averageMessageSize;
+            m_bandwidthBudgetBytes -= pendingPacketSize + UdpPacketHeaderSerializeSize;
+        }
+
         if (m_replicationWindow)
         {
             const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
@@ -625,6 +625,7 @@ namespace Multiplayer
         {
             m_propertyPublisher->FinalizeSerialization(sentId);
         }
+        m_lastSentTimeMs = m_replicationManager.GetFrameTimeMs();
     }
 
     void EntityReplicator::DeferRpcMessage(NetworkEntityRpcMessage& entityRpcMessage)
@@ -10,6 +10,7 @@
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace Multiplayer
 {
@@ -46,58 +47,161 @@ namespace Multiplayer
         return m_inputs[index].m_networkInput;
     }
 
+    struct NetworkInputArray::PendingDeltas
+    {
+        AZStd::array<AzNetworking::SerializerDelta, MaxElements> m_deltas;
+    };
+
+    static bool WriteInputDelta(AzNetworking::ISerializer& serializer, NetworkInput& base, NetworkInput& current)
+    {
+        AzNetworking::SerializerDelta deltaSerializer;
+        // Create the delta
+        AzNetworking::DeltaSerializerCreate createSerializer(deltaSerializer);
+        if (!createSerializer.CreateDelta(base, current))
+        {
+            return false;
+        }
+        // Then write out the delta
+        return deltaSerializer.Serialize(serializer);
+    }
+
+    static bool ApplyInputDelta(AzNetworking::SerializerDelta& deltaSerializer, const NetworkInput& base, NetworkInput& current)
+    {
+        // Start with the base value
+        current = base;
+        // Then apply delta
+        AzNetworking::DeltaSerializerApply applySerializer(deltaSerializer);
+        return applySerializer.ApplyDelta(current);
+    }
+
     bool NetworkInputArray::Serialize(AzNetworking::ISerializer& serializer)
     {
-        if (net_useInputDeltaSerialization)
+        if (!net_useInputDeltaSerialization)
+        {
+            return serializer.Serialize(m_inputs, "InputArray");
+        }
+
+        // Use delta-serialization to compress input RPC bandwidth usage
+        // The first element is either serialized in full, or as a delta against an input the server has acknowledged
+        serializer.Serialize(m_hasBaseline, "HasBaseline");
+        if (m_hasBaseline)
+        {
+            serializer.Serialize(m_baselineInputId, "BaselineInputId");
+        }
+
+        if (!serializer.IsValid())
         {
-            // Use delta-serialization to compress input RPC bandwidth usage
-            // Always serialize the full first element
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+        {
+            if (m_hasBaseline)
+            {
+                // The baseline lives in the receivers history, so hold on to the deltas until ApplyBaseline() is invoked
+                m_pendingDeltas = AZStd::make_shared<PendingDeltas>();
+                for (AzNetworking::SerializerDelta& deltaSerializer : m_pendingDeltas->m_deltas)
+                {
+                    if (!deltaSerializer.Serialize(serializer))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            m_pendingDeltas.reset();
             if (!m_inputs[0].m_networkInput.Serialize(serializer))
             {
                 return false;
             }
 
-            // For each subsequent element
+            // Each subsequent element is a delta against the previous one
             for (uint32_t i = 1; i < m_inputs.size(); ++i)
             {
-                if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+                AzNetworking::SerializerDelta deltaSerializer;
+                // Read out the delta
+                if (!deltaSerializer.Serialize(serializer))
                 {
-                    AzNetworking::SerializerDelta deltaSerializer;
-                    // Read out the delta
-                    if (!deltaSerializer.Serialize(serializer))
-                    {
-                        return false;
-                    }
-                    // Start with previous value
-                    m_inputs[i].m_networkInput = m_inputs[i - 1].m_networkInput;
-                    // Then apply delta
-                    AzNetworking::DeltaSerializerApply applySerializer(deltaSerializer);
-                    if (!applySerializer.ApplyDelta(m_inputs[i].m_networkInput))
-                    {
-                        return false;
-                    }
+                    return false;
                 }
-                else
+                if (!ApplyInputDelta(deltaSerializer, m_inputs[i - 1].m_networkInput, m_inputs[i].m_networkInput))
                 {
-                    AzNetworking::SerializerDelta deltaSerializer;
-                    // Create the delta
-                    AzNetworking::DeltaSerializerCreate createSerializer(deltaSerializer);
-                    if (!createSerializer.CreateDelta(m_inputs[i - 1].m_networkInput, m_inputs[i].m_networkInput))
-                    {
-                        return false;
-                    }
-                    // Then write out the delta
-                    if (!deltaSerializer.Serialize(serializer))
-                    {
-                        return false;
-                    }
+                    return false;
                 }
             }
         }
         else
         {
-            return serializer.Serialize(m_inputs, "InputArray");
+            if (m_hasBaseline)
+            {
+                if (!WriteInputDelta(serializer, m_baseline.m_networkInput, m_inputs[0].m_networkInput))
+                {
+                    return false;
+                }
+            }
+            else if (!m_inputs[0].m_networkInput.Serialize(serializer))
+            {
+                return false;
+            }
+
+            // Each subsequent element is a delta against the previous one
+            for (uint32_t i = 1; i < m_inputs.size(); ++i)
+            {
+                if (!WriteInputDelta(serializer, m_inputs[i - 1].m_networkInput, m_inputs[i].m_networkInput))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void NetworkInputArray::SetBaseline(const NetworkInput& baseline)
+    {
+        m_baseline.m_networkInput = baseline;
+        m_baselineInputId = baseline.GetClientInputId();
+        m_hasBaseline = true;
+    }
+
+    bool NetworkInputArray::RequiresBaseline() const
+    {
+        return m_pendingDeltas != nullptr;
+    }
+
+    ClientInputId NetworkInputArray::GetBaselineInputId() const
+    {
+        return m_baselineInputId;
+    }
+
+    bool NetworkInputArray::ApplyBaseline(const NetworkInput& baseline)
+    {
+        if (m_pendingDeltas == nullptr)
+        {
+            return true;
+        }
+
+        if (baseline.GetClientInputId() != m_baselineInputId)
+        {
+            return false;
         }
+
+        // Deltas may be shared with other copies of this array, so they are only ever read from here
+        AZStd::shared_ptr<PendingDeltas> pendingDeltas = AZStd::move(m_pendingDeltas);
+        if (!ApplyInputDelta(pendingDeltas->m_deltas[0], baseline, m_inputs[0].m_networkInput))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 1; i < m_inputs.size(); ++i)
+        {
+            if (!ApplyInputDelta(pendingDeltas->m_deltas[i], m_inputs[i - 1].m_networkInput, m_inputs[i].m_networkInput))
+            {
+                return false;
+            }
+        }
+
+        m_hasBaseline = false;
         return true;
     }
 }
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/Obb.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    static float ComputeBoundingRadius(HitVolumeShapeType shapeType, const AZ::Vector3& dimensions)
+    {
+        switch (shapeType)
+        {
+        case HitVolumeShapeType::Sphere:
+            return dimensions.GetX();
+        case HitVolumeShapeType::Capsule:
+            return AZStd::max(dimensions.GetX(), dimensions.GetY() * 0.5f);
+        case HitVolumeShapeType::Box:
+            return dimensions.GetLength();
+        }
+        return 0.0f;
+    }
+
+    void HitVolumeHistory::Snapshot::Reset(HostFrameId frameId)
+    {
+        // Clearing retains capacity, so steady state recording performs no allocations
+        m_frameId = frameId;
+        m_centerX.clear();
+        m_centerY.clear();
+        m_centerZ.clear();
+        m_boundingRadius.clear();
+        m_rotation.clear();
+        m_dimensions.clear();
+        m_shapeType.clear();
+        m_netEntityId.clear();
+        m_hitVolumeIndex.clear();
+    }
+
+    void HitVolumeHistory::RecordHitVolume
+    (
+        HostFrameId frameId,
+        NetEntityId netEntityId,
+        uint32_t hitVolumeIndex,
+        HitVolumeShapeType shapeType,
+        const AZ::Transform& worldTransform,
+        const AZ::Vector3& dimensions
+    )
+    {
+        if (m_headFrameId == InvalidHostFrameId)
+        {
+            m_headIndex = 0;
+            m_headFrameId = frameId;
+            m_snapshots[m_headIndex].Reset(frameId);
+        }
+        else if (frameId > m_headFrameId)
+        {
+            // Advance the head, invalidating any frames that were skipped so lookups by frame offset remain valid
+            const uint32_t frameDelta = static_cast<uint32_t>(frameId - m_headFrameId);
+            const uint32_t framesToReset = AZStd::min<uint32_t>(frameDelta, RewindHistorySize);
+            for (uint32_t i = 1; i <= framesToReset; ++i)
+            {
+                const HostFrameId slotFrameId = (i == frameDelta) ? frameId : InvalidHostFrameId;
+                m_snapshots[(m_headIndex + i) % RewindHistorySize].Reset(slotFrameId);
+            }
+            m_headIndex = (m_headIndex + frameDelta) % RewindHistorySize;
+            m_headFrameId = frameId;
+            m_snapshots[m_headIndex].m_frameId = frameId;
+        }
+        else if (frameId < m_headFrameId)
+        {
+            // History is append only, we never rewrite the past
+            return;
+        }
+
+        const AZ::Vector3 scaledDimensions = dimensions * worldTransform.GetUniformScale();
+        const AZ::Vector3& center = worldTransform.GetTranslation();
+
+        Snapshot& snapshot = m_snapshots[m_headIndex];
+        snapshot.m_centerX.push_back(center.GetX());
+        snapshot.m_centerY.push_back(center.GetY());
+        snapshot.m_centerZ.push_back(center.GetZ());
+        snapshot.m_boundingRadius.push_back(ComputeBoundingRadius(shapeType, scaledDimensions));
+        snapshot.m_rotation.push_back(worldTransform.GetRotation());
+        snapshot.m_dimensions.push_back(scaledDimensions);
+        snapshot.m_shapeType.push_back(shapeType);
+        snapshot.m_netEntityId.push_back(netEntityId);
+        snapshot.m_hitVolumeIndex.push_back(hitVolumeIndex);
+    }
+
+    bool HitVolumeHistory::HasFrame(HostFrameId frameId) const
+    {
+        return FindSnapshot(frameId) != nullptr;
+    }
+
+    uint32_t HitVolumeHistory::GetHitVolumeCount(HostFrameId frameId) const
+    {
+        const Snapshot* snapshot = FindSnapshot(frameId);
+        return (snapshot != nullptr) ? aznumeric_cast<uint32_t>(snapshot->m_netEntityId.size()) : 0;
+    }
+
+    bool HitVolumeHistory::Raycast
+    (
+        HostFrameId frameId,
+        const AZ::Vector3& origin,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        NetEntityId ignoreId,
+        HitVolumeRaycastResult& outResult
+    ) const
+    {
+        const Snapshot* snapshot = FindSnapshot(frameId);
+        if (snapshot == nullptr)
+        {
+            return false;
+        }
+
+        const float originX = origin.GetX();
+        const float originY = origin.GetY();
+        const float originZ = origin.GetZ();
+        const float directionX = direction.GetX();
+        const float directionY = direction.GetY();
+        const float directionZ = direction.GetZ();
+
+        float closestDistance = maxDistance;
+        bool hasHit = false;
+
+        const size_t hitVolumeCount = snapshot->m_netEntityId.size();
+        for (size_t index = 0; index < hitVolumeCount; ++index)
+        {
+            // Broadphase, ray against bounding sphere using only the packed float arrays
+            const float toCenterX = snapshot->m_centerX[index] - originX;
+            const float toCenterY = snapshot->m_centerY[index] - originY;
+            const float toCenterZ = snapshot->m_centerZ[index] - originZ;
+            const float radius = snapshot->m_boundingRadius[index];
+            const float projection = toCenterX * directionX + toCenterY * directionY + toCenterZ * directionZ;
+            const float centerDistanceSq = toCenterX * toCenterX + toCenterY * toCenterY + toCenterZ * toCenterZ;
+            const float perpendicularDistanceSq = centerDistanceSq - projection * projection;
+            if ((perpendicularDistanceSq > radius * radius) || (projection + radius < 0.0f) || (projection - radius > closestDistance))
+            {
+                continue;
+            }
+
+            if (snapshot->m_netEntityId[index] == ignoreId)
+            {
+                continue;
+            }
+
+            // Narrowphase against the actual primitive
+            const AZ::Vector3 center(snapshot->m_centerX[index], snapshot->m_centerY[index], snapshot->m_centerZ[index]);
+            const AZ::Quaternion& rotation = snapshot->m_rotation[index];
+            const AZ::Vector3& dimensions = snapshot->m_dimensions[index];
+
+            float hitDistance = 0.0f;
+            bool isHit = false;
+            switch (snapshot->m_shapeType[index])
+            {
+            case HitVolumeShapeType::Sphere:
+            {
+                float t = 0.0f;
+                const AZ::Intersect::SphereIsectTypes result = AZ::Intersect::IntersectRaySphere(origin, direction, center, dimensions.GetX(), t);
+                isHit = (result != AZ::Intersect::ISECT_RAY_SPHERE_NONE);
+                hitDistance = (result == AZ::Intersect::ISECT_RAY_SPHERE_SA_INSIDE) ? 0.0f : t;
+                break;
+            }
+            case HitVolumeShapeType::Capsule:
+            {
+                const float capsuleRadius = dimensions.GetX();
+                const float halfSegmentLength = AZStd::max(dimensions.GetY() * 0.5f - capsuleRadius, 0.0f);
+                if (halfSegmentLength <= 0.0f)
+                {
+                    float t = 0.0f;
+                    const AZ::Intersect::SphereIsectTypes result = AZ::Intersect::IntersectRaySphere(origin, direction, center, capsuleRadius, t);
+                    isHit = (result != AZ::Intersect::ISECT_RAY_SPHERE_NONE);
+                    hitDistance = (result == AZ::Intersect::ISECT_RAY_SPHERE_SA_INSIDE) ? 0.0f : t;
+                    break;
+                }
+                const AZ::Vector3 axis = rotation.TransformVector(AZ::Vector3::CreateAxisZ(halfSegmentLength));
+                float t = 0.0f;
+                const AZ::Intersect::CapsuleIsectTypes result = AZ::Intersect::IntersectSegmentCapsule(
+                    origin, direction * closestDistance, center - axis, center + axis, capsuleRadius, t);
+                isHit = (result != AZ::Intersect::ISECT_RAY_CAPSULE_NONE);
+                hitDistance = (result == AZ::Intersect::ISECT_RAY_CAPSULE_SA_INSIDE) ? 0.0f : t * closestDistance;
+                break;
+            }
+            case HitVolumeShapeType::Box:
+            {
+                float t = 0.0f;
+                const AZ::Obb obb = AZ::Obb::CreateFromPositionRotationAndHalfLengths(center, rotation, dimensions);
+                isHit = AZ::Intersect::IntersectRayObb(origin, direction, obb, t);
+                hitDistance = t;
+                break;
+            }
+            }
+
+            if (isHit && (hitDistance <= closestDistance))
+            {
+                closestDistance = hitDistance;
+                outResult.m_netEntityId = snapshot->m_netEntityId[index];
+                outResult.m_hitVolumeIndex = snapshot->m_hitVolumeIndex[index];
+                outResult.m_distance = hitDistance;
+                outResult.m_position = origin + direction * hitDistance;
+                hasHit = true;
+            }
+        }
+
+        return hasHit;
+    }
+
+    uint32_t HitVolumeHistory::OverlapSphere
+    (
+        HostFrameId frameId,
+        const AZ::Vector3& center,
+        float radius,
+        AZStd::vector<NetEntityId>& outEntities
+    ) const
+    {
+        const Snapshot* snapshot = FindSnapshot(frameId);
+        if (snapshot == nullptr)
+        {
+            return 0;
+        }
+
+        const float queryX = center.GetX();
+        const float queryY = center.GetY();
+        const float queryZ = center.GetZ();
+        const size_t initialSize = outEntities.size();
+
+        const size_t hitVolumeCount = snapshot->m_netEntityId.size();
+        for (size_t index = 0; index < hitVolumeCount; ++index)
+        {
+            const float deltaX = snapshot->m_centerX[index] - queryX;
+            const float deltaY = snapshot->m_centerY[index] - queryY;
+            const float deltaZ = snapshot->m_centerZ[index] - queryZ;
+            const float combinedRadius = snapshot->m_boundingRadius[index] + radius;
+            if (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ > combinedRadius * combinedRadius)
+            {
+                continue;
+            }
+
+            // Hit volumes of the same entity are recorded contiguously, so checking the appended range is enough to dedupe
+            const NetEntityId netEntityId = snapshot->m_netEntityId[index];
+            if (AZStd::find(outEntities.begin() + initialSize, outEntities.end(), netEntityId) == outEntities.end())
+            {
+                outEntities.push_back(netEntityId);
+            }
+        }
+
+        return aznumeric_cast<uint32_t>(outEntities.size() - initialSize);
+    }
+
+    void HitVolumeHistory::Clear()
+    {
+        for (Snapshot& snapshot : m_snapshots)
+        {
+            snapshot.Reset(InvalidHostFrameId);
+        }
+        m_headFrameId = InvalidHostFrameId;
+        m_headIndex = 0;
+    }
+
+    const HitVolumeHistory::Snapshot* HitVolumeHistory::FindSnapshot(HostFrameId frameId) const
+    {
+        if ((m_headFrameId == InvalidHostFrameId) || (frameId == InvalidHostFrameId) || (frameId > m_headFrameId))
+        {
+            return nullptr;
+        }
+
+        const uint32_t frameDelta = static_cast<uint32_t>(m_headFrameId - frameId);
+        if (frameDelta >= RewindHistorySize)
+        {
+            return nullptr;
+        }
+
+        const Snapshot& snapshot = m_snapshots[(m_headIndex + RewindHistorySize - frameDelta) % RewindHistorySize];
+        return (snapshot.m_frameId == frameId) ? &snapshot : nullptr;
+    }
+}
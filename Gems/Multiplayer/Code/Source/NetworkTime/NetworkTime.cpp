@@ -65,11 +65,17 @@ namespace Multiplayer
     void NetworkTime::IncrementHostFrameId()
     {
         AZ_Assert(!IsTimeRewound(), "Incrementing the global application frameId is unsupported under a rewound time scope");
+        m_hostFrameCompletedEvent.Signal(m_unalteredFrameId);
         ++m_unalteredFrameId;
         m_hostFrameId = m_unalteredFrameId;
         m_hostTimeMs = AZ::GetElapsedTimeMs();
     }
 
+    void NetworkTime::AddHostFrameCompletedHandler(HostFrameCompletedEvent::Handler& handler)
+    {
+        handler.Connect(m_hostFrameCompletedEvent);
+    }
+
     AZ::TimeMs NetworkTime::GetHostTimeMs() const
     {
         return m_hostTimeMs;
@@ -92,6 +98,9 @@ namespace Multiplayer
         m_hostFrameId = frameId;
         m_hostTimeMs = timeMs;
         m_rewindingConnectionId = AzNetworking::InvalidConnectionId;
+
+        // Recorded snapshots are keyed by frame and would no longer line up with the new timeline
+        m_hitVolumeHistory.Clear();
     }
 
     void NetworkTime::AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId)
@@ -195,4 +204,9 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    HitVolumeHistory& NetworkTime::GetHitVolumeHistory()
+    {
+        return m_hitVolumeHistory;
+    }
 }
@@ -31,6 +31,7 @@ namespace Multiplayer
         HostFrameId GetHostFrameId() const override;
         HostFrameId GetUnalteredHostFrameId() const override;
         void IncrementHostFrameId() override;
+        void AddHostFrameCompletedHandler(HostFrameCompletedEvent::Handler& handler) override;
         AZ::TimeMs GetHostTimeMs() const override;
         float GetHostBlendFactor() const override;
         AzNetworking::ConnectionId GetRewindingConnectionId() const override;
@@ -38,11 +39,14 @@ namespace Multiplayer
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
         void ClearRewoundEntities() override;
+        HitVolumeHistory& GetHitVolumeHistory() override;
         //! @}
 
     private:
 
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        HitVolumeHistory m_hitVolumeHistory;
+        HostFrameCompletedEvent m_hostFrameCompletedEvent;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
@@ -24,6 +24,9 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(float, sv_ReplicationLodDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Each multiple of this distance between an entity and the client lowers the entity's replication rate, 0 disables replication LOD");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationLodIntervalMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Time added between entity updates for each replication LOD level");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationLodMaxIntervalMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum time between updates for entities at the lowest replication LOD");
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -314,7 +317,7 @@ namespace Multiplayer
         }
     }
 
-    void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
+    void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
         if (!sv_ReplicateServerProxies)
@@ -338,10 +341,24 @@ namespace Multiplayer
                 m_replicationSet.erase(removeEnt);
             }
             m_candidateQueue.push(PrioritizedReplicationCandidate(entityHandle, priority));
-            m_replicationSet[entityHandle] = { NetEntityRole::Client, priority };
+            m_replicationSet[entityHandle] = { NetEntityRole::Client, priority, CalculateSendIntervalMs(distanceSquared) };
         }
     }
 
+    AZ::TimeMs ServerToClientReplicationWindow::CalculateSendIntervalMs(float distanceSquared)
+    {
+        const float lodDistance = sv_ReplicationLodDistance;
+        if (lodDistance <= 0.0f)
+        {
+            return AZ::Time::ZeroTimeMs;
+        }
+
+        // Distant entities change less noticeably for the client, so their changes are accumulated and sent less often
+        const int64_t lodLevel = static_cast<int64_t>(sqrtf(distanceSquared) / lodDistance);
+        const AZ::TimeMs sendIntervalMs = AZ::TimeMs{ lodLevel * static_cast<int64_t>(static_cast<AZ::TimeMs>(sv_ReplicationLodIntervalMs)) };
+        return AZStd::min(sendIntervalMs, static_cast<AZ::TimeMs>(sv_ReplicationLodMaxIntervalMs));
+    }
+
     void ServerToClientReplicationWindow::UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent)
     {
         INetworkEntityManager* networkEntityManager = AZ::Interface<INetworkEntityManager>::Get();
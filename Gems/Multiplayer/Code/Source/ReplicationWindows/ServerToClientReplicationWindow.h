@@ -56,6 +56,11 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! Returns the replication LOD send interval for an entity, the minimum time between updates sent to the client.
+        //! @param distanceSquared the squared distance between the entity and the client's controlled entity
+        //! @return the send interval, zero if the entity should be updated every tick
+        static AZ::TimeMs CalculateSendIntervalMs(float distanceSquared);
+
     private:
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
@@ -115,6 +115,10 @@ namespace Multiplayer
         {
         }
 
+        void AddHostFrameCompletedHandler([[maybe_unused]] HostFrameCompletedEvent::Handler& handler) override
+        {
+        }
+
         AZ::TimeMs GetHostTimeMs() const override
         {
             return {};
@@ -145,6 +149,13 @@ namespace Multiplayer
         void AlterTime([[maybe_unused]] HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, [[maybe_unused]] float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
         {
         }
+
+        HitVolumeHistory& GetHitVolumeHistory() override
+        {
+            return m_hitVolumeHistory;
+        }
+
+        HitVolumeHistory m_hitVolumeHistory;
     };
 
     class BenchmarkMultiplayerConnection : public IConnection
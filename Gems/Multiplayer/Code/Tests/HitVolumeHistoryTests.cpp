@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class HitVolumeHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_history = AZStd::make_unique<HitVolumeHistory>();
+        }
+
+        void TearDown() override
+        {
+            m_history.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        void RecordSphere(HostFrameId frameId, NetEntityId netEntityId, const AZ::Vector3& position, float radius)
+        {
+            m_history->RecordHitVolume(frameId, netEntityId, 0, HitVolumeShapeType::Sphere,
+                AZ::Transform::CreateTranslation(position), AZ::Vector3(radius, 0.0f, 0.0f));
+        }
+
+        AZStd::unique_ptr<HitVolumeHistory> m_history;
+    };
+
+    TEST_F(HitVolumeHistoryTests, RaycastHitsVolumeAtRecordedFrame)
+    {
+        // Entity moves along the x axis by one unit each frame
+        for (uint32_t frame = 0; frame < 10; ++frame)
+        {
+            RecordSphere(HostFrameId{ frame }, NetEntityId{ 1 }, AZ::Vector3(static_cast<float>(frame), 10.0f, 0.0f), 0.25f);
+        }
+
+        for (uint32_t frame = 0; frame < 10; ++frame)
+        {
+            HitVolumeRaycastResult result;
+            const AZ::Vector3 origin(static_cast<float>(frame), 0.0f, 0.0f);
+            EXPECT_TRUE(m_history->Raycast(HostFrameId{ frame }, origin, AZ::Vector3::CreateAxisY(), 100.0f, InvalidNetEntityId, result));
+            EXPECT_EQ(result.m_netEntityId, NetEntityId{ 1 });
+            EXPECT_NEAR(result.m_distance, 9.75f, 0.001f);
+
+            // The same ray misses the entity one frame later
+            if (frame < 9)
+            {
+                EXPECT_FALSE(m_history->Raycast(HostFrameId{ frame + 1 }, origin, AZ::Vector3::CreateAxisY(), 100.0f, InvalidNetEntityId, result));
+            }
+        }
+    }
+
+    TEST_F(HitVolumeHistoryTests, RaycastReturnsClosestAndRespectsIgnore)
+    {
+        RecordSphere(HostFrameId{ 1 }, NetEntityId{ 1 }, AZ::Vector3(0.0f, 5.0f, 0.0f), 0.5f);
+        RecordSphere(HostFrameId{ 1 }, NetEntityId{ 2 }, AZ::Vector3(0.0f, 10.0f, 0.0f), 0.5f);
+
+        HitVolumeRaycastResult result;
+        EXPECT_TRUE(m_history->Raycast(HostFrameId{ 1 }, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, InvalidNetEntityId, result));
+        EXPECT_EQ(result.m_netEntityId, NetEntityId{ 1 });
+
+        EXPECT_TRUE(m_history->Raycast(HostFrameId{ 1 }, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, NetEntityId{ 1 }, result));
+        EXPECT_EQ(result.m_netEntityId, NetEntityId{ 2 });
+
+        EXPECT_FALSE(m_history->Raycast(HostFrameId{ 1 }, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 2.0f, InvalidNetEntityId, result));
+    }
+
+    TEST_F(HitVolumeHistoryTests, RaycastCapsuleAndBox)
+    {
+        const AZ::Transform capsuleTransform = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f));
+        m_history->RecordHitVolume(HostFrameId{ 1 }, NetEntityId{ 1 }, 0, HitVolumeShapeType::Capsule, capsuleTransform, AZ::Vector3(0.5f, 4.0f, 0.0f));
+
+        const AZ::Transform boxTransform = AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f));
+        m_history->RecordHitVolume(HostFrameId{ 1 }, NetEntityId{ 2 }, 0, HitVolumeShapeType::Box, boxTransform, AZ::Vector3(1.0f, 1.0f, 1.0f));
+
+        HitVolumeRaycastResult result;
+
+        // Hit the capsule near its upper cap, which is outside of a plain sphere of the same radius
+        EXPECT_TRUE(m_history->Raycast(HostFrameId{ 1 }, AZ::Vector3(0.0f, 0.0f, 1.5f), AZ::Vector3::CreateAxisY(), 100.0f, InvalidNetEntityId, result));
+        EXPECT_EQ(result.m_netEntityId, NetEntityId{ 1 });
+        EXPECT_NEAR(result.m_distance, 9.5f, 0.01f);
+
+        // Miss above the capsule
+        EXPECT_FALSE(m_history->Raycast(HostFrameId{ 1 }, AZ::Vector3(0.0f, 0.0f, 2.5f), AZ::Vector3::CreateAxisY(), 100.0f, InvalidNetEntityId, result));
+
+        EXPECT_TRUE(m_history->Raycast(HostFrameId{ 1 }, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, InvalidNetEntityId, result));
+        EXPECT_EQ(result.m_netEntityId, NetEntityId{ 2 });
+        EXPECT_NEAR(result.m_distance, 9.0f, 0.01f);
+    }
+
+    TEST_F(HitVolumeHistoryTests, OverlapSphereReportsEachEntityOnce)
+    {
+        m_history->RecordHitVolume(HostFrameId{ 1 }, NetEntityId{ 1 }, 0, HitVolumeShapeType::Sphere, AZ::Transform::CreateIdentity(), AZ::Vector3(0.5f, 0.0f, 0.0f));
+        m_history->RecordHitVolume(HostFrameId{ 1 }, NetEntityId{ 1 }, 1, HitVolumeShapeType::Sphere, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 1.0f)), AZ::Vector3(0.5f, 0.0f, 0.0f));
+        RecordSphere(HostFrameId{ 1 }, NetEntityId{ 2 }, AZ::Vector3(50.0f, 0.0f, 0.0f), 0.5f);
+
+        AZStd::vector<NetEntityId> overlaps;
+        EXPECT_EQ(m_history->OverlapSphere(HostFrameId{ 1 }, AZ::Vector3::CreateZero(), 2.0f, overlaps), 1u);
+        ASSERT_EQ(overlaps.size(), 1u);
+        EXPECT_EQ(overlaps[0], NetEntityId{ 1 });
+    }
+
+    TEST_F(HitVolumeHistoryTests, OldFramesAreEvicted)
+    {
+        for (uint32_t frame = 0; frame < RewindHistorySize * 2; ++frame)
+        {
+            RecordSphere(HostFrameId{ frame }, NetEntityId{ 1 }, AZ::Vector3::CreateZero(), 1.0f);
+        }
+
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ RewindHistorySize - 1 }));
+        EXPECT_TRUE(m_history->HasFrame(HostFrameId{ RewindHistorySize }));
+        EXPECT_TRUE(m_history->HasFrame(HostFrameId{ RewindHistorySize * 2 - 1 }));
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ RewindHistorySize * 2 }));
+        EXPECT_EQ(m_history->GetHitVolumeCount(HostFrameId{ RewindHistorySize * 2 - 1 }), 1u);
+    }
+
+    TEST_F(HitVolumeHistoryTests, SkippedFramesAreNotPresent)
+    {
+        RecordSphere(HostFrameId{ 1 }, NetEntityId{ 1 }, AZ::Vector3::CreateZero(), 1.0f);
+        RecordSphere(HostFrameId{ 5 }, NetEntityId{ 1 }, AZ::Vector3::CreateZero(), 1.0f);
+
+        EXPECT_TRUE(m_history->HasFrame(HostFrameId{ 1 }));
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ 3 }));
+        EXPECT_TRUE(m_history->HasFrame(HostFrameId{ 5 }));
+
+        // Recording into the past is ignored
+        RecordSphere(HostFrameId{ 3 }, NetEntityId{ 1 }, AZ::Vector3::CreateZero(), 1.0f);
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ 3 }));
+
+        m_history->Clear();
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ 5 }));
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Records RewindHistorySize frames of 1000 moving entities, each with a handful of hit volumes, then queries a past frame.
+    class HitVolumeHistoryBenchmarkFixture
+        : public benchmark::Fixture
+        , public LeakDetectionBase
+    {
+    public:
+        static constexpr uint32_t EntityCount = 1000;
+        static constexpr uint32_t HitVolumesPerEntity = 8;
+
+        void internalSetUp()
+        {
+            m_history = AZStd::make_unique<HitVolumeHistory>();
+
+            AZ::SimpleLcgRandom random;
+            for (uint32_t frame = 0; frame < RewindHistorySize; ++frame)
+            {
+                RecordFrame(HostFrameId{ frame }, random);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_history.reset();
+        }
+
+        void RecordFrame(HostFrameId frameId, AZ::SimpleLcgRandom& random)
+        {
+            for (uint32_t entity = 0; entity < EntityCount; ++entity)
+            {
+                const AZ::Vector3 entityPosition(random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, 0.0f);
+                for (uint32_t volume = 0; volume < HitVolumesPerEntity; ++volume)
+                {
+                    const AZ::Transform volumeTransform = AZ::Transform::CreateTranslation(entityPosition + AZ::Vector3(0.0f, 0.0f, 0.25f * volume));
+                    m_history->RecordHitVolume(frameId, NetEntityId{ entity }, volume, HitVolumeShapeType::Capsule, volumeTransform, AZ::Vector3(0.15f, 0.5f, 0.0f));
+                }
+            }
+        }
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::unique_ptr<HitVolumeHistory> m_history;
+    };
+
+    BENCHMARK_F(HitVolumeHistoryBenchmarkFixture, RecordFrame)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom random;
+        uint32_t frame = RewindHistorySize;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RecordFrame(HostFrameId{ frame++ }, random);
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount * HitVolumesPerEntity);
+    }
+
+    BENCHMARK_F(HitVolumeHistoryBenchmarkFixture, RewoundRaycast)(benchmark::State& state)
+    {
+        const HostFrameId rewoundFrame = HostFrameId{ RewindHistorySize / 2 };
+        HitVolumeRaycastResult result;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const bool hit = m_history->Raycast(rewoundFrame, AZ::Vector3(-100.0f, 0.0f, 1.0f), AZ::Vector3::CreateAxisX(), 200.0f, InvalidNetEntityId, result);
+            benchmark::DoNotOptimize(hit);
+        }
+    }
+
+    BENCHMARK_F(HitVolumeHistoryBenchmarkFixture, RewoundOverlapSphere)(benchmark::State& state)
+    {
+        const HostFrameId rewoundFrame = HostFrameId{ RewindHistorySize / 2 };
+        AZStd::vector<NetEntityId> overlaps;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            overlaps.clear();
+            m_history->OverlapSphere(rewoundFrame, AZ::Vector3::CreateZero(), 20.0f, overlaps);
+            benchmark::DoNotOptimize(overlaps.data());
+        }
+    }
+#endif // HAVE_BENCHMARK
+}
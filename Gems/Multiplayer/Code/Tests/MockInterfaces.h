@@ -121,12 +121,14 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetHostFrameId, Multiplayer::HostFrameId());
         MOCK_CONST_METHOD0(GetUnalteredHostFrameId, Multiplayer::HostFrameId());
         MOCK_METHOD0(IncrementHostFrameId, void());
+        MOCK_METHOD1(AddHostFrameCompletedHandler, void(Multiplayer::HostFrameCompletedEvent::Handler&));
         MOCK_CONST_METHOD0(GetHostTimeMs, AZ::TimeMs());
         MOCK_CONST_METHOD0(GetRewindingConnectionId, AzNetworking::ConnectionId());
         MOCK_CONST_METHOD1(GetHostFrameIdForRewindingConnection, Multiplayer::HostFrameId(AzNetworking::ConnectionId));
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
         MOCK_METHOD0(ClearRewoundEntities, void());
+        MOCK_METHOD0(GetHitVolumeHistory, Multiplayer::HitVolumeHistory& ());
     };
 
     class MockComponentApplicationRequests : public AZ::ComponentApplicationRequests
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/Jobs/JobManagerComponent.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <MultiplayerSystemComponent.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/IMultiplayerSpawner.h>
+#include <Multiplayer/MultiplayerConstants.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_serverSendRateMs);
+
+    /*
+     * Headless load test for the multiplayer server.
+     *
+     * A real dedicated server MultiplayerSystemComponent hosts over loopback UDP, and a configurable number of lightweight
+     * simulated clients connect to it, each through their own UdpNetworkInterface. Simulated clients only perform the
+     * connection handshake and count the traffic they receive, they do not create entities or run prediction.
+     *
+     * Every benchmark iteration is a single server network tick. Player and npc entities follow a scripted circular path
+     * so that every tick produces transform updates for every client. Results are reported through MultiplayerStats,
+     * per tick server cost is broken down by MultiplayerStats::TickPhase. If any simulated client fails to connect, or
+     * disconnects during the run, the run is reported as an error instead of producing results.
+     *
+     * Arguments are { clientCount, npcCount }.
+     */
+    class LoadTestClient
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        LoadTestClient(uint32_t clientIndex, const IpAddress& serverAddress)
+        {
+            const AZ::Name interfaceName(AZStd::string::format("LoadTestClient_%u", clientIndex));
+            m_networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(interfaceName, ProtocolType::Udp, TrustZone::ExternalClientToServer, *this);
+            m_temporaryUserId = clientIndex + 1;
+            m_networkInterface->Connect(serverAddress);
+        }
+
+        ~LoadTestClient() override
+        {
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_networkInterface->GetName());
+        }
+
+        bool IsReady() const
+        {
+            return m_ready;
+        }
+
+        const NetworkInterfaceMetrics& GetMetrics() const
+        {
+            return m_networkInterface->GetMetrics();
+        }
+
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect(IConnection* connection) override
+        {
+            MultiplayerPackets::Connect connectPacket(0, m_temporaryUserId, "", GetMultiplayerComponentRegistry()->GetSystemVersionHash());
+            connection->SendReliablePacket(connectPacket);
+        }
+
+        PacketDispatchResult OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            // Entity updates are only counted by the network interface metrics, the only packet we need to respond to is the accept
+            if (packetHeader.GetPacketType() == MultiplayerPackets::Accept::Type && !m_ready)
+            {
+                connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+                m_ready = true;
+            }
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            m_ready = false;
+        }
+
+    private:
+        INetworkInterface* m_networkInterface = nullptr;
+        uint64_t m_temporaryUserId = 0;
+        bool m_ready = false;
+    };
+
+    class LoadTestLevelSystemLifecycle : public AzFramework::ILevelSystemLifecycle
+    {
+    public:
+        LoadTestLevelSystemLifecycle()
+        {
+            AZ::Interface<AzFramework::ILevelSystemLifecycle>::Register(this);
+        }
+
+        ~LoadTestLevelSystemLifecycle() override
+        {
+            AZ::Interface<AzFramework::ILevelSystemLifecycle>::Unregister(this);
+        }
+
+        const char* GetCurrentLevelName() const override
+        {
+            return "LoadTestLevel";
+        }
+
+        bool IsLevelLoaded() const override
+        {
+            return true;
+        }
+    };
+
+    class MultiplayerLoadTestBenchmark
+        : public benchmark::Fixture
+        , public LeakDetectionBase
+        , public IMultiplayerSpawner
+    {
+    public:
+        static constexpr float MovementRadius = 50.0f;
+        static constexpr float MovementRadiansPerTick = 0.05f;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::NameDictionary::Create();
+
+            m_componentApplicationRequests = AZStd::make_unique<BenchmarkComponentApplicationRequests>();
+            AZ::Interface<AZ::ComponentApplicationRequests>::Register(m_componentApplicationRequests.get());
+
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_eventScheduler = AZStd::make_unique<AZ::EventSchedulerSystemComponent>();
+            m_levelSystem = AZStd::make_unique<LoadTestLevelSystemLifecycle>();
+
+            m_console.reset(aznew AZ::Console());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_behaviorContext = AZStd::make_unique<AZ::BehaviorContext>();
+            m_transformDescriptor.reset(AzFramework::TransformComponent::CreateDescriptor());
+            m_transformDescriptor->Reflect(m_serializeContext.get());
+            m_netBindDescriptor.reset(NetBindComponent::CreateDescriptor());
+            m_netBindDescriptor->Reflect(m_serializeContext.get());
+            m_netTransformDescriptor.reset(NetworkTransformComponent::CreateDescriptor());
+            m_netTransformDescriptor->Reflect(m_serializeContext.get());
+            m_jobComponentDescriptor.reset(AZ::JobManagerComponent::CreateDescriptor());
+            m_jobComponentDescriptor->Reflect(m_serializeContext.get());
+
+            m_netComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
+            m_mpComponent = AZStd::make_unique<MultiplayerSystemComponent>();
+            m_mpComponent->Reflect(m_serializeContext.get());
+            m_mpComponent->Reflect(m_behaviorContext.get());
+            m_mpComponent->Activate();
+
+            m_systemEntity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(0));
+            m_systemEntity->CreateComponent<AZ::JobManagerComponent>(); // Needed by Job system when @sv_multithreadedConnectionUpdates is on.
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            AZ::Interface<IMultiplayerSpawner>::Register(this);
+            m_mpComponent->StartHosting(UseDefaultHostPort, /*is dedicated*/ true);
+
+            const int64_t npcCount = state.range(1);
+            for (int64_t i = 0; i < npcCount; ++i)
+            {
+                NetworkEntityHandle npcHandle = CreateLoadTestEntity();
+                GetNetworkEntityManager()->MarkAlwaysRelevantToClients(npcHandle, true);
+            }
+
+            const uint16_t serverPort = AZ::Interface<INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(MpNetworkInterfaceName))->GetPort();
+            const IpAddress serverAddress(127, 0, 0, 1, serverPort);
+            const int64_t clientCount = state.range(0);
+            for (int64_t i = 0; i < clientCount; ++i)
+            {
+                m_clients.emplace_back(AZStd::make_unique<LoadTestClient>(aznumeric_cast<uint32_t>(i), serverAddress));
+            }
+
+            // Pump the network until every simulated client has completed the handshake, so the benchmark only measures steady state
+            constexpr int MaxHandshakeUpdates = 1000;
+            for (int update = 0; update < MaxHandshakeUpdates && !AreAllClientsReady(); ++update)
+            {
+                m_netComponent->ForceUpdate();
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_clients.clear();
+
+            AZ::Interface<IMultiplayerSpawner>::Unregister(this);
+            for (AZStd::unique_ptr<AZ::Entity>& entity : m_entities)
+            {
+                entity->Deactivate();
+            }
+            m_entities.clear();
+
+            m_systemEntity->Deactivate();
+            m_systemEntity.reset();
+
+            m_mpComponent->Deactivate();
+            m_mpComponent.reset();
+            m_netComponent.reset();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+            m_levelSystem.reset();
+            m_eventScheduler->Deactivate();
+            m_eventScheduler.reset();
+            m_timeSystem.reset();
+            AZ::Interface<AZ::ComponentApplicationRequests>::Unregister(m_componentApplicationRequests.get());
+            m_componentApplicationRequests.reset();
+
+            m_jobComponentDescriptor.reset();
+            m_netTransformDescriptor.reset();
+            m_netBindDescriptor.reset();
+            m_transformDescriptor.reset();
+            m_behaviorContext.reset();
+            m_serializeContext.reset();
+
+            AZ::NameDictionary::Destroy();
+        }
+
+        //! IMultiplayerSpawner overrides.
+        //! @{
+        NetworkEntityHandle OnPlayerJoin([[maybe_unused]] uint64_t userId, [[maybe_unused]] const MultiplayerAgentDatum& agentDatum) override
+        {
+            NetworkEntityHandle playerHandle = CreateLoadTestEntity();
+            // There is no visibility system in the load test, so make every player visible to every other player
+            GetNetworkEntityManager()->MarkAlwaysRelevantToClients(playerHandle, true);
+            return playerHandle;
+        }
+
+        void OnPlayerLeave(
+            [[maybe_unused]] ConstNetworkEntityHandle entityHandle,
+            [[maybe_unused]] const ReplicationSet& replicationSet,
+            [[maybe_unused]] AzNetworking::DisconnectReason reason) override
+        {
+        }
+        //! @}
+
+        NetworkEntityHandle CreateLoadTestEntity()
+        {
+            const NetEntityId netEntityId = static_cast<NetEntityId>(m_entities.size() + 1);
+
+            AZStd::unique_ptr<AZ::Entity>& entity = m_entities.emplace_back(AZStd::make_unique<AZ::Entity>());
+            entity->CreateComponent<AzFramework::TransformComponent>();
+            NetBindComponent* netBindComponent = entity->CreateComponent<NetBindComponent>();
+            entity->CreateComponent<NetworkTransformComponent>();
+            netBindComponent->PreInit(entity.get(), PrefabEntityId{ AZ::Name("LoadTest"), 1 }, netEntityId, NetEntityRole::Authority);
+            entity->Init();
+            entity->Activate();
+
+            return GetNetworkEntityManager()->GetEntity(netEntityId);
+        }
+
+        bool AreAllClientsReady() const
+        {
+            for (const AZStd::unique_ptr<LoadTestClient>& client : m_clients)
+            {
+                if (!client->IsReady())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //! Scripted movement, every entity moves along its own circle offset by its index.
+        void MoveEntities()
+        {
+            ++m_tick;
+            for (size_t index = 0; index < m_entities.size(); ++index)
+            {
+                const float angle = static_cast<float>(m_tick) * MovementRadiansPerTick + static_cast<float>(index);
+                const AZ::Vector3 position(AZ::Cos(angle) * MovementRadius, AZ::Sin(angle) * MovementRadius, 0.0f);
+                m_entities[index]->GetTransform()->SetWorldTranslation(position);
+            }
+        }
+
+        //! Runs a single server network tick, including receiving on all simulated clients.
+        void TickServer()
+        {
+            const float serverRateSeconds = static_cast<float>(static_cast<AZ::TimeMs>(sv_serverSendRateMs)) / 1000.0f;
+
+            MoveEntities();
+            m_mpComponent->OnTick(serverRateSeconds, AZ::ScriptTimePoint());
+            m_eventScheduler->OnTick(serverRateSeconds, AZ::ScriptTimePoint());
+            m_netComponent->ForceUpdate();
+        }
+
+        AZStd::unique_ptr<BenchmarkComponentApplicationRequests> m_componentApplicationRequests;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<AZ::EventSchedulerSystemComponent> m_eventScheduler;
+        AZStd::unique_ptr<LoadTestLevelSystemLifecycle> m_levelSystem;
+        AZStd::unique_ptr<AZ::IConsole> m_console;
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::BehaviorContext> m_behaviorContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_transformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netBindDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netTransformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_jobComponentDescriptor;
+
+        AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_netComponent;
+        AZStd::unique_ptr<MultiplayerSystemComponent> m_mpComponent;
+        AZStd::unique_ptr<AZ::Entity> m_systemEntity;
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::vector<AZStd::unique_ptr<LoadTestClient>> m_clients;
+        uint64_t m_tick = 0;
+    };
+
+    BENCHMARK_DEFINE_F(MultiplayerLoadTestBenchmark, ServerTick)(benchmark::State& state)
+    {
+        // Without connected clients the server has nobody to replicate to, so the numbers wouldn't measure anything
+        if (!AreAllClientsReady())
+        {
+            state.SkipWithError("Not every simulated client completed the connection handshake");
+            return;
+        }
+
+        const MultiplayerStats& stats = m_mpComponent->GetStats();
+        const MultiplayerStats::TickPhaseTiming tickEntitiesStart = stats.m_tickPhaseTimings[static_cast<uint32_t>(MultiplayerStats::TickPhase::TickEntities)];
+        const MultiplayerStats::TickPhaseTiming notifyEntitiesStart = stats.m_tickPhaseTimings[static_cast<uint32_t>(MultiplayerStats::TickPhase::NotifyEntities)];
+        const MultiplayerStats::TickPhaseTiming updateConnectionsStart = stats.m_tickPhaseTimings[static_cast<uint32_t>(MultiplayerStats::TickPhase::UpdateConnections)];
+
+        uint64_t recvBytesStart = 0;
+        uint64_t recvPacketsStart = 0;
+        for (const AZStd::unique_ptr<LoadTestClient>& client : m_clients)
+        {
+            recvBytesStart += client->GetMetrics().m_recvBytes;
+            recvPacketsStart += client->GetMetrics().m_recvPackets;
+        }
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            TickServer();
+        }
+
+        if (!AreAllClientsReady())
+        {
+            state.SkipWithError("A simulated client disconnected during the run");
+            return;
+        }
+
+        uint64_t recvBytes = 0;
+        uint64_t recvPackets = 0;
+        for (const AZStd::unique_ptr<LoadTestClient>& client : m_clients)
+        {
+            recvBytes += client->GetMetrics().m_recvBytes;
+            recvPackets += client->GetMetrics().m_recvPackets;
+        }
+
+        const auto phaseTimeUs = [&stats](MultiplayerStats::TickPhase phase, const MultiplayerStats::TickPhaseTiming& start)
+        {
+            return static_cast<double>(static_cast<int64_t>(stats.m_tickPhaseTimings[static_cast<uint32_t>(phase)].m_totalTimeUs - start.m_totalTimeUs));
+        };
+
+        const double clientCount = AZStd::max(static_cast<double>(m_clients.size()), 1.0);
+        state.counters["TickEntitiesUs"] = benchmark::Counter(phaseTimeUs(MultiplayerStats::TickPhase::TickEntities, tickEntitiesStart), benchmark::Counter::kAvgIterations);
+        state.counters["NotifyEntitiesUs"] = benchmark::Counter(phaseTimeUs(MultiplayerStats::TickPhase::NotifyEntities, notifyEntitiesStart), benchmark::Counter::kAvgIterations);
+        state.counters["UpdateConnectionsUs"] = benchmark::Counter(phaseTimeUs(MultiplayerStats::TickPhase::UpdateConnections, updateConnectionsStart), benchmark::Counter::kAvgIterations);
+        state.counters["BytesPerClient"] = benchmark::Counter(static_cast<double>(recvBytes - recvBytesStart) / clientCount, benchmark::Counter::kAvgIterations);
+        state.counters["PacketsPerClient"] = benchmark::Counter(static_cast<double>(recvPackets - recvPacketsStart) / clientCount, benchmark::Counter::kAvgIterations);
+        state.counters["PropertyUpdatesSent"] = benchmark::Counter(static_cast<double>(stats.CalculateTotalPropertyUpdateSentMetrics().m_totalCalls));
+    }
+
+    BENCHMARK_REGISTER_F(MultiplayerLoadTestBenchmark, ServerTick)
+        ->Args({ 1, 100 })
+        ->Args({ 8, 100 })
+        ->Args({ 32, 250 })
+        ->Args({ 64, 500 })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/Name.h>
@@ -666,4 +667,203 @@ namespace Multiplayer
         EXPECT_FALSE(netBindComponent->ValidatePropertyWrite("TestProperty", NetEntityRole::Authority, NetEntityRole::Client, notPredictable));
         EXPECT_FALSE(netBindComponent->ValidatePropertyWrite("TestProperty", NetEntityRole::Autonomous, NetEntityRole::Authority, notPredictable));
     }
+
+    AZ_CVAR_EXTERNED(float, sv_ReplicationLodDistance);
+
+    //! Replication window with a fixed replication set that records the entities sent each frame instead of sending them.
+    class TestReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        bool ReplicationSetUpdateReady() override
+        {
+            return true;
+        }
+
+        const ReplicationSet& GetReplicationSet() const override
+        {
+            return m_replicationSet;
+        }
+
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override
+        {
+            return m_maxProxySendCount;
+        }
+
+        bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override
+        {
+            auto iter = m_replicationSet.find(entityPtr);
+            if (iter != m_replicationSet.end())
+            {
+                outNetworkRole = iter->second.m_netEntityRole;
+                return true;
+            }
+            return false;
+        }
+
+        bool AddEntity(AZ::Entity*) override
+        {
+            return false;
+        }
+
+        void RemoveEntity(AZ::Entity*) override {}
+        void UpdateWindow() override {}
+
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override
+        {
+            for (const NetworkEntityUpdateMessage& updateMessage : entityUpdateVector)
+            {
+                m_sentEntityIds.push_back(updateMessage.GetEntityId());
+            }
+            return AzNetworking::PacketId{ ++m_sentPacketCount };
+        }
+
+        void SendEntityRpcs(NetworkEntityRpcVector&, bool) override {}
+        void SendEntityResets(const NetEntityIdSet&) override {}
+        void DebugDraw() const override {}
+
+        ReplicationSet m_replicationSet;
+        uint32_t m_maxProxySendCount = AZStd::numeric_limits<uint32_t>::max();
+        AZStd::vector<NetEntityId> m_sentEntityIds;
+        uint32_t m_sentPacketCount = 0;
+    };
+
+    class ReplicationSchedulingTests : public MultiplayerNetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            MultiplayerNetworkEntityTests::SetUp();
+
+            // Every sent update is acknowledged immediately, so entities are established after their create is sent
+            ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+            m_window = AZStd::make_unique<TestReplicationWindow>();
+        }
+
+        void TearDown() override
+        {
+            m_entities.clear();
+            m_window.reset();
+
+            MultiplayerNetworkEntityTests::TearDown();
+        }
+
+        NetEntityId AddProxyEntity(NetEntityId netId, AZ::TimeMs sendIntervalMs)
+        {
+            AZStd::unique_ptr<EntityInfo> entityInfo = AZStd::make_unique<EntityInfo>(
+                static_cast<AZ::u64>(netId), "proxy", netId, EntityInfo::Role::None);
+            PopulateNetworkEntity(*entityInfo);
+            SetupEntity(entityInfo->m_entity, netId, NetEntityRole::Authority);
+
+            const ConstNetworkEntityHandle handle(entityInfo->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+            m_window->m_replicationSet[handle] = EntityReplicationData{ NetEntityRole::Client, 1.0f, sendIntervalMs };
+            m_entities.push_back(AZStd::move(entityInfo));
+            return netId;
+        }
+
+        //! Hands the replication window to the replication manager, which creates a replicator for every entity in the set.
+        void StartReplication()
+        {
+            m_testWindow = m_window.get();
+            m_entityReplicationManager->SetReplicationWindow(AZStd::move(m_window));
+            for (AZStd::unique_ptr<EntityInfo>& entityInfo : m_entities)
+            {
+                entityInfo->m_entity->Activate();
+            }
+        }
+
+        void DirtyAllEntities()
+        {
+            ++m_dirtyCount;
+            for (AZStd::unique_ptr<EntityInfo>& entityInfo : m_entities)
+            {
+                AZ::TransformBus::Event(entityInfo->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation,
+                    AZ::Vector3(static_cast<float>(m_dirtyCount), 0.0f, 0.0f));
+            }
+            m_networkEntityManager->NotifyEntitiesDirtied();
+        }
+
+        const AZStd::vector<NetEntityId>& SendFrame(AZ::TimeMs frameTimeMs)
+        {
+            ON_CALL(*m_mockTime, GetElapsedTimeMs()).WillByDefault(::testing::Return(frameTimeMs));
+            m_testWindow->m_sentEntityIds.clear();
+            m_entityReplicationManager->SendUpdates();
+            return m_testWindow->m_sentEntityIds;
+        }
+
+        AZStd::unique_ptr<TestReplicationWindow> m_window;
+        TestReplicationWindow* m_testWindow = nullptr;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entities;
+        uint32_t m_dirtyCount = 0;
+    };
+
+    TEST_F(ReplicationSchedulingTests, CreatesIgnoreProxySendCountAndMostOverdueProxiesAreSentFirst)
+    {
+        const NetEntityId entityIds[] = {
+            AddProxyEntity(NetEntityId{ 10 }, AZ::Time::ZeroTimeMs),
+            AddProxyEntity(NetEntityId{ 11 }, AZ::Time::ZeroTimeMs),
+            AddProxyEntity(NetEntityId{ 12 }, AZ::Time::ZeroTimeMs)
+        };
+        m_window->m_maxProxySendCount = 1;
+        StartReplication();
+
+        // Creates are never throttled, every entity is created on the first frame regardless of the proxy send count
+        EXPECT_EQ(SendFrame(AZ::TimeMs{ 100 }).size(), 3);
+
+        // Every entity changes every frame but only one proxy update fits, deferred entities become more overdue
+        // and are sent on the following frames instead of being starved by lower net entity ids
+        AZStd::vector<NetEntityId> updatedEntityIds;
+        for (AZ::TimeMs frameTimeMs : { AZ::TimeMs{ 200 }, AZ::TimeMs{ 300 }, AZ::TimeMs{ 400 } })
+        {
+            DirtyAllEntities();
+            const AZStd::vector<NetEntityId>& sentEntityIds = SendFrame(frameTimeMs);
+            ASSERT_EQ(sentEntityIds.size(), 1);
+            updatedEntityIds.push_back(sentEntityIds.front());
+        }
+
+        for (NetEntityId entityId : entityIds)
+        {
+            EXPECT_EQ(AZStd::count_if(updatedEntityIds.begin(), updatedEntityIds.end(), [entityId](NetEntityId id) { return id == entityId; }), 1);
+        }
+    }
+
+    TEST_F(ReplicationSchedulingTests, ProxiesAreNotSentBeforeTheirSendInterval)
+    {
+        const NetEntityId nearEntityId = AddProxyEntity(NetEntityId{ 10 }, AZ::Time::ZeroTimeMs);
+        const NetEntityId farEntityId = AddProxyEntity(NetEntityId{ 11 }, AZ::TimeMs{ 250 });
+        StartReplication();
+
+        // The send interval doesn't delay creates
+        EXPECT_EQ(SendFrame(AZ::TimeMs{ 100 }).size(), 2);
+
+        for (AZ::TimeMs frameTimeMs : { AZ::TimeMs{ 200 }, AZ::TimeMs{ 300 }, AZ::TimeMs{ 400 }, AZ::TimeMs{ 500 }, AZ::TimeMs{ 600 } })
+        {
+            DirtyAllEntities();
+            const AZStd::vector<NetEntityId>& sentEntityIds = SendFrame(frameTimeMs);
+            const bool nearSent = AZStd::find(sentEntityIds.begin(), sentEntityIds.end(), nearEntityId) != sentEntityIds.end();
+            const bool farSent = AZStd::find(sentEntityIds.begin(), sentEntityIds.end(), farEntityId) != sentEntityIds.end();
+
+            // The far entity was last sent at 100ms, so it is next due 250ms later
+            EXPECT_TRUE(nearSent);
+            EXPECT_EQ(farSent, frameTimeMs == AZ::TimeMs{ 400 });
+        }
+    }
+
+    TEST_F(ReplicationSchedulingTests, ReplicationLodIntervalGrowsWithDistance)
+    {
+        // Replication LOD is disabled by default
+        EXPECT_EQ(ServerToClientReplicationWindow::CalculateSendIntervalMs(0.0f), AZ::Time::ZeroTimeMs);
+        EXPECT_EQ(ServerToClientReplicationWindow::CalculateSendIntervalMs(10000.0f * 10000.0f), AZ::Time::ZeroTimeMs);
+
+        const float lodDistance = sv_ReplicationLodDistance;
+        sv_ReplicationLodDistance = 100.0f;
+
+        EXPECT_EQ(ServerToClientReplicationWindow::CalculateSendIntervalMs(50.0f * 50.0f), AZ::Time::ZeroTimeMs);
+        EXPECT_EQ(ServerToClientReplicationWindow::CalculateSendIntervalMs(150.0f * 150.0f), AZ::TimeMs{ 50 });
+        EXPECT_EQ(ServerToClientReplicationWindow::CalculateSendIntervalMs(250.0f * 250.0f), AZ::TimeMs{ 100 });
+        EXPECT_EQ(ServerToClientReplicationWindow::CalculateSendIntervalMs(10000.0f * 10000.0f), AZ::TimeMs{ 250 });
+
+        sv_ReplicationLodDistance = lodDistance;
+    }
 } // namespace Multiplayer
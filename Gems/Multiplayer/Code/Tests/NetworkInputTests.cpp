@@ -9,6 +9,7 @@
 #include <MockInterfaces.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -135,6 +136,188 @@ namespace Multiplayer
         }
     }
 
+    TEST_F(NetworkInputTests, NetworkInputArrayBaselineSerialization)
+    {
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        NetworkInputArray baselineArray = NetworkInputArray(handle);
+        NetworkInput& baseline = baselineArray[0];
+        baseline.SetClientInputId(ClientInputId(1));
+        baseline.SetHostFrameId(HostFrameId(1));
+        baseline.SetHostBlendFactor(BLEND_FACTOR_SCALE);
+        baseline.SetHostTimeMs(AZ::TimeMs(TIME_SCALE));
+
+        NetworkInputArray inArray = NetworkInputArray(handle);
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            const uint32_t inputId = NetworkInputArray::MaxElements + 1 - i;
+            inArray[i].SetClientInputId(ClientInputId(inputId));
+            inArray[i].SetHostFrameId(HostFrameId(inputId));
+            inArray[i].SetHostBlendFactor(inputId * BLEND_FACTOR_SCALE);
+            inArray[i].SetHostTimeMs(AZ::TimeMs(inputId * TIME_SCALE));
+        }
+        inArray.SetBaseline(baseline);
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inArray.Serialize(inSerializer));
+
+        NetworkInputArray outArray;
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(outArray.Serialize(outSerializer));
+
+        // Nothing can be read until the baseline is supplied
+        EXPECT_TRUE(outArray.RequiresBaseline());
+        EXPECT_EQ(outArray.GetBaselineInputId(), ClientInputId(1));
+
+        // Supplying the wrong baseline must fail rather than produce garbage inputs
+        NetworkInputArray wrongArray(outArray);
+        NetworkInput& wrongBaseline = baselineArray[1];
+        wrongBaseline.SetClientInputId(ClientInputId(2));
+        EXPECT_FALSE(wrongArray.ApplyBaseline(wrongBaseline));
+
+        EXPECT_TRUE(outArray.ApplyBaseline(baseline));
+        EXPECT_FALSE(outArray.RequiresBaseline());
+
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            EXPECT_EQ(inArray[i].GetClientInputId(), outArray[i].GetClientInputId());
+            EXPECT_EQ(inArray[i].GetHostFrameId(), outArray[i].GetHostFrameId());
+            EXPECT_NEAR(inArray[i].GetHostBlendFactor(), outArray[i].GetHostBlendFactor(), 0.001f);
+            EXPECT_EQ(inArray[i].GetHostTimeMs(), outArray[i].GetHostTimeMs());
+        }
+    }
+
+    TEST_F(NetworkInputTests, NetworkInputArrayPacketLoss)
+    {
+        // Simulates a client streaming input arrays to a server over a lossy link with delayed acknowledgements,
+        // mirroring the bookkeeping in LocalPredictionPlayerInputComponent, and validates every input the server reconstructs
+        constexpr uint32_t InputCount = 2000;
+        constexpr uint32_t PacketLossPercent = 30;
+        constexpr uint32_t AckLossPercent = 30;
+        constexpr uint32_t AckDelay = 4;
+
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        AZ::SimpleLcgRandom random(1234);
+
+        NetworkInputHistory clientHistory;
+        NetworkInputHistory serverAcknowledged;
+        AZStd::deque<AZStd::pair<uint32_t, ClientInputId>> pendingAcks; // Delivery tick and acked input id
+        ClientInputId clientAckedId = ClientInputId{ 0 };
+        ClientInputId serverLastInputId = ClientInputId{ 0 };
+
+        uint32_t deliveredCount = 0;
+        uint32_t baselineEncodedCount = 0;
+        uint32_t validatedInputCount = 0;
+
+        for (uint32_t tick = 1; tick <= InputCount; ++tick)
+        {
+            // Deliver any acknowledgements that have arrived
+            while (!pendingAcks.empty() && pendingAcks.front().first <= tick)
+            {
+                clientAckedId = pendingAcks.front().second;
+                pendingAcks.pop_front();
+            }
+
+            // Client produces a new input, only some fields change from one input to the next
+            NetworkInputArray inArray = NetworkInputArray(handle);
+            inArray[0].SetClientInputId(ClientInputId(tick));
+            inArray[0].SetHostFrameId(HostFrameId(tick / 3));
+            inArray[0].SetHostBlendFactor((tick % 7) * BLEND_FACTOR_SCALE);
+            inArray[0].SetHostTimeMs(AZ::TimeMs((tick / 2) * TIME_SCALE));
+            clientHistory.PushBack(inArray[0]);
+            while (clientHistory.Size() > 2 * NetworkInputArray::MaxBaselineAge)
+            {
+                clientHistory.PopFront();
+            }
+
+            const int64_t historySize = aznumeric_cast<int64_t>(clientHistory.Size());
+            for (int64_t i = 1; i < aznumeric_cast<int64_t>(NetworkInputArray::MaxElements); ++i)
+            {
+                inArray[static_cast<uint32_t>(i)] = clientHistory[AZStd::max<int64_t>(historySize - 1 - i, 0)];
+            }
+
+            const uint32_t ackedAge = tick - aznumeric_cast<uint32_t>(clientAckedId);
+            if ((clientAckedId != ClientInputId{ 0 }) && (ackedAge > 0) && (ackedAge < NetworkInputArray::MaxBaselineAge))
+            {
+                for (AZStd::size_t i = clientHistory.Size(); i > 0; --i)
+                {
+                    if (clientHistory[i - 1].GetClientInputId() == clientAckedId)
+                    {
+                        inArray.SetBaseline(clientHistory[i - 1]);
+                        break;
+                    }
+                }
+            }
+
+            AZStd::array<uint8_t, 1024> buffer;
+            AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            ASSERT_TRUE(inArray.Serialize(inSerializer));
+
+            if (random.GetRandom() % 100 < PacketLossPercent)
+            {
+                continue;
+            }
+            ++deliveredCount;
+
+            NetworkInputArray outArray;
+            AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+            ASSERT_TRUE(outArray.Serialize(outSerializer));
+
+            if (outArray.RequiresBaseline())
+            {
+                ++baselineEncodedCount;
+                const NetworkInput* baseline = nullptr;
+                for (AZStd::size_t i = serverAcknowledged.Size(); i > 0; --i)
+                {
+                    if (serverAcknowledged[i - 1].GetClientInputId() == outArray.GetBaselineInputId())
+                    {
+                        baseline = &serverAcknowledged[i - 1];
+                        break;
+                    }
+                }
+
+                // The client only encodes against acknowledged inputs recent enough for the server to have retained
+                ASSERT_NE(baseline, nullptr);
+                ASSERT_TRUE(outArray.ApplyBaseline(*baseline));
+            }
+
+            // Every input the server has not seen yet must be reconstructed exactly, older elements are clamped duplicates
+            const uint32_t newestId = aznumeric_cast<uint32_t>(outArray[0].GetClientInputId());
+            EXPECT_EQ(newestId, tick);
+            for (uint32_t i = 0; i < NetworkInputArray::MaxElements && i < tick; ++i)
+            {
+                const uint32_t expectedId = tick - i;
+                if (expectedId <= aznumeric_cast<uint32_t>(serverLastInputId))
+                {
+                    break;
+                }
+                const NetworkInput& expected = clientHistory[clientHistory.Size() - 1 - i];
+                EXPECT_EQ(outArray[i].GetClientInputId(), ClientInputId(expectedId));
+                EXPECT_EQ(outArray[i].GetClientInputId(), expected.GetClientInputId());
+                EXPECT_EQ(outArray[i].GetHostFrameId(), expected.GetHostFrameId());
+                EXPECT_NEAR(outArray[i].GetHostBlendFactor(), expected.GetHostBlendFactor(), 0.001f);
+                EXPECT_EQ(outArray[i].GetHostTimeMs(), expected.GetHostTimeMs());
+                ++validatedInputCount;
+            }
+            serverLastInputId = outArray[0].GetClientInputId();
+
+            serverAcknowledged.PushBack(outArray[0]);
+            while (serverAcknowledged.Size() > NetworkInputArray::MaxBaselineAge)
+            {
+                serverAcknowledged.PopFront();
+            }
+
+            if (random.GetRandom() % 100 >= AckLossPercent)
+            {
+                pendingAcks.emplace_back(tick + AckDelay, outArray[0].GetClientInputId());
+            }
+        }
+
+        EXPECT_GT(deliveredCount, 0u);
+        EXPECT_GT(baselineEncodedCount, 0u);
+        EXPECT_GT(validatedInputCount, deliveredCount);
+    }
+
     TEST_F(NetworkInputTests, NetworkInputHistory)
     {
         const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
@@ -106,6 +106,35 @@ namespace UnitTest
         }
     }
 
+    TEST_F(RewindableObjectTests, HostFrameCompletedEventSignalsOncePerHostFrame)
+    {
+        uint32_t signalCount = 0;
+        Multiplayer::HostFrameId lastFrameId = Multiplayer::InvalidHostFrameId;
+        Multiplayer::HostFrameCompletedEvent::Handler handler([&signalCount, &lastFrameId](Multiplayer::HostFrameId frameId)
+        {
+            ++signalCount;
+            lastFrameId = frameId;
+        });
+        Multiplayer::GetNetworkTime()->AddHostFrameCompletedHandler(handler);
+
+        const Multiplayer::HostFrameId startFrameId = Multiplayer::GetNetworkTime()->GetUnalteredHostFrameId();
+        Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        EXPECT_EQ(2, signalCount);
+        EXPECT_EQ(startFrameId + Multiplayer::HostFrameId(1), lastFrameId);
+        EXPECT_EQ(startFrameId + Multiplayer::HostFrameId(2), Multiplayer::GetNetworkTime()->GetUnalteredHostFrameId());
+
+        // Rewinding time must not be mistaken for a new host frame
+        {
+            Multiplayer::ScopedAlterTime time(startFrameId, AZ::Time::ZeroTimeMs, 1.f, AzNetworking::InvalidConnectionId);
+        }
+        EXPECT_EQ(2, signalCount);
+
+        handler.Disconnect();
+        Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        EXPECT_EQ(2, signalCount);
+    }
+
     struct Object
     {
         uint32_t value;
@@ -48,6 +48,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
+    Include/Multiplayer/NetworkTime/HitVolumeHistory.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
@@ -88,6 +89,7 @@ set(FILES
     Source/NetworkInput/NetworkInputChild.cpp
     Source/NetworkInput/NetworkInputHistory.cpp
     Source/NetworkInput/NetworkInputMigrationVector.cpp
+    Source/NetworkTime/HitVolumeHistory.cpp
     Source/Session/MatchmakingRequests.cpp
     Source/Session/SessionRequests.cpp
     Source/Session/SessionConfig.cpp
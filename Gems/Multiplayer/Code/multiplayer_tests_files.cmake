@@ -18,12 +18,14 @@ set(FILES
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
+    Tests/HitVolumeHistoryTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
     Tests/MockInterfaces.h
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
+    Tests/MultiplayerLoadTestBenchmarks.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
     Tests/NetworkEntityTests.cpp
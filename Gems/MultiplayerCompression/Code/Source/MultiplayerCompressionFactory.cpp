@@ -8,6 +8,7 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
 
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -22,4 +23,21 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZstdCompressionFactory::Create()
+    {
+        // AzNetworking never calls Init() on created compressors, and the zstd contexts and dictionary must exist before the first packet
+        AZStd::unique_ptr<ZstdCompressor> compressor = AZStd::make_unique<ZstdCompressor>();
+        if (!compressor->Init())
+        {
+            AZ_Error("Multiplayer Compressor", false, "Failed to initialize the zstd compressor, packets will not be compressed");
+            return nullptr;
+        }
+        return compressor;
+    }
+
+    const AZStd::string_view ZstdCompressionFactory::GetFactoryName() const
+    {
+        return s_compressorName;
+    }
 }
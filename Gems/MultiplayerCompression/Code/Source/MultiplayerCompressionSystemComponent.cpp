@@ -28,7 +28,7 @@ namespace MultiplayerCompression
 
             if (AZ::EditContext* ec = serialize->GetEditContext())
             {
-                ec->Class<MultiplayerCompressionSystemComponent>("MultiplayerCompression", "Provides packet compression via an open source library for the Multiplayer Gem")
+                ec->Class<MultiplayerCompressionSystemComponent>("MultiplayerCompression", "Provides packet compression via open source libraries (LZ4, zstd) for the Multiplayer Gem")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                     ;
@@ -58,10 +58,15 @@ namespace MultiplayerCompression
         auto* compressionFactory = new MultiplayerCompressionFactory();
         m_multiplayerCompressionFactoryName = compressionFactory->GetFactoryName();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(compressionFactory);
+
+        auto* zstdCompressionFactory = new ZstdCompressionFactory();
+        m_zstdCompressionFactoryName = zstdCompressionFactory->GetFactoryName();
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(zstdCompressionFactory);
     }
 
     void MultiplayerCompressionSystemComponent::Deactivate()
     {
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactoryName);
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdCompressionFactoryName);
     }
 }
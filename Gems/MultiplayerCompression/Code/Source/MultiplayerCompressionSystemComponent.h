@@ -42,5 +42,6 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         AZStd::string_view m_multiplayerCompressionFactoryName;
+        AZStd::string_view m_zstdCompressionFactoryName;
     };
 }
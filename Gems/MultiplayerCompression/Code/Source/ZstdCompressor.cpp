@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/SystemFile.h>
+
+#include <zstd.h>
+#include <zstd_errors.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The zstd compression level used by the Zstd compressor, higher values trade CPU time for ratio");
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path to a trained zstd dictionary, clients and servers must use the same dictionary. Leave empty to compress without a dictionary"); // WARN: needs to be set before creating the network interface
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ReleaseContexts();
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        const AZ::CVarFixedString dictionaryPath = static_cast<AZ::CVarFixedString>(net_ZstdDictionaryPath);
+        if (dictionaryPath.empty())
+        {
+            ReleaseContexts();
+            m_compressionLevel = net_ZstdCompressionLevel;
+            return CreateContexts();
+        }
+
+        AZStd::vector<AZ::u8> dictionary;
+        dictionary.resize_no_construct(AZ::IO::SystemFile::Length(dictionaryPath.c_str()));
+        if (dictionary.empty() || AZ::IO::SystemFile::Read(dictionaryPath.c_str(), dictionary.data()) != dictionary.size())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd dictionary from %s", dictionaryPath.c_str());
+            return false;
+        }
+
+        return InitWithDictionary(dictionary, net_ZstdCompressionLevel);
+    }
+
+    bool ZstdCompressor::InitWithDictionary(const AZStd::vector<AZ::u8>& dictionary, int compressionLevel)
+    {
+        ReleaseContexts();
+        m_compressionLevel = compressionLevel;
+
+        if (!dictionary.empty())
+        {
+            // The digested dictionaries are immutable and reused for every packet, so the per packet cost of priming is only paid once here
+            m_compressionDictionary = ZSTD_createCDict(dictionary.data(), dictionary.size(), m_compressionLevel);
+            m_decompressionDictionary = ZSTD_createDDict(dictionary.data(), dictionary.size());
+            if (m_compressionDictionary == nullptr || m_decompressionDictionary == nullptr)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Failed to create zstd dictionary from %zu bytes", dictionary.size());
+                ReleaseContexts();
+                return false;
+            }
+        }
+
+        return CreateContexts();
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_compressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compress() called before Init()");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        ZstdDictionaryTrainer::CaptureSample(uncompData, uncompSize);
+
+        const size_t result = (m_compressionDictionary != nullptr)
+            ? ZSTD_compress_usingCDict(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionDictionary)
+            : ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            if (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Outbuffer size (%zu B) passed to Compress() is less than required, worst case is (%zu B)", compDataSize, ZSTD_compressBound(uncompSize));
+                return AzNetworking::CompressorError::InsufficientBuffer;
+            }
+
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B) error:(%s)", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompress() called before Init()");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = (m_decompressionDictionary != nullptr)
+            ? ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_decompressionDictionary)
+            : ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            // Covers corrupt data, insufficient output buffer and dictionary mismatches between endpoints
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B) error:(%s)", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    bool ZstdCompressor::CreateContexts()
+    {
+        m_compressionContext = ZSTD_createCCtx();
+        m_decompressionContext = ZSTD_createDCtx();
+        if (m_compressionContext == nullptr || m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create zstd contexts");
+            ReleaseContexts();
+            return false;
+        }
+        return true;
+    }
+
+    void ZstdCompressor::ReleaseContexts()
+    {
+        // All of the zstd free functions accept null
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+        m_compressionContext = nullptr;
+        m_decompressionContext = nullptr;
+        m_compressionDictionary = nullptr;
+        m_decompressionDictionary = nullptr;
+    }
+}
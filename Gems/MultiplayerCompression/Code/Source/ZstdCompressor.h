@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    /**
+    * Implements a zstd Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * Packets are small and highly repetitive, so the compressor can optionally be primed with a dictionary trained
+    * from captured replication traffic (see ZstdDictionaryTrainer). Both endpoints must use the same dictionary.
+    * Compression and decompression contexts are created once and reused for every packet.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator);
+
+        ZstdCompressor() = default;
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; };
+
+        //! Creates the zstd contexts and loads the dictionary named by net_ZstdDictionaryPath, if any.
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+        //! Initializes the compressor with an in-memory dictionary rather than loading one from disk.
+        //! @param dictionary       the raw dictionary content, as produced by ZstdDictionaryTrainer
+        //! @param compressionLevel the zstd compression level to use
+        //! @return true if the contexts and dictionary were successfully created
+        bool InitWithDictionary(const AZStd::vector<AZ::u8>& dictionary, int compressionLevel);
+
+        //! Returns true if this compressor has a dictionary loaded.
+        bool HasDictionary() const { return m_compressionDictionary != nullptr; }
+
+    private:
+        bool CreateContexts();
+        void ReleaseContexts();
+
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressionDictionary = nullptr;
+        int m_compressionLevel = 0;
+    };
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    namespace
+    {
+        struct CaptureState
+        {
+            AZStd::mutex m_mutex;
+            AZ::IO::SystemFile m_file;
+            AZStd::atomic_bool m_enabled{ false };
+        };
+
+        CaptureState& GetCaptureState()
+        {
+            static CaptureState s_captureState;
+            return s_captureState;
+        }
+
+        void OnCaptureFileChanged(const AZ::CVarFixedString& captureFile)
+        {
+            CaptureState& state = GetCaptureState();
+            AZStd::lock_guard<AZStd::mutex> lock(state.m_mutex);
+            state.m_enabled = false;
+            state.m_file.Close();
+
+            if (!captureFile.empty())
+            {
+                const int openMode = AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH;
+                if (state.m_file.Open(captureFile.c_str(), openMode))
+                {
+                    state.m_enabled = true;
+                }
+                else
+                {
+                    AZLOG_ERROR("Failed to open zstd packet capture file %s", captureFile.c_str());
+                }
+            }
+        }
+    }
+
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdCaptureFile, "", OnCaptureFileChanged, AZ::ConsoleFunctorFlags::DontReplicate, "If set, every packet compressed by the Zstd compressor is appended uncompressed to this file for dictionary training");
+
+    void ZstdDictionaryTrainer::CaptureSample(const void* data, size_t size)
+    {
+        CaptureState& state = GetCaptureState();
+        if (!state.m_enabled)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(state.m_mutex);
+        if (state.m_file.IsOpen())
+        {
+            const AZ::u32 sampleSize = aznumeric_cast<AZ::u32>(size);
+            state.m_file.Write(&sampleSize, sizeof(sampleSize));
+            state.m_file.Write(data, size);
+        }
+    }
+
+    bool ZstdDictionaryTrainer::LoadCapture(const char* captureFile, AZStd::vector<AZ::u8>& outSamples, AZStd::vector<size_t>& outSizes)
+    {
+        AZStd::vector<AZ::u8> capture;
+        capture.resize_no_construct(AZ::IO::SystemFile::Length(captureFile));
+        if (capture.empty() || AZ::IO::SystemFile::Read(captureFile, capture.data()) != capture.size())
+        {
+            AZLOG_ERROR("Failed to read zstd packet capture file %s", captureFile);
+            return false;
+        }
+
+        outSamples.clear();
+        outSizes.clear();
+        outSamples.reserve(capture.size());
+
+        size_t offset = 0;
+        while (offset + sizeof(AZ::u32) <= capture.size())
+        {
+            AZ::u32 sampleSize = 0;
+            memcpy(&sampleSize, capture.data() + offset, sizeof(sampleSize));
+            offset += sizeof(sampleSize);
+
+            if (offset + sampleSize > capture.size())
+            {
+                AZLOG_WARN("Truncated sample at offset %zu in zstd packet capture file %s", offset, captureFile);
+                break;
+            }
+
+            outSamples.insert(outSamples.end(), capture.begin() + offset, capture.begin() + offset + sampleSize);
+            outSizes.push_back(sampleSize);
+            offset += sampleSize;
+        }
+
+        return !outSizes.empty();
+    }
+
+    bool ZstdDictionaryTrainer::TrainDictionary(const AZStd::vector<AZ::u8>& samples, const AZStd::vector<size_t>& sizes, size_t dictionaryCapacity, AZStd::vector<AZ::u8>& outDictionary)
+    {
+        outDictionary.resize_no_construct(dictionaryCapacity);
+        const size_t result = ZDICT_trainFromBuffer(outDictionary.data(), outDictionary.size(), samples.data(), sizes.data(), aznumeric_cast<unsigned>(sizes.size()));
+        if (ZDICT_isError(result))
+        {
+            AZLOG_ERROR("zstd dictionary training failed on %zu samples: %s", sizes.size(), ZDICT_getErrorName(result));
+            outDictionary.clear();
+            return false;
+        }
+
+        outDictionary.resize(result);
+        return true;
+    }
+
+    bool ZstdDictionaryTrainer::TrainFromCaptureFile(const char* captureFile, const char* dictionaryFile, size_t dictionaryCapacity)
+    {
+        AZStd::vector<AZ::u8> samples;
+        AZStd::vector<size_t> sizes;
+        if (!LoadCapture(captureFile, samples, sizes))
+        {
+            return false;
+        }
+
+        AZStd::vector<AZ::u8> dictionary;
+        if (!TrainDictionary(samples, sizes, dictionaryCapacity, dictionary))
+        {
+            return false;
+        }
+
+        AZ::IO::SystemFile outputFile;
+        const int openMode = AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH;
+        if (!outputFile.Open(dictionaryFile, openMode) || outputFile.Write(dictionary.data(), dictionary.size()) != dictionary.size())
+        {
+            AZLOG_ERROR("Failed to write zstd dictionary to %s", dictionaryFile);
+            return false;
+        }
+
+        AZLOG_INFO("Trained %zu byte zstd dictionary from %zu samples (%zu bytes), written to %s", dictionary.size(), sizes.size(), samples.size(), dictionaryFile);
+        return true;
+    }
+
+    void net_ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_ERROR("Usage: net_ZstdTrainDictionary <captureFile> <dictionaryFile> [dictionaryBytes]");
+            return;
+        }
+
+        const AZ::CVarFixedString captureFile(arguments[0]);
+        const AZ::CVarFixedString dictionaryFile(arguments[1]);
+        size_t dictionaryCapacity = ZstdDictionaryTrainer::DefaultDictionaryCapacity;
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(dictionaryCapacity, arguments[2]);
+        }
+
+        ZstdDictionaryTrainer::TrainFromCaptureFile(captureFile.c_str(), dictionaryFile.c_str(), dictionaryCapacity);
+    }
+    AZ_CONSOLEFREEFUNC(net_ZstdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a zstd dictionary from a packet capture: net_ZstdTrainDictionary <captureFile> <dictionaryFile> [dictionaryBytes]");
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace MultiplayerCompression
+{
+    /**
+    * Captures uncompressed packet payloads and trains zstd dictionaries from them.
+    *
+    * Typical workflow:
+    *  1. Run a representative session with `net_ZstdCaptureFile <path>` set, every packet passing through a ZstdCompressor is appended to the capture.
+    *  2. Run `net_ZstdTrainDictionary <capturePath> <dictionaryPath> [dictionaryBytes]` to produce a dictionary.
+    *  3. Ship the dictionary with both client and server and point `net_ZstdDictionaryPath` at it.
+    *
+    * Capture files are a flat sequence of samples, each prefixed by its size as a 32 bit unsigned integer.
+    */
+    class ZstdDictionaryTrainer
+    {
+    public:
+        //! Default dictionary size, zstd recommends roughly 100x smaller than the total sample size.
+        static constexpr size_t DefaultDictionaryCapacity = 16 * 1024;
+
+        //! Appends a single uncompressed packet to the active capture file, if capturing is enabled.
+        //! Safe to call from multiple network threads.
+        //! @param data the uncompressed packet payload
+        //! @param size the size of the payload in bytes
+        static void CaptureSample(const void* data, size_t size);
+
+        //! Reads all samples out of a capture file.
+        //! @param captureFile the capture file to read
+        //! @param outSamples  the concatenated sample data
+        //! @param outSizes    the size of each individual sample within outSamples
+        //! @return true if the capture was read successfully and contained at least one sample
+        static bool LoadCapture(const char* captureFile, AZStd::vector<AZ::u8>& outSamples, AZStd::vector<size_t>& outSizes);
+
+        //! Trains a dictionary from a set of samples.
+        //! @param samples            the concatenated sample data
+        //! @param sizes              the size of each individual sample within samples
+        //! @param dictionaryCapacity the maximum size of the resulting dictionary
+        //! @param outDictionary      the trained dictionary
+        //! @return true if training succeeded
+        static bool TrainDictionary(const AZStd::vector<AZ::u8>& samples, const AZStd::vector<size_t>& sizes, size_t dictionaryCapacity, AZStd::vector<AZ::u8>& outDictionary);
+
+        //! Trains a dictionary from a capture file and writes it to disk.
+        //! @param captureFile        the capture file to read
+        //! @param dictionaryFile     the file to write the trained dictionary to
+        //! @param dictionaryCapacity the maximum size of the resulting dictionary
+        //! @return true if the dictionary was trained and written successfully
+        static bool TrainFromCaptureFile(const char* captureFile, const char* dictionaryFile, size_t dictionaryCapacity);
+    };
+}
@@ -10,13 +10,58 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
+#include <ZstdDictionaryTrainer.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/Math/Random.h>
 #include <AzTest/AzTest.h>
 
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace MultiplayerCompressionTestUtils
+{
+    //! Builds a packet resembling entity replication traffic: a fixed header followed by a run of entity updates
+    //! that share layout and most of their content, with small per entity and per packet variation.
+    void BuildReplicationLikePacket(AZ::SimpleLcgRandom& random, AZStd::vector<AZ::u8>& outPacket)
+    {
+        outPacket.clear();
+        const AZ::u8 header[] = { 0x4F, 0x33, 0x44, 0x45, 0x01, 0x00, 0x10, 0x20 };
+        outPacket.insert(outPacket.end(), AZStd::begin(header), AZStd::end(header));
+
+        const AZ::u32 entityCount = 4 + random.GetRandom() % 12;
+        for (AZ::u32 entity = 0; entity < entityCount; ++entity)
+        {
+            const AZ::u32 netEntityId = 1000 + random.GetRandom() % 64;
+            const AZ::u16 componentMask = 0x0107;
+            const float position[3] = { static_cast<float>(netEntityId % 16), 0.5f, static_cast<float>(random.GetRandom() % 4) };
+            const AZ::u8* entityBytes = reinterpret_cast<const AZ::u8*>(&netEntityId);
+            outPacket.insert(outPacket.end(), entityBytes, entityBytes + sizeof(netEntityId));
+            const AZ::u8* maskBytes = reinterpret_cast<const AZ::u8*>(&componentMask);
+            outPacket.insert(outPacket.end(), maskBytes, maskBytes + sizeof(componentMask));
+            const AZ::u8* positionBytes = reinterpret_cast<const AZ::u8*>(position);
+            outPacket.insert(outPacket.end(), positionBytes, positionBytes + sizeof(position));
+        }
+    }
+
+    void BuildTrainingSet(AZ::u32 sampleCount, AZStd::vector<AZ::u8>& outSamples, AZStd::vector<size_t>& outSizes)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZ::u8> packet;
+        for (AZ::u32 sample = 0; sample < sampleCount; ++sample)
+        {
+            BuildReplicationLikePacket(random, packet);
+            outSamples.insert(outSamples.end(), packet.begin(), packet.end());
+            outSizes.push_back(packet.size());
+        }
+    }
+}
+
 class MultiplayerCompressionTest
     : public UnitTest::LeakDetectionFixture
 {
@@ -115,4 +160,192 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdCompressTest)
+{
+    AzNetworking::UdpPacketEncodingBuffer buffer;
+    buffer.Resize(buffer.GetCapacity());
+    memset(buffer.GetBuffer(), 255, buffer.GetCapacity());
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+    ASSERT_TRUE(zstdCompressor.InitWithDictionary({}, 3));
+    EXPECT_FALSE(zstdCompressor.HasDictionary());
+
+    AZStd::vector<char> compressedBuffer(zstdCompressor.GetMaxCompressedBufferSize(buffer.GetSize()));
+    AZStd::vector<char> decompressedBuffer(buffer.GetSize());
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(buffer.GetBuffer(), buffer.GetSize(), compressedBuffer.data(), compressedBuffer.size(), compressedSize);
+    ASSERT_TRUE(compressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, buffer.GetSize());
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize);
+    ASSERT_TRUE(decompressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, buffer.GetSize());
+    EXPECT_EQ(consumedSize, compressedSize);
+    EXPECT_TRUE(memcmp(decompressedBuffer.data(), buffer.GetBuffer(), uncompressedSize) == 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdDictionaryTest)
+{
+    AZStd::vector<AZ::u8> samples;
+    AZStd::vector<size_t> sizes;
+    MultiplayerCompressionTestUtils::BuildTrainingSet(2000, samples, sizes);
+
+    AZStd::vector<AZ::u8> dictionary;
+    ASSERT_TRUE(MultiplayerCompression::ZstdDictionaryTrainer::TrainDictionary(samples, sizes, 4 * 1024, dictionary));
+    EXPECT_FALSE(dictionary.empty());
+    EXPECT_LE(dictionary.size(), 4u * 1024u);
+
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    ASSERT_TRUE(plainCompressor.InitWithDictionary({}, 3));
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor;
+    ASSERT_TRUE(dictionaryCompressor.InitWithDictionary(dictionary, 3));
+    EXPECT_TRUE(dictionaryCompressor.HasDictionary());
+
+    // Use packets the dictionary was not trained on
+    AZ::SimpleLcgRandom random(5678);
+    AZStd::vector<AZ::u8> packet;
+    size_t plainTotal = 0;
+    size_t dictionaryTotal = 0;
+    for (AZ::u32 i = 0; i < 100; ++i)
+    {
+        MultiplayerCompressionTestUtils::BuildReplicationLikePacket(random, packet);
+        AZStd::vector<char> compressedBuffer(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+        AZStd::vector<AZ::u8> decompressedBuffer(packet.size());
+        size_t compressedSize = 0;
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+
+        ASSERT_TRUE(plainCompressor.Compress(packet.data(), packet.size(), compressedBuffer.data(), compressedBuffer.size(), compressedSize) == AzNetworking::CompressorError::Ok);
+        plainTotal += compressedSize;
+
+        ASSERT_TRUE(dictionaryCompressor.Compress(packet.data(), packet.size(), compressedBuffer.data(), compressedBuffer.size(), compressedSize) == AzNetworking::CompressorError::Ok);
+        dictionaryTotal += compressedSize;
+
+        ASSERT_TRUE(dictionaryCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize) == AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(uncompressedSize, packet.size());
+        EXPECT_TRUE(memcmp(decompressedBuffer.data(), packet.data(), packet.size()) == 0);
+    }
+
+    EXPECT_LT(dictionaryTotal, plainTotal);
+    AZ_TracePrintf("Multiplayer Compression Test", "Zstd compressed total without dictionary:(%zu B) with dictionary:(%zu B) \n", plainTotal, dictionaryTotal);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdUninitializedTest)
+{
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    char input[4] = {};
+    char output[64] = {};
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+
+    EXPECT_TRUE(zstdCompressor.Compress(nullptr, 4, output, sizeof(output), compressedSize) == AzNetworking::CompressorError::Uninitialized);
+    EXPECT_TRUE(zstdCompressor.Compress(input, sizeof(input), output, sizeof(output), compressedSize) == AzNetworking::CompressorError::Uninitialized);
+    EXPECT_TRUE(zstdCompressor.Decompress(input, sizeof(input), output, sizeof(output), consumedSize, uncompressedSize) == AzNetworking::CompressorError::Uninitialized);
+}
+
+#ifdef HAVE_BENCHMARK
+namespace Benchmark
+{
+    //! Compresses replication-like packets one at a time, reporting the achieved ratio alongside time per packet.
+    class MultiplayerCompressionBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t MaxPacketSize = 2048;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunCompression(AzNetworking::ICompressor& compressor, benchmark::State& state)
+        {
+            AZStd::vector<char> compressedBuffer(compressor.GetMaxCompressedBufferSize(MaxPacketSize));
+            size_t packetIndex = 0;
+            size_t uncompressedTotal = 0;
+            size_t compressedTotal = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZStd::vector<AZ::u8>& packet = m_packets[packetIndex];
+                packetIndex = (packetIndex + 1) % m_packets.size();
+
+                size_t compressedSize = 0;
+                compressor.Compress(packet.data(), packet.size(), compressedBuffer.data(), compressedBuffer.size(), compressedSize);
+                uncompressedTotal += packet.size();
+                compressedTotal += compressedSize;
+            }
+            state.counters["Ratio"] = compressedTotal > 0 ? static_cast<double>(uncompressedTotal) / static_cast<double>(compressedTotal) : 0.0;
+            state.SetBytesProcessed(uncompressedTotal);
+        }
+
+        AZStd::vector<AZ::u8> m_dictionary;
+        AZStd::vector<AZStd::vector<AZ::u8>> m_packets;
+
+    private:
+        void internalSetUp()
+        {
+            AZStd::vector<AZ::u8> samples;
+            AZStd::vector<size_t> sizes;
+            MultiplayerCompressionTestUtils::BuildTrainingSet(2000, samples, sizes);
+            MultiplayerCompression::ZstdDictionaryTrainer::TrainDictionary(samples, sizes, 4 * 1024, m_dictionary);
+
+            AZ::SimpleLcgRandom random(5678);
+            m_packets.resize(256);
+            for (AZStd::vector<AZ::u8>& packet : m_packets)
+            {
+                MultiplayerCompressionTestUtils::BuildReplicationLikePacket(random, packet);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_dictionary = {};
+            m_packets = {};
+        }
+    };
+
+    BENCHMARK_F(MultiplayerCompressionBenchmarkFixture, LZ4)(benchmark::State& state)
+    {
+        MultiplayerCompression::LZ4Compressor compressor;
+        RunCompression(compressor, state);
+    }
+
+    BENCHMARK_F(MultiplayerCompressionBenchmarkFixture, Zstd)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor;
+        compressor.InitWithDictionary({}, 3);
+        RunCompression(compressor, state);
+    }
+
+    BENCHMARK_F(MultiplayerCompressionBenchmarkFixture, ZstdDictionary)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor;
+        compressor.InitWithDictionary(m_dictionary, 3);
+        RunCompression(compressor, state);
+    }
+}
+#endif // HAVE_BENCHMARK
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
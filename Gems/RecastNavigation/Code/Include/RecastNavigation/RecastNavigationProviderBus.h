@@ -34,6 +34,19 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Collects the geometry of only the tiles that changed since the last collection and returns the result via the callback
+        //! @tileCallback, so that a navigation mesh can replace just those tiles. Providers that don't track changes collect every tile.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile. In order for navigation tiles to connect
+        //!               to their respective neighboring tiles, they need additional geometry in the near vicinity.
+        //! @param tileCallback will be called once for each changed tile and one last time to indicate the end of the operation with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectChangedGeometryAsync(float tileSize, float borderSize,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+        {
+            return CollectGeometryAsync(tileSize, borderSize, AZStd::move(tileCallback));
+        }
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -108,6 +108,10 @@ namespace RecastNavigation
             }
         }
 
+        // The blocking collection lays its tiles out from the minimum of the world bounds instead of the adjusted origin of the
+        // async collection, so the next async update has to replace every tile.
+        m_hasAllTiles = false;
+
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
         m_updateInProgress = false;
@@ -121,9 +125,15 @@ namespace RecastNavigation
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
+            // Once the navigation mesh has all of its tiles, only the tiles where the geometry changed need to be rebuilt.
+            // The new tiles replace the old ones as they are processed.
+            const auto collectGeometry = m_hasAllTiles
+                ? &RecastNavigationProviderRequests::CollectChangedGeometryAsync
+                : &RecastNavigationProviderRequests::CollectGeometryAsync;
+
             bool operationScheduled = false;
             RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
+                collectGeometry,
                 m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
                 [this](AZStd::shared_ptr<TileGeometry> tile)
                 {
@@ -135,6 +145,8 @@ namespace RecastNavigation
                 m_updateInProgress = false;
                 return false;
             }
+
+            m_hasAllTiles = true;
             return true;
         }
 
@@ -368,6 +380,7 @@ namespace RecastNavigation
 
         m_shouldProcessTiles = false;
         m_updateInProgress = false;
+        m_hasAllTiles = false;
 
         return true;
     }
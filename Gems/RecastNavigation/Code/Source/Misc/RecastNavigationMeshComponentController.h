@@ -126,5 +126,9 @@ namespace RecastNavigation
 
         //! If true, an update operation is in progress.
         AZStd::atomic<bool> m_updateInProgress{ false };
+
+        //! If true, the navigation mesh holds every tile of an async geometry collection, so async updates only need to
+        //! collect and replace the tiles that changed since.
+        bool m_hasAllTiles = false;
     };
 } // namespace RecastNavigation
@@ -8,9 +8,11 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/StaticRigidBody.h>
 #include <DebugDraw/DebugDrawBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Misc/RecastNavigationPhysXProviderComponentController.h>
@@ -78,6 +80,21 @@ namespace RecastNavigation
         m_shouldProcessTiles = true;
         m_updateInProgress = false;
         OnConfigurationChanged();
+
+        // Listen for changes to the static geometry, so that only the tiles around them need to be collected again.
+        if (auto sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+            if (sceneHandle != AzPhysics::InvalidSceneHandle)
+            {
+                sceneInterface->RegisterSimulationBodyAddedHandler(sceneHandle, m_bodyAddedHandler);
+                sceneInterface->RegisterSimulationBodyRemovedHandler(sceneHandle, m_bodyRemovedHandler);
+                sceneInterface->RegisterSimulationBodySimulationEnabledHandler(sceneHandle, m_bodySimulationEnabledHandler);
+                sceneInterface->RegisterSimulationBodySimulationDisabledHandler(sceneHandle, m_bodySimulationDisabledHandler);
+            }
+        }
+        AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusConnect();
+
         RecastNavigationProviderRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
     }
 
@@ -107,6 +124,21 @@ namespace RecastNavigation
         RecastNavigationProviderRequestBus::Handler::BusDisconnect();
         // The event is used to detect if tasks are already in progress.
         m_taskGraphEvent.reset();
+
+        AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
+        AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
+        m_bodyAddedHandler.Disconnect();
+        m_bodyRemovedHandler.Disconnect();
+        m_bodySimulationEnabledHandler.Disconnect();
+        m_bodySimulationDisabledHandler.Disconnect();
+        m_trackCollectedBodiesEvent.RemoveFromQueue();
+
+        m_trackedBodies.clear();
+        {
+            AZStd::lock_guard lock(m_dirtyRegionsMutex);
+            m_collectedBodies.clear();
+            m_dirtyRegions.clear();
+        }
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometry(
@@ -124,6 +156,14 @@ namespace RecastNavigation
         return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
     }
 
+    bool RecastNavigationPhysXProviderComponentController::CollectChangedGeometryAsync(
+        float tileSize,
+        float borderSize,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        return CollectChangedGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
+    }
+
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
     {
         AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
@@ -205,6 +245,10 @@ namespace RecastNavigation
         AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
         AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
 
+        // Remember the bodies that contributed geometry, so that the tiles around them are collected again when they move.
+        AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Aabb>> collectedBodies;
+        collectedBodies.reserve(overlapHits.size());
+
         for (const auto& overlapHit : overlapHits)
         {
             AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, overlapHit.m_bodyHandle);
@@ -213,6 +257,8 @@ namespace RecastNavigation
                 continue;
             }
 
+            collectedBodies.emplace_back(body->GetEntityId(), body->GetAabb());
+
             // Create an AABB for the Recast tile in local space and pass it in to GetGeometry so that large geometry sets
             // (like heightfields) can just return the subset of geometry that overlaps the AABB.
             auto pose = overlapHit.m_shape->GetLocalPose();
@@ -263,6 +309,12 @@ namespace RecastNavigation
                 indices.clear();
             }
         }
+
+        if (!collectedBodies.empty())
+        {
+            AZStd::lock_guard lock(m_dirtyRegionsMutex);
+            m_collectedBodies.insert(m_collectedBodies.end(), collectedBodies.begin(), collectedBodies.end());
+        }
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryImpl(
@@ -281,6 +333,9 @@ namespace RecastNavigation
             return {};
         }
 
+        // Every tile is collected, so the changes so far don't need to be collected again.
+        ClearDirtyRegions();
+
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
 
         const AZ::Vector3 extents = worldVolume.GetExtents();
@@ -327,6 +382,8 @@ namespace RecastNavigation
             }
         }
 
+        TrackCollectedBodies();
+
         m_updateInProgress = false;
         return tiles;
     }
@@ -359,6 +416,66 @@ namespace RecastNavigation
         float borderSize,
         const AZ::Aabb& worldVolume,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        const auto collectAllTiles = []([[maybe_unused]] const AZ::Aabb& scanVolume)
+        {
+            return true;
+        };
+
+        if (!ScheduleTileCollection(tileSize, borderSize, worldVolume, collectAllTiles, AZStd::move(tileCallback)))
+        {
+            return false;
+        }
+
+        // Every tile is being collected, so the changes so far don't need to be collected again.
+        ClearDirtyRegions();
+        return true;
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectChangedGeometryAsyncImpl(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& worldVolume,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        // Pick up the bodies of the last collection first, in case they were moved before their tracking event ran.
+        TrackCollectedBodies();
+
+        AZStd::vector<AZ::Aabb> dirtyRegions;
+        {
+            AZStd::lock_guard lock(m_dirtyRegionsMutex);
+            dirtyRegions.swap(m_dirtyRegions);
+        }
+
+        // A tile needs to be collected again if any change is within its scan volume, since the border geometry is part of the tile.
+        const auto collectChangedTiles = [&dirtyRegions](const AZ::Aabb& scanVolume)
+        {
+            return AZStd::any_of(dirtyRegions.begin(), dirtyRegions.end(), [&scanVolume](const AZ::Aabb& dirtyRegion)
+                {
+                    return dirtyRegion.GetMin().GetX() <= scanVolume.GetMax().GetX() &&
+                        dirtyRegion.GetMax().GetX() >= scanVolume.GetMin().GetX() &&
+                        dirtyRegion.GetMin().GetY() <= scanVolume.GetMax().GetY() &&
+                        dirtyRegion.GetMax().GetY() >= scanVolume.GetMin().GetY();
+                });
+        };
+
+        if (!ScheduleTileCollection(tileSize, borderSize, worldVolume, collectChangedTiles, AZStd::move(tileCallback)))
+        {
+            // Keep the changes for the next collection.
+            AZStd::lock_guard lock(m_dirtyRegionsMutex);
+            m_dirtyRegions.insert(m_dirtyRegions.end(), dirtyRegions.begin(), dirtyRegions.end());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::ScheduleTileCollection(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& worldVolume,
+        const AZStd::function<bool(const AZ::Aabb& scanVolume)>& shouldCollectTile,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -408,6 +525,11 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+                    if (!shouldCollectTile(scanVolume))
+                    {
+                        continue;
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -435,6 +557,8 @@ namespace RecastNavigation
             AZ::TaskToken finishToken = m_taskGraph.AddTask(
                 m_taskDescriptor, [this, tileCallback]()
                 {
+                    // Start tracking the bodies that were found from the main thread.
+                    m_trackCollectedBodiesEvent.Enqueue(AZ::TimeMs{ 0 });
                     tileCallback({}); // Notifies the caller that the operation is done.
                     m_updateInProgress = false;
                 });
@@ -449,6 +573,137 @@ namespace RecastNavigation
             return true;
         }
 
+        // The previous task graph is still finishing up, so let a later call try again.
+        m_updateInProgress = false;
         return false;
     }
+
+    void RecastNavigationPhysXProviderComponentController::AddDirtyRegion(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::lock_guard lock(m_dirtyRegionsMutex);
+
+        // Grow an overlapping region instead of adding another one, so that an area that keeps changing doesn't grow the list.
+        for (AZ::Aabb& dirtyRegion : m_dirtyRegions)
+        {
+            if (dirtyRegion.Overlaps(region))
+            {
+                dirtyRegion.AddAabb(region);
+                return;
+            }
+        }
+
+        m_dirtyRegions.push_back(region);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::ClearDirtyRegions()
+    {
+        AZStd::lock_guard lock(m_dirtyRegionsMutex);
+        m_dirtyRegions.clear();
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnTerrainDataChanged(
+        const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask dataChangedMask)
+    {
+        using TerrainDataChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+
+        // Only the terrain heights end up in the collected geometry, through the terrain heightfield collider.
+        if ((dataChangedMask & (TerrainDataChangedMask::HeightData | TerrainDataChangedMask::Settings)) != TerrainDataChangedMask::None)
+        {
+            // A null region means that the entire terrain changed.
+            AddDirtyRegion(dirtyRegion.IsValid() ? dirtyRegion : GetWorldBounds());
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnTransformChanged(
+        [[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
+    {
+        const AZ::EntityId* entityId = AZ::TransformNotificationBus::GetCurrentBusId();
+        if (!entityId)
+        {
+            return;
+        }
+
+        auto trackedBody = m_trackedBodies.find(*entityId);
+        if (trackedBody == m_trackedBodies.end())
+        {
+            return;
+        }
+
+        // The geometry is gone from where the body was, and is now wherever the same move takes its bounds.
+        TrackedBody& body = trackedBody->second;
+        AddDirtyRegion(body.m_bounds);
+        if (body.m_bounds.IsValid())
+        {
+            body.m_bounds = body.m_bounds.GetTransformedAabb(world * body.m_worldTransform.GetInverse());
+        }
+        body.m_worldTransform = world;
+        AddDirtyRegion(body.m_bounds);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyChanged(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle, bool bodyAdded)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SimulatedBody* body = sceneInterface ? sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle) : nullptr;
+
+        // Only static bodies are collected into the navigation mesh.
+        if (!body || !azrtti_istypeof<AzPhysics::StaticRigidBody>(body))
+        {
+            return;
+        }
+
+        const AZ::Aabb bounds = body->GetAabb();
+        AddDirtyRegion(bounds);
+
+        if (bodyAdded)
+        {
+            TrackBody(body->GetEntityId(), bounds);
+        }
+        else
+        {
+            UntrackBody(body->GetEntityId());
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::TrackBody(AZ::EntityId entityId, const AZ::Aabb& bounds)
+    {
+        if (!entityId.IsValid())
+        {
+            return;
+        }
+
+        TrackedBody& trackedBody = m_trackedBodies[entityId];
+        trackedBody.m_bounds = bounds;
+        trackedBody.m_worldTransform = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(trackedBody.m_worldTransform, entityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        AZ::TransformNotificationBus::MultiHandler::BusConnect(entityId);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::UntrackBody(AZ::EntityId entityId)
+    {
+        if (m_trackedBodies.erase(entityId) > 0)
+        {
+            AZ::TransformNotificationBus::MultiHandler::BusDisconnect(entityId);
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::TrackCollectedBodies()
+    {
+        AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Aabb>> collectedBodies;
+        {
+            AZStd::lock_guard lock(m_dirtyRegionsMutex);
+            collectedBodies.swap(m_collectedBodies);
+        }
+
+        for (const auto& [entityId, bounds] : collectedBodies)
+        {
+            TrackBody(entityId, bounds);
+        }
+    }
 } // namespace RecastNavigation
@@ -9,9 +9,15 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationPhysXProviderConfig.h>
 #include <RecastNavigation/RecastNavigationProviderBus.h>
@@ -20,8 +26,12 @@ namespace RecastNavigation
 {
     //! Common logic for Recast navigation tiled collector components. Recommended use is as a base class.
     //! The method provided are not thread-safe. Synchronize as necessary at the higher level.
+    //! Regions where static PhysX geometry or terrain heights changed are tracked between collections, so that
+    //! @CollectChangedGeometryAsync only collects the tiles that overlap them.
     class RecastNavigationPhysXProviderComponentController
         : public RecastNavigationProviderRequestBus::Handler
+        , public AzFramework::Terrain::TerrainDataNotificationBus::Handler
+        , public AZ::TransformNotificationBus::MultiHandler
     {
         friend class EditorRecastNavigationPhysXProviderComponent;
     public:
@@ -47,6 +57,7 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        bool CollectChangedGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
@@ -85,6 +96,24 @@ namespace RecastNavigation
             const AZ::Aabb& worldVolume,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
 
+        //! Variant of @CollectGeometryAsyncImpl that only collects the tiles whose scan volume overlaps a region that changed
+        //! since the last collection. The tiles are laid out the same way, so they can replace the tiles of a previous collection.
+        //! If nothing changed, only the final empty callback is made.
+        //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
+        //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together
+        //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
+        //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
+        //! @returns true if an async operation was scheduled, false otherwise
+        bool CollectChangedGeometryAsyncImpl(
+            float tileSize,
+            float borderSize,
+            const AZ::Aabb& worldVolume,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+
+        //! Marks a region whose geometry changed, so that the next @CollectChangedGeometryAsync collects the tiles overlapping it.
+        //! @param region the changed volume, invalid regions are ignored
+        void AddDirtyRegion(const AZ::Aabb& region);
+
         //! Finds all the static PhysX colliders within a given volume.
         //! @param volume the world to look for static colliders
         //! @param overlapHits (out) found colliders will be attached to this container
@@ -101,6 +130,38 @@ namespace RecastNavigation
     protected:
         void OnConfigurationChanged();
 
+        //! TerrainDataNotificationBus overrides ...
+        //! @{
+        void OnTerrainDataChanged(
+            const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask dataChangedMask) override;
+        //! @}
+
+        //! TransformNotificationBus overrides ...
+        //! @{
+        void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
+        //! @}
+
+        //! Marks the bounds of a static body dirty when it's added to or removed from the scene, or its simulation is toggled.
+        void OnSimulatedBodyChanged(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle, bool bodyAdded);
+
+        //! Starts marking the old and new bounds of the body on the entity dirty whenever the entity moves.
+        void TrackBody(AZ::EntityId entityId, const AZ::Aabb& bounds);
+        void UntrackBody(AZ::EntityId entityId);
+
+        //! Tracks the bodies that were found by geometry collection. Must be called on the main thread.
+        void TrackCollectedBodies();
+
+        void ClearDirtyRegions();
+
+        //! Schedules a task for each tile of the grid over @worldVolume that @shouldCollectTile accepts.
+        //! @param shouldCollectTile is called with the scan volume of each tile while scheduling
+        bool ScheduleTileCollection(
+            float tileSize,
+            float borderSize,
+            const AZ::Aabb& worldVolume,
+            const AZStd::function<bool(const AZ::Aabb& scanVolume)>& shouldCollectTile,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+
         AZ::EntityComponentIdPair m_entityComponentIdPair;
         RecastNavigationPhysXProviderConfig m_config;
 
@@ -117,5 +178,49 @@ namespace RecastNavigation
         AZ::TaskExecutor m_taskExecutor;
         AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
         AZ::TaskDescriptor m_taskDescriptor{ "Collect Geometry", "Recast Navigation" };
+
+        //! Regions where the geometry changed since the last collection.
+        AZStd::vector<AZ::Aabb> m_dirtyRegions;
+
+        //! Entities and bounds of the static bodies found by geometry collection, which runs on task threads.
+        //! They are moved into @m_trackedBodies on the main thread.
+        AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Aabb>> m_collectedBodies;
+        AZStd::mutex m_dirtyRegionsMutex;
+
+        struct TrackedBody
+        {
+            AZ::Transform m_worldTransform = AZ::Transform::CreateIdentity();
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        };
+
+        //! Static bodies whose geometry might be in a navigation mesh, keyed by entity, with their last known placement.
+        AZStd::unordered_map<AZ::EntityId, TrackedBody> m_trackedBodies;
+
+        //! Tick event to track the bodies found by an async collection from the main thread.
+        AZ::ScheduledEvent m_trackCollectedBodiesEvent{ [this]() { TrackCollectedBodies(); }, AZ::Name("RecastNavigationTrackCollectedBodies") };
+
+        //! Scene events that add or remove static geometry.
+        //! @{
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_bodyAddedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle, true);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_bodyRemovedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle, false);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodySimulationEnabled::Handler m_bodySimulationEnabledHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle, true);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodySimulationDisabled::Handler m_bodySimulationDisabledHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle, false);
+            } };
+        //! @}
     };
 } // namespace RecastNavigation
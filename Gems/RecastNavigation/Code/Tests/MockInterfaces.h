@@ -14,6 +14,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/SimulatedBodies/StaticRigidBody.h>
 #include <AzTest/AzTest.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
@@ -155,4 +156,22 @@ namespace RecastNavigationTests
         MOCK_METHOD0(GetWorldTM, const AZ::Transform& ());
         MOCK_METHOD0(IsStaticTransform, bool());
     };
+
+    class MockStaticRigidBody : public AzPhysics::StaticRigidBody
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MockStaticRigidBody, AZ::SystemAllocator);
+        AZ_RTTI(MockStaticRigidBody, "{6F0C5E1B-2A47-4D8E-9B3C-71D4A2E5F816}", AzPhysics::StaticRigidBody);
+
+        MOCK_METHOD1(AddShape, void(AZStd::shared_ptr<Physics::Shape>));
+        MOCK_CONST_METHOD0(GetAabb, AZ::Aabb());
+        MOCK_CONST_METHOD0(GetEntityId, AZ::EntityId());
+        MOCK_CONST_METHOD0(GetNativePointer, void*());
+        MOCK_CONST_METHOD0(GetNativeType, AZ::Crc32());
+        MOCK_CONST_METHOD0(GetOrientation, AZ::Quaternion());
+        MOCK_CONST_METHOD0(GetPosition, AZ::Vector3());
+        MOCK_CONST_METHOD0(GetTransform, AZ::Transform());
+        MOCK_METHOD1(RayCast, AzPhysics::SceneQueryHit(const AzPhysics::RayCastRequest&));
+        MOCK_METHOD1(SetTransform, void(const AZ::Transform&));
+    };
 }
@@ -13,17 +13,22 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <Components/DetourNavigationComponent.h>
 #include <Components/RecastNavigationMeshComponent.h>
 #include <Components/RecastNavigationPhysXProviderComponent.h>
+#include <Misc/RecastNavigationPhysXProviderComponentController.h>
 #include <PhysX/MockPhysicsShape.h>
 #include <PhysX/MockSceneInterface.h>
 #include <PhysX/MockSimulatedBody.h>
+#include <RecastNavigation/RecastNavigationProviderBus.h>
 
 namespace RecastNavigationTests
 {
@@ -658,6 +663,290 @@ namespace RecastNavigationTests
         EXPECT_EQ(strcmp(test.TYPEINFO_Name(), "RecastNavigationPhysXProviderComponentController"), 0);
     }
 
+    //! PhysX provider that exposes which tiles a collection went through and which bodies it tracks.
+    class TestPhysXProviderController
+        : public RecastNavigation::RecastNavigationPhysXProviderComponentController
+    {
+    public:
+        using TileCoordinates = AZStd::pair<int, int>;
+
+        //! Collects tiles of size 5 without a border and returns their sorted coordinates once the collection is done.
+        AZStd::vector<TileCoordinates> CollectTiles(bool changedTilesOnly)
+        {
+            AZStd::vector<TileCoordinates> tiles;
+            AZStd::mutex tilesMutex;
+            const auto tileCallback = [&tiles, &tilesMutex](AZStd::shared_ptr<RecastNavigation::TileGeometry> tile)
+            {
+                if (tile)
+                {
+                    AZStd::lock_guard lock(tilesMutex);
+                    tiles.emplace_back(tile->m_tileX, tile->m_tileY);
+                }
+            };
+
+            const bool scheduled = changedTilesOnly
+                ? CollectChangedGeometryAsync(5.f, 0.f, tileCallback)
+                : CollectGeometryAsync(5.f, 0.f, tileCallback);
+            EXPECT_TRUE(scheduled);
+            if (scheduled)
+            {
+                // The graph event is signaled after the final task, so the next collection can always be scheduled.
+                m_taskGraphEvent->Wait();
+            }
+
+            AZStd::sort(tiles.begin(), tiles.end());
+            return tiles;
+        }
+
+        bool IsTrackingCollectedBodies() const
+        {
+            return m_trackCollectedBodiesEvent.IsScheduled();
+        }
+
+        bool IsTracked(AZ::EntityId entityId) const
+        {
+            return m_trackedBodies.find(entityId) != m_trackedBodies.end();
+        }
+    };
+
+    //! Drives the change tracking of the PhysX provider with terrain notifications, scene events and a static body.
+    //! The world bounds of the mock shape are 20x20, which makes 4x4 tiles of size 5 without a border.
+    class NavigationProviderChangeTest
+        : public NavigationTest
+    {
+    public:
+        using TileCoordinates = TestPhysXProviderController::TileCoordinates;
+
+        inline static const AzPhysics::SimulatedBodyHandle BodyHandle{ AZ::Crc32("StaticBody"), 1 };
+        inline static const AZ::EntityId BodyEntityId{ 2 };
+
+        void SetUp() override
+        {
+            NavigationTest::SetUp();
+
+            m_entity = AZStd::make_unique<Entity>();
+            m_entity->SetId(AZ::EntityId{ 1 });
+            m_entity->CreateComponent<AZ::EventSchedulerSystemComponent>();
+            m_entity->CreateComponent<MockShapeComponent>();
+            ActivateEntity(*m_entity);
+            SetupNavigationMesh();
+
+            // Only report the static body from the scene while it's in the simulation.
+            ON_CALL(*m_mockSceneInterface, QueryScene(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, const AzPhysics::SceneQueryRequest* request)
+                {
+                    if (m_bodyInScene)
+                    {
+                        AzPhysics::SceneQueryHit hit = *m_hit;
+                        hit.m_bodyHandle = BodyHandle;
+                        static_cast<const AzPhysics::OverlapRequest*>(request)->m_unboundedOverlapHitCallback({ hit });
+                    }
+                    return AzPhysics::SceneQueryHits();
+                }));
+            ON_CALL(*m_mockSceneInterface, GetSimulatedBodyFromHandle(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) -> AzPhysics::SimulatedBody*
+                {
+                    if (bodyHandle == BodyHandle)
+                    {
+                        return m_staticBody.get();
+                    }
+                    return m_mockSimulatedBody.get();
+                }));
+
+            // Hand the scene event handlers of the provider to events that the tests signal.
+            ON_CALL(*m_mockSceneInterface, GetSceneHandle(_)).WillByDefault(Return(m_sceneHandle));
+            ON_CALL(*m_mockSceneInterface, RegisterSimulationBodyAddedHandler(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler& handler)
+                {
+                    handler.Connect(m_bodyAddedEvent);
+                }));
+            ON_CALL(*m_mockSceneInterface, RegisterSimulationBodyRemovedHandler(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler& handler)
+                {
+                    handler.Connect(m_bodyRemovedEvent);
+                }));
+            ON_CALL(*m_mockSceneInterface, RegisterSimulationBodySimulationEnabledHandler(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodySimulationEnabled::Handler& handler)
+                {
+                    handler.Connect(m_bodySimulationEnabledEvent);
+                }));
+            ON_CALL(*m_mockSceneInterface, RegisterSimulationBodySimulationDisabledHandler(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodySimulationDisabled::Handler& handler)
+                {
+                    handler.Connect(m_bodySimulationDisabledEvent);
+                }));
+
+            // A small static body inside tile (0, 0), whose entity reports its world transform.
+            m_staticBody = AZStd::make_unique<NiceMock<MockStaticRigidBody>>();
+            ON_CALL(*m_staticBody, GetEntityId()).WillByDefault(Return(BodyEntityId));
+            ON_CALL(*m_staticBody, GetAabb()).WillByDefault(Invoke([this]()
+                {
+                    return m_bodyBounds;
+                }));
+            ON_CALL(*m_staticBody, GetOrientation()).WillByDefault(Return(AZ::Quaternion::CreateIdentity()));
+            ON_CALL(*m_staticBody, GetPosition()).WillByDefault(Return(AZ::Vector3::CreateZero()));
+
+            m_bodyTransforms = AZStd::make_unique<NiceMock<MockTransforms>>(AZStd::vector<AZ::EntityId>{ BodyEntityId });
+            ON_CALL(*m_bodyTransforms, GetWorldTM()).WillByDefault(testing::ReturnRef(m_bodyTransform));
+
+            m_provider = AZStd::make_unique<TestPhysXProviderController>();
+            m_provider->Activate(AZ::EntityComponentIdPair(m_entity->GetId(), AZ::ComponentId{ 1 }));
+        }
+
+        void TearDown() override
+        {
+            m_provider->Deactivate();
+            m_provider = {};
+            m_bodyTransforms = {};
+            m_staticBody = {};
+            m_entity = {};
+
+            NavigationTest::TearDown();
+        }
+
+        //! Moves the static body and its entity so that its bounds are offset by @translation from where they started.
+        void MoveBody(const AZ::Vector3& translation)
+        {
+            m_bodyTransform = AZ::Transform::CreateTranslation(translation);
+            m_bodyBounds = StartBounds.GetTranslated(translation);
+            AZ::TransformNotificationBus::Event(
+                BodyEntityId, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_bodyTransform, m_bodyTransform);
+        }
+
+        AZStd::vector<TileCoordinates> CollectAllTiles()
+        {
+            return m_provider->CollectTiles(false);
+        }
+
+        AZStd::vector<TileCoordinates> CollectChangedTiles()
+        {
+            return m_provider->CollectTiles(true);
+        }
+
+        inline static const AZ::Aabb StartBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-9.f, -9.f, 0.f), AZ::Vector3(-8.f, -8.f, 1.f));
+
+        unique_ptr<Entity> m_entity;
+        unique_ptr<TestPhysXProviderController> m_provider;
+        unique_ptr<MockStaticRigidBody> m_staticBody;
+        unique_ptr<MockTransforms> m_bodyTransforms;
+        AZ::Transform m_bodyTransform = AZ::Transform::CreateIdentity();
+        AZ::Aabb m_bodyBounds = StartBounds;
+        bool m_bodyInScene = false;
+
+        AzPhysics::SceneHandle m_sceneHandle{ AZ::Crc32("TestScene"), 0 };
+        AzPhysics::SceneEvents::OnSimulationBodyAdded m_bodyAddedEvent;
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved m_bodyRemovedEvent;
+        AzPhysics::SceneEvents::OnSimulationBodySimulationEnabled m_bodySimulationEnabledEvent;
+        AzPhysics::SceneEvents::OnSimulationBodySimulationDisabled m_bodySimulationDisabledEvent;
+    };
+
+    TEST_F(NavigationProviderChangeTest, CollectChangedGeometryOnlyCollectsTilesOverlappingTerrainChanges)
+    {
+        using TerrainDataChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+
+        EXPECT_EQ(CollectAllTiles().size(), 16u);
+
+        // Nothing changed since the full collection.
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        // A height change in a corner of the world only touches the corner tile.
+        AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged,
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-9.5f, -9.5f, 0.f), AZ::Vector3(-9.f, -9.f, 1.f)), TerrainDataChangedMask::HeightData);
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 0 } }));
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        // Color changes don't affect the navigation mesh, and a null region means the entire terrain changed.
+        AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged,
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-9.5f, -9.5f, 0.f), AZ::Vector3(-9.f, -9.f, 1.f)), TerrainDataChangedMask::ColorData);
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged, AZ::Aabb::CreateNull(), TerrainDataChangedMask::HeightData);
+        EXPECT_EQ(CollectChangedTiles().size(), 16u);
+    }
+
+    TEST_F(NavigationProviderChangeTest, CollectChangedGeometryFollowsStaticBodiesAddedToAndRemovedFromTheScene)
+    {
+        EXPECT_EQ(CollectAllTiles().size(), 16u);
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        // Adding the body only touches the tile it lands in.
+        m_bodyInScene = true;
+        m_bodyAddedEvent.Signal(m_sceneHandle, BodyHandle);
+        EXPECT_TRUE(m_provider->IsTracked(BodyEntityId));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 0 } }));
+
+        // Moving the tracked body touches the tile it left and the tile it moved into.
+        MoveBody(AZ::Vector3(10.f, 0.f, 0.f));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 0 }, { 2, 0 } }));
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        // Once removed, the body no longer marks any tile when its entity moves.
+        m_bodyInScene = false;
+        m_bodyRemovedEvent.Signal(m_sceneHandle, BodyHandle);
+        EXPECT_FALSE(m_provider->IsTracked(BodyEntityId));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 2, 0 } }));
+
+        MoveBody(AZ::Vector3(10.f, 10.f, 0.f));
+        EXPECT_TRUE(CollectChangedTiles().empty());
+    }
+
+    TEST_F(NavigationProviderChangeTest, CollectChangedGeometryFollowsStaticBodySimulationToggles)
+    {
+        m_bodyInScene = true;
+        m_bodyAddedEvent.Signal(m_sceneHandle, BodyHandle);
+        EXPECT_EQ(CollectAllTiles().size(), 16u);
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        m_bodyInScene = false;
+        m_bodySimulationDisabledEvent.Signal(m_sceneHandle, BodyHandle);
+        EXPECT_FALSE(m_provider->IsTracked(BodyEntityId));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 0 } }));
+
+        MoveBody(AZ::Vector3(0.f, 10.f, 0.f));
+        EXPECT_TRUE(CollectChangedTiles().empty());
+
+        // Enabling the simulation again picks up the body where it is now.
+        m_bodyInScene = true;
+        m_bodySimulationEnabledEvent.Signal(m_sceneHandle, BodyHandle);
+        EXPECT_TRUE(m_provider->IsTracked(BodyEntityId));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 2 } }));
+
+        MoveBody(AZ::Vector3(10.f, 10.f, 0.f));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 2 }, { 2, 2 } }));
+    }
+
+    TEST_F(NavigationProviderChangeTest, CollectChangedGeometryIgnoresBodiesThatAreNotStatic)
+    {
+        EXPECT_EQ(CollectAllTiles().size(), 16u);
+
+        ON_CALL(*m_mockSimulatedBody, GetEntityId()).WillByDefault(Return(BodyEntityId));
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(StartBounds));
+        m_bodyAddedEvent.Signal(m_sceneHandle, AzPhysics::SimulatedBodyHandle{ AZ::Crc32("DynamicBody"), 2 });
+        EXPECT_FALSE(m_provider->IsTracked(BodyEntityId));
+        EXPECT_TRUE(CollectChangedTiles().empty());
+    }
+
+    TEST_F(NavigationProviderChangeTest, CollectGeometryTracksCollectedBodiesOnTheNextTick)
+    {
+        // The body was in the scene before the provider was activated, so only a collection can find it.
+        m_bodyInScene = true;
+        EXPECT_EQ(CollectAllTiles().size(), 16u);
+        EXPECT_TRUE(m_provider->IsTrackingCollectedBodies());
+        EXPECT_FALSE(m_provider->IsTracked(BodyEntityId));
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+        EXPECT_FALSE(m_provider->IsTrackingCollectedBodies());
+        EXPECT_TRUE(m_provider->IsTracked(BodyEntityId));
+
+        // Moving the collected body only re-collects the tiles it overlapped and now overlaps.
+        MoveBody(AZ::Vector3(5.f, 5.f, 0.f));
+        EXPECT_EQ(CollectChangedTiles(), AZStd::vector<TileCoordinates>({ { 0, 0 }, { 1, 1 } }));
+        EXPECT_TRUE(CollectChangedTiles().empty());
+    }
+
     TEST_F(NavigationTest, DISABLED_AsyncOnNavigationMeshUpdatedIsCalled)
     {
         Entity e;
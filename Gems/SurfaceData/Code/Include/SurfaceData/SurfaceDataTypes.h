@@ -25,6 +25,28 @@ namespace SurfaceData
     using SurfaceTagVector = AZStd::vector<SurfaceTag>;
     using SurfaceTagSet = AZStd::unordered_set<SurfaceTag>;
 
+    //! Bitset of surface tags, used to reject tag searches without comparing the lists of tags.
+    //! Each tag sets the bit selected by the low bits of its CRC, so different tags can share a bit. A set bit only means that
+    //! one of the tags with that bit might be present.
+    using SurfaceTagMask = AZ::u64;
+
+    //! Get the bit for the given surface tag in a SurfaceTagMask.
+    inline SurfaceTagMask GetSurfaceTagMask(AZ::Crc32 tag)
+    {
+        return SurfaceTagMask(1) << (static_cast<AZ::u32>(tag) & 63);
+    }
+
+    //! Get the SurfaceTagMask containing the bits of all the given surface tags.
+    inline SurfaceTagMask GetSurfaceTagMask(AZStd::span<const SurfaceTag> tags)
+    {
+        SurfaceTagMask mask = 0;
+        for (const auto& tag : tags)
+        {
+            mask |= GetSurfaceTagMask(tag);
+        }
+        return mask;
+    }
+
     //! SurfaceTagWeights stores a collection of surface tags and weights.
     //! A surface tag can only appear once in the collection. Attempting to add it multiple times will always preserve the
     //! highest weight value.
@@ -65,6 +87,7 @@ namespace SurfaceData
                     {
                         // We didn't find the surface type, so add the new entry in sorted order.
                         m_weights.insert(weightItr, { tag, weight });
+                        m_tagMask |= GetSurfaceTagMask(tag);
                     }
                     else
                     {
@@ -84,6 +107,7 @@ namespace SurfaceData
             if (m_weights.size() != AzFramework::SurfaceData::Constants::MaxSurfaceWeights)
             {
                 m_weights.emplace_back(tag, weight);
+                m_tagMask |= GetSurfaceTagMask(tag);
             }
             else
             {
@@ -185,6 +209,9 @@ namespace SurfaceData
         const AzFramework::SurfaceData::SurfaceTagWeight* FindTag(AZ::Crc32 tag) const;
 
         AZStd::fixed_vector<AzFramework::SurfaceData::SurfaceTagWeight, AzFramework::SurfaceData::Constants::MaxSurfaceWeights> m_weights;
+
+        //! The bits of every tag in m_weights, so that searches for tags that aren't present can usually skip the list entirely.
+        SurfaceTagMask m_tagMask = 0;
     };
 
 
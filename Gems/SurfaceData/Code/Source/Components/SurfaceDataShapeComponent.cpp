@@ -12,6 +12,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <SurfaceData/MixedStackHeapAllocator.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <SurfaceDataProfiler.h>
@@ -208,6 +209,11 @@ namespace SurfaceData
                 entityId,
                 [entityId, this, positions, creatorEntityIds, &weights](LmbrCentral::ShapeComponentRequestsBus::Events* shape)
                 {
+                    // Check all the points against the shape in one call, so that the shape only locks and updates its cached data once.
+                    constexpr size_t SmallQuerySize = 16;
+                    AZStd::vector<bool, SurfaceData::mixed_stack_heap_allocator<bool, SmallQuerySize>> isInside(positions.size(), false);
+                    shape->IsPointInsideBatch(positions, isInside);
+
                     for (size_t index = 0; index < positions.size(); index++)
                     {
                         // Don't bother modifying points that this component created.
@@ -216,7 +222,7 @@ namespace SurfaceData
                             continue;
                         }
 
-                        if (m_shapeBounds.Contains(positions[index]) && shape->IsPointInside(positions[index]))
+                        if (isInside[index])
                         {
                             // If the point is inside our shape, add all our modifier tags with a weight of 1.0f.
                             weights[index].AddSurfaceTagWeights(m_configuration.m_modifierTags, 1.0f);
@@ -13,6 +13,7 @@ namespace SurfaceData
     void SurfaceTagWeights::AssignSurfaceTagWeights(const AzFramework::SurfaceData::SurfaceTagWeightList& weights)
     {
         m_weights.clear();
+        m_tagMask = 0;
         for (auto& weight : weights)
         {
             AddSurfaceTagWeight(weight.m_surfaceType, weight.m_weight);
@@ -22,6 +23,7 @@ namespace SurfaceData
     void SurfaceTagWeights::AssignSurfaceTagWeights(const SurfaceTagVector& tags, float weight)
     {
         m_weights.clear();
+        m_tagMask = 0;
         for (auto& tag : tags)
         {
             AddSurfaceTagWeight(tag.operator AZ::Crc32(), weight);
@@ -31,6 +33,7 @@ namespace SurfaceData
     void SurfaceTagWeights::Clear()
     {
         m_weights.clear();
+        m_tagMask = 0;
     }
 
     size_t SurfaceTagWeights::GetSize() const
@@ -119,6 +122,12 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const
     {
+        // None of the sample tags can be present if they don't share any bits with the stored tags.
+        if ((GetSurfaceTagMask(sampleTags) & m_tagMask) == 0)
+        {
+            return false;
+        }
+
         for (const auto& sampleTag : sampleTags)
         {
             if (HasMatchingTag(sampleTag))
@@ -138,6 +147,11 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, float weightMin, float weightMax) const
     {
+        if ((GetSurfaceTagMask(sampleTags) & m_tagMask) == 0)
+        {
+            return false;
+        }
+
         for (const auto& sampleTag : sampleTags)
         {
             if (HasMatchingTag(sampleTag, weightMin, weightMax))
@@ -151,6 +165,12 @@ namespace SurfaceData
 
     const AzFramework::SurfaceData::SurfaceTagWeight* SurfaceTagWeights::FindTag(AZ::Crc32 tag) const
     {
+        // If the bit for this tag isn't set, the tag can't be in the list.
+        if ((GetSurfaceTagMask(tag) & m_tagMask) == 0)
+        {
+            return m_weights.end();
+        }
+
         for (auto weightItr = m_weights.begin(); weightItr != m_weights.end(); ++weightItr)
         {
             if (weightItr->m_surfaceType == tag)
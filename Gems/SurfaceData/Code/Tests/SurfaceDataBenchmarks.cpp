@@ -21,6 +21,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/CylinderShapeComponentBus.h>
+#include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataSystemComponent.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
 
@@ -265,6 +266,74 @@ namespace UnitTest
         ->Arg( 2048 )
         ->Unit(::benchmark::kMillisecond);
 
+    // Compares querying a shape one point at a time against a single batch query for the same list of points.
+    // Both use the cylinder from the benchmark world, since its per-point distance math is the most expensive of the shapes.
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_CylinderDistanceSquaredFromPoint)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const float worldSize = aznumeric_cast<float>(state.range(0));
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateBenchmarkEntities(worldSize);
+        const AZ::EntityId cylinderId = benchmarkEntities[1]->GetId();
+
+        AZStd::vector<AZ::Vector3> queryPositions;
+        for (float y = 0.0f; y < worldSize; y += 1.0f)
+        {
+            for (float x = 0.0f; x < worldSize; x += 1.0f)
+            {
+                queryPositions.emplace_back(x, y, 0.0f);
+            }
+        }
+        AZStd::vector<float> distancesSquared(queryPositions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < queryPositions.size(); ++index)
+            {
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(distancesSquared[index], cylinderId,
+                    &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPoint, queryPositions[index]);
+            }
+            benchmark::DoNotOptimize(distancesSquared.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_CylinderDistanceSquaredFromPointBatch)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const float worldSize = aznumeric_cast<float>(state.range(0));
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateBenchmarkEntities(worldSize);
+        const AZ::EntityId cylinderId = benchmarkEntities[1]->GetId();
+
+        AZStd::vector<AZ::Vector3> queryPositions;
+        for (float y = 0.0f; y < worldSize; y += 1.0f)
+        {
+            for (float x = 0.0f; x < worldSize; x += 1.0f)
+            {
+                queryPositions.emplace_back(x, y, 0.0f);
+            }
+        }
+        AZStd::vector<float> distancesSquared(queryPositions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(cylinderId,
+                &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPointBatch,
+                AZStd::span<const AZ::Vector3>(queryPositions), AZStd::span<float>(distancesSquared));
+            benchmark::DoNotOptimize(distancesSquared.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_CylinderDistanceSquaredFromPoint)
+        ->Arg( 256 )
+        ->Arg( 1024 )
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_CylinderDistanceSquaredFromPointBatch)
+        ->Arg( 256 )
+        ->Arg( 1024 )
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_AddSurfaceTagWeight)(benchmark::State& state)
     {
         AZ_PROFILE_FUNCTION(Entity);
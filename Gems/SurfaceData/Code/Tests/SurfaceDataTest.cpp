@@ -1042,5 +1042,40 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_SurfaceTagWeightsMatchTagsThatShareMaskBits)
+{
+    // Create tags that all map to the same bit in the SurfaceTagMask, so that the mask alone can't tell them apart.
+    const AZ::Crc32 storedTag(0x12345600);
+    const AZ::Crc32 collidingTag(0x65432100);
+    const AZ::Crc32 otherTag(0x12345601);
+    ASSERT_EQ(SurfaceData::GetSurfaceTagMask(storedTag), SurfaceData::GetSurfaceTagMask(collidingTag));
+    ASSERT_NE(SurfaceData::GetSurfaceTagMask(storedTag), SurfaceData::GetSurfaceTagMask(otherTag));
+
+    SurfaceData::SurfaceTagWeights weights;
+    weights.AddSurfaceTagWeight(storedTag, 0.5f);
+
+    // TEST: Verify that only the stored tag matches, even though the colliding tag shares its bit.
+    EXPECT_TRUE(weights.HasMatchingTag(storedTag));
+    EXPECT_FALSE(weights.HasMatchingTag(collidingTag));
+    EXPECT_FALSE(weights.HasMatchingTag(otherTag));
+
+    AZStd::array<SurfaceData::SurfaceTag, 2> sampleTags = { SurfaceData::SurfaceTag(collidingTag), SurfaceData::SurfaceTag(otherTag) };
+    EXPECT_FALSE(weights.HasAnyMatchingTags(sampleTags));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(sampleTags, 0.0f, 1.0f));
+
+    sampleTags[1] = SurfaceData::SurfaceTag(storedTag);
+    EXPECT_TRUE(weights.HasAnyMatchingTags(sampleTags));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(sampleTags, 0.0f, 1.0f));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(sampleTags, 0.75f, 1.0f));
+
+    // TEST: Verify that clearing and reassigning the weights doesn't leave any stale tags behind.
+    weights.Clear();
+    EXPECT_FALSE(weights.HasAnyMatchingTags(sampleTags));
+
+    weights.AssignSurfaceTagWeights({ SurfaceData::SurfaceTag(otherTag) }, 1.0f);
+    EXPECT_FALSE(weights.HasMatchingTag(storedTag));
+    EXPECT_TRUE(weights.HasMatchingTag(otherTag));
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
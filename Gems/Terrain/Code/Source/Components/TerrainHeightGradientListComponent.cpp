@@ -131,6 +131,11 @@ namespace Terrain
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
 
+        {
+            AZStd::unique_lock lock(m_queryMutex);
+            m_gradientPrograms.clear();
+        }
+
         // Since this height data will no longer exist, notify the terrain system to refresh the area.
         TerrainSystemServiceRequestBus::Broadcast(
             &TerrainSystemServiceRequestBus::Events::RefreshArea, GetEntityId(),
@@ -207,6 +212,12 @@ namespace Terrain
     {
         TERRAIN_PROFILE_FUNCTION_VERBOSE
 
+        // A reentrant query already holds the queryMutex lock on this thread, so it can't compile the programs.
+        if (!Terrain::TerrainAreaHeightRequestBus::HasReentrantEBusUseThisThread())
+        {
+            UpdateGradientPrograms();
+        }
+
         // Make sure we don't run queries simultaneously with changing any of the cached data.
         AZStd::shared_lock lock(m_queryMutex);
 
@@ -234,21 +245,17 @@ namespace Terrain
             // value of 0 outside their data bounds if they're using bounded data.  We should examine the possibility of extending the
             // gradient API to provide actual bounds so that it's possible to detect if the gradient even 'exists' in an area, at which
             // point we could just make this list a prioritized list from top to bottom for any points that overlap.
-            for (auto& gradientId : m_configuration.m_gradientEntities)
+            for (const auto& gradientProgram : m_gradientPrograms)
             {
-                if (gradientId.IsValid())
-                {
-                    GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                gradientProgram.GetValues(inOutPositionList, curGradientSamples);
 
-                    for (size_t index = 0; index < maxValueSamples.size(); index++)
-                    {
-                        maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
+                for (size_t index = 0; index < maxValueSamples.size(); index++)
+                {
+                    maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
 
-                        // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
-                        // terrain to *not* exist at a specific point.
-                        terrainExistsList[index] = true;
-                    }
+                    // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
+                    // terrain to *not* exist at a specific point.
+                    terrainExistsList[index] = true;
                 }
             }
 
@@ -264,6 +271,34 @@ namespace Terrain
         }
     }
 
+    void TerrainHeightGradientListComponent::UpdateGradientPrograms()
+    {
+        AZ::u32 compositionChangeCount = 0;
+        {
+            AZStd::shared_lock lock(m_queryMutex);
+            if (m_gradientProgramsChangeCount == m_compositionChangeCount)
+            {
+                return;
+            }
+            compositionChangeCount = m_compositionChangeCount;
+        }
+
+        // Compile the gradients into programs so that bulk height queries don't need to go through the EBus for every gradient in
+        // each chain. This runs outside of the queryMutex lock because compiling queries the gradients through the EBus.
+        AZStd::vector<GradientSignal::GradientProgram> gradientPrograms;
+        for (auto& gradientId : m_configuration.m_gradientEntities)
+        {
+            if (gradientId.IsValid())
+            {
+                gradientPrograms.emplace_back(GradientSignal::GradientProgram::Compile(gradientId));
+            }
+        }
+
+        AZStd::unique_lock lock(m_queryMutex);
+        m_gradientPrograms = AZStd::move(gradientPrograms);
+        m_gradientProgramsChangeCount = compositionChangeCount;
+    }
+
     void TerrainHeightGradientListComponent::OnCompositionChanged()
     {
         OnCompositionRegionChanged(AZ::Aabb::CreateNull());
@@ -290,6 +325,11 @@ namespace Terrain
 
             m_cachedShapeBounds = shapeBounds;
 
+            // The gradient programs hold copies of the gradient settings, so they need to be compiled again. This is deferred to the
+            // next bulk query because a gradient entity that is being deactivated sends this notification before its components are
+            // deactivated, and compiling it now would keep its settings in the programs after it is gone.
+            ++m_compositionChangeCount;
+
             // Save off the min/max heights so that we don't have to re-query them on every single height query.
             m_cachedHeightBounds = heightBounds;
         }
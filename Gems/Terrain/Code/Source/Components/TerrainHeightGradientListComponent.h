@@ -23,6 +23,7 @@
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 
@@ -88,11 +89,22 @@ namespace Terrain
         void OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask) override;
 
     private:
+        //! Compiles the gradient programs again if the composition changed since they were last compiled.
+        void UpdateGradientPrograms();
+
         TerrainHeightGradientListConfig m_configuration;
 
         AzFramework::Terrain::FloatRange m_cachedHeightBounds{ 0.0f, 0.0f };
         AZ::Aabb m_cachedShapeBounds;
 
+        //! Compiled programs of the valid gradient entities. They are compiled on the first bulk query after the composition of any
+        //! of the gradients changes.
+        AZStd::vector<GradientSignal::GradientProgram> m_gradientPrograms;
+
+        //! Number of composition changes so far, and the number the gradient programs were compiled for.
+        AZ::u32 m_compositionChangeCount = 0;
+        AZ::u32 m_gradientProgramsChangeCount = 0;
+
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
 
         // The TerrainAreaHeightRequestBus allows parallel dispatches, so make sure that queries don't happen at the same
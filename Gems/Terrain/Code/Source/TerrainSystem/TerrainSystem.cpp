@@ -7,6 +7,7 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +26,18 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+namespace Terrain
+{
+    AZ_CVAR(
+        bool,
+        terrain_tileCacheEnabled,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Answer CLAMP and BILINEAR height, normal and surface weight queries from baked tiles of the terrain query grids "
+        "instead of evaluating the terrain areas for every query. Heights, normals and surface weights are quantized.");
+} // namespace Terrain
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -56,6 +69,15 @@ bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, co
 
 TerrainSystem::TerrainSystem()
     : m_terrainRaycastContext(*this)
+    , m_tileCache(
+        [this](AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists)
+        {
+            GetHeightsFromAreas(inOutPositions, terrainExists);
+        },
+        [this](AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights)
+        {
+            GetSurfaceWeightsFromAreas(inPositions, outSurfaceWeights);
+        })
 {
     Terrain::TerrainSystemServiceRequestBus::Handler::BusConnect();
     AZ::TickBus::Handler::BusConnect();
@@ -88,6 +110,7 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_tileCache.Clear();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +161,7 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_tileCache.Clear();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -273,6 +297,26 @@ void TerrainSystem::InterpolateHeights(const AZStd::array<float,4>& heights, con
     outExists = exists[existsIndex];
 }
 
+void TerrainSystem::InterpolateNormals(const AZStd::array<AZ::Vector3, 4>& normals, const AZStd::array<bool, 4>& exists,
+    float lerpX, float lerpY, AZ::Vector3& outNormal, bool& outExists)
+{
+    // The normals are in x0y0, x1y0, x0y1, x1y1 order, like the heights in InterpolateHeights.
+    const float invLerpX = 1.0f - lerpX;
+    const float invLerpY = 1.0f - lerpY;
+
+    AZ::Vector3 combinedNormal =
+        (normals[0] * (invLerpX * invLerpY)) +
+        (normals[1] * (lerpX * invLerpY)) +
+        (normals[2] * (invLerpX * lerpY)) +
+        (normals[3] * (lerpX * lerpY));
+
+    outNormal = combinedNormal.GetNormalized();
+
+    // Use the "terrain exists" result from the nearest corner as the result we'll return.
+    uint8_t existsIndex = ((lerpY >= 0.5f) << 1) | (lerpX >= 0.5f);
+    outExists = exists[existsIndex];
+}
+
 void TerrainSystem::RecalculateCachedBounds()
 {
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
@@ -426,27 +470,17 @@ void TerrainSystem::MakeBulkQueries(
     }
 }
 
-void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
-    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+bool TerrainSystem::IsTileCacheEnabled()
+{
+    return terrain_tileCacheEnabled;
+}
+
+void TerrainSystem::GetHeightsFromAreas(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists) const
 {
     TERRAIN_PROFILE_FUNCTION_VERBOSE
 
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
-    AZStd::vector<AZ::Vector3> outPositions;
-    AZStd::vector<bool> outTerrainExists;
-
-    // outPositions holds the iterators to results of the bulk queries.
-    // In the case of the bilinear sampler, we'll be making 4 queries per
-    // input position.
-    size_t indexStepSize = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) ? 4 : 1;
-    outPositions.reserve(inPositions.size() * indexStepSize);
-    outTerrainExists.resize(inPositions.size() * indexStepSize);
-
-    const float queryResolution = m_currentSettings.m_heightQueryResolution;
-
-    GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
-
     auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
                         AZStd::span<bool> outTerrainExists,
@@ -481,7 +515,56 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    MakeBulkQueries(inOutPositions, inOutPositions, terrainExists, outSurfaceWeights, callback);
+}
+
+void TerrainSystem::GetGridHeightsSynchronous(const AZStd::span<const AZ::Vector3>& gridPositions,
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    if (IsTileCacheEnabled())
+    {
+        m_tileCache.GetHeights(gridPositions, heights, terrainExists);
+    }
+    else
+    {
+        // Since the query points are grid-aligned, we can use EXACT queries.
+        GetHeightsSynchronous(gridPositions, Sampler::EXACT, heights, terrainExists);
+    }
+}
+
+void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    AZStd::vector<AZ::Vector3> outPositions;
+    AZStd::vector<bool> outTerrainExists;
+
+    // outPositions holds the iterators to results of the bulk queries.
+    // In the case of the bilinear sampler, we'll be making 4 queries per
+    // input position.
+    size_t indexStepSize = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) ? 4 : 1;
+    outPositions.reserve(inPositions.size() * indexStepSize);
+    outTerrainExists.resize(inPositions.size() * indexStepSize);
+
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+
+    GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
+
+    if ((sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) && IsTileCacheEnabled())
+    {
+        // The clamp and bilinear query positions are all on the height query grid, so they can be read from the baked tiles.
+        AZStd::vector<float> gridHeights(outPositions.size());
+        m_tileCache.GetHeights(outPositions, gridHeights, outTerrainExists);
+        for (size_t index = 0; index < outPositions.size(); index++)
+        {
+            outPositions[index].SetZ(gridHeights[index]);
+        }
+    }
+    else
+    {
+        GetHeightsFromAreas(outPositions, outTerrainExists);
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -524,6 +607,22 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
 {
     bool terrainExists = false;
 
+    if ((sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) && IsTileCacheEnabled())
+    {
+        // The grid samplers read the baked tiles through the list query.
+        const AZ::Vector3 position(x, y, 0.0f);
+        float height = 0.0f;
+        GetHeightsSynchronous(
+            AZStd::span<const AZ::Vector3>(&position, 1), sampler, AZStd::span<float>(&height, 1), AZStd::span<bool>(&terrainExists, 1));
+
+        if (terrainExistsPtr)
+        {
+            *terrainExistsPtr = terrainExists;
+        }
+
+        return AZ::GetClamp(height, m_currentSettings.m_heightRange.m_min, m_currentSettings.m_heightRange.m_max);
+    }
+
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
     float height = m_currentSettings.m_heightRange.m_min;
@@ -817,8 +916,7 @@ void TerrainSystem::GetNormalsSynchronousClamp(
     AZStd::vector<float> heights(queryPositions.size());
     AZStd::vector<bool> exists(queryPositions.size());
 
-    // Since our query points are grid-aligned, we can use EXACT queries.
-    GetHeightsSynchronous(queryPositions, Sampler::EXACT, heights, exists);
+    GetGridHeightsSynchronous(queryPositions, heights, exists);
 
     for (size_t inPosIndex = 0, queryPositionIndex = 0; inPosIndex < inPositions.size(); inPosIndex++, queryPositionIndex += queryCount)
     {
@@ -856,6 +954,40 @@ void TerrainSystem::GetNormalsSynchronousBilinear(
     const float queryResolution = m_currentSettings.m_heightQueryResolution;
     const float twiceQueryResolution = m_currentSettings.m_heightQueryResolution * 2.0f;
 
+    if (IsTileCacheEnabled())
+    {
+        // The baked tiles already hold the normal of each grid point, so only the 4 corners of the square need to be looked up.
+        constexpr size_t cornerCount = 4;
+        AZStd::vector<AZ::Vector3> cornerPositions;
+        cornerPositions.reserve(inPositions.size() * cornerCount);
+        for (const auto& position : inPositions)
+        {
+            AZ::Vector2 normalizedDelta;
+            AZ::Vector2 pos0;
+            ClampPosition(position.GetX(), position.GetY(), queryResolution, pos0, normalizedDelta);
+            cornerPositions.emplace_back(pos0.GetX()                  , pos0.GetY(), 0.0f);
+            cornerPositions.emplace_back(pos0.GetX() + queryResolution, pos0.GetY(), 0.0f);
+            cornerPositions.emplace_back(pos0.GetX()                  , pos0.GetY() + queryResolution, 0.0f);
+            cornerPositions.emplace_back(pos0.GetX() + queryResolution, pos0.GetY() + queryResolution, 0.0f);
+        }
+
+        AZStd::vector<AZ::Vector3> cornerNormals(cornerPositions.size());
+        AZStd::vector<bool> cornerExists(cornerPositions.size());
+        m_tileCache.GetNormals(cornerPositions, cornerNormals, cornerExists);
+
+        for (size_t inPosIndex = 0, cornerIndex = 0; inPosIndex < inPositions.size(); inPosIndex++, cornerIndex += cornerCount)
+        {
+            AZ::Vector2 normalizedDelta;
+            AZ::Vector2 pos0;
+            ClampPosition(inPositions[inPosIndex].GetX(), inPositions[inPosIndex].GetY(), queryResolution, pos0, normalizedDelta);
+            InterpolateNormals(
+                { cornerNormals[cornerIndex], cornerNormals[cornerIndex + 1], cornerNormals[cornerIndex + 2], cornerNormals[cornerIndex + 3] },
+                { cornerExists[cornerIndex], cornerExists[cornerIndex + 1], cornerExists[cornerIndex + 2], cornerExists[cornerIndex + 3] },
+                normalizedDelta.GetX(), normalizedDelta.GetY(), normals[inPosIndex], terrainExists[inPosIndex]);
+        }
+        return;
+    }
+
     // We'll need a total of 12 unique positions queried to calculate the 4 normals that we'll be interpolating between.
     // (We need 16 non-unique positions, but we can reuse the results for the middle 4 positions)
     const size_t queryCount = 12;
@@ -962,36 +1094,11 @@ void TerrainSystem::GetNormalsSynchronousBilinear(
         ClampPosition(inPositions[inPosIndex].GetX(), inPositions[inPosIndex].GetY(), queryResolution, pos3, normalizedDelta);
 
         // Then finally, interpolate between the 4 normals.
-        const float lerpX = normalizedDelta.GetX();
-        const float lerpY = normalizedDelta.GetY();
-        const float invLerpX = 1.0f - lerpX;
-        const float invLerpY = 1.0f - lerpY;
-
-        AZ::Vector3 combinedNormal =
-            (normal0 * (invLerpX * invLerpY)) +
-            (normal1 * (lerpX * invLerpY)) +
-            (normal2 * (invLerpX * lerpY)) +
-            (normal3 * (lerpX * lerpY));
-
-        normals[inPosIndex] = combinedNormal.GetNormalized();
-
-        // Use the "terrain exists" result from the nearest corner as the result we'll return.
-        if ((lerpX < 0.5f) && (lerpY < 0.5f))
-        {
-            terrainExists[inPosIndex] = exists[queryPositionIndex + 3];
-        }
-        else if ((lerpX >= 0.5f) && (lerpY < 0.5f))
-        {
-            terrainExists[inPosIndex] = exists[queryPositionIndex + 4];
-        }
-        else if ((lerpX < 0.5f) && (lerpY >= 0.5f))
-        {
-            terrainExists[inPosIndex] = exists[queryPositionIndex + 7];
-        }
-        else
-        {
-            terrainExists[inPosIndex] = exists[queryPositionIndex + 8];
-        }
+        const AZStd::array<AZ::Vector3, 4> cornerNormals = { normal0, normal1, normal2, normal3 };
+        const AZStd::array<bool, 4> cornerExists = { exists[queryPositionIndex + 3], exists[queryPositionIndex + 4],
+                                                     exists[queryPositionIndex + 7], exists[queryPositionIndex + 8] };
+        InterpolateNormals(cornerNormals, cornerExists, normalizedDelta.GetX(), normalizedDelta.GetY(),
+            normals[inPosIndex], terrainExists[inPosIndex]);
     }
 }
 
@@ -1283,6 +1390,23 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     Sampler querySampler = (sampler == Sampler::EXACT) ? Sampler::EXACT : Sampler::CLAMP;
     GenerateQueryPositions(inPositions, queryPositions, queryResolution, querySampler);
 
+    if ((querySampler == Sampler::CLAMP) && IsTileCacheEnabled())
+    {
+        // The clamped query positions are all on the surface data query grid, so they can be read from the baked tiles.
+        m_tileCache.GetSurfaceWeights(queryPositions, outSurfaceWeightsList);
+    }
+    else
+    {
+        GetSurfaceWeightsFromAreas(queryPositions, outSurfaceWeightsList);
+    }
+}
+
+void TerrainSystem::GetSurfaceWeightsFromAreas(
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
     auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
                         [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
                         [[maybe_unused]] AZStd::span<bool> outTerrainExists,
@@ -1303,9 +1427,10 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                             }
                         };
     
-    // This will be unused for surface weights. It's fine if it's empty.
+    // These will be unused for surface weights. It's fine if they're empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    AZStd::vector<bool> outTerrainExists;
+    MakeBulkQueries(inPositions, outPositions, outTerrainExists, outSurfaceWeightsList, callback);
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1688,6 +1813,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     m_dirtyRegion.AddAabb(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+    m_tileCache.Invalidate(aabb, m_terrainDirtyMask);
     m_cachedAreaBounds.AddAabb(aabb);
 }
 
@@ -1708,6 +1834,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+                m_tileCache.Invalidate(areaData.m_areaBounds, m_terrainDirtyMask);
 
                 if (ContainedAabbTouchesEdge(m_cachedAreaBounds, areaData.m_areaBounds))
                 {
@@ -1763,6 +1890,9 @@ void TerrainSystem::RefreshRegion(
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
+
+    // The baked tiles are dropped right away, so queries made before the next tick already see the new data.
+    m_tileCache.Invalidate(dirtyRegion, changeMask);
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1804,6 +1934,8 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+        m_tileCache.SetSettings(
+            m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution, m_currentSettings.m_heightRange);
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
@@ -26,6 +26,7 @@
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainTileCache.h>
 
 AZ_DECLARE_BUDGET(Terrain);
 
@@ -223,6 +224,8 @@ namespace Terrain
         static void RoundPosition(float x, float y, float queryResolution, AZ::Vector2& outPosition);
         static void InterpolateHeights(const AZStd::array<float, 4>& heights, const AZStd::array<bool, 4>& exists,
             float lerpX, float lerpY, float& outHeight, bool& outExists);
+        static void InterpolateNormals(const AZStd::array<AZ::Vector3, 4>& normals, const AZStd::array<bool, 4>& exists,
+            float lerpX, float lerpY, AZ::Vector3& outNormal, bool& outExists);
 
         AZ::EntityId FindBestAreaEntityAtPosition(const AZ::Vector3& position, AZ::Aabb& bounds) const;
         void GetOrderedSurfaceWeights(
@@ -266,6 +269,19 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
             AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList,
             AZStd::span<bool> terrainExists) const;
+
+        //! Sets the Z of each position to the terrain height there, evaluated directly from the terrain areas.
+        void GetHeightsFromAreas(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists) const;
+        //! Gets the surface weights of each position in decreasing weight order, evaluated directly from the terrain areas.
+        void GetSurfaceWeightsFromAreas(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
+        //! Gets the heights of positions on the height query grid, from the tile cache when it is enabled.
+        void GetGridHeightsSynchronous(
+            const AZStd::span<const AZ::Vector3>& gridPositions,
+            AZStd::span<float> heights,
+            AZStd::span<bool> terrainExists) const;
+        static bool IsTileCacheEnabled();
         void MakeBulkQueries(
             const AZStd::span<const AZ::Vector3> inPositions,
             AZStd::span<AZ::Vector3> outPositions,
@@ -314,6 +330,9 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        //! Baked tiles of the terrain grid data, used by the grid samplers when the terrain_tileCacheEnabled cvar is set.
+        mutable TerrainTileCache m_tileCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
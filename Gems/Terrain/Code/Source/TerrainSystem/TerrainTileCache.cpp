@@ -0,0 +1,526 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainTileCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+
+#include <TerrainProfiler.h>
+
+namespace Terrain
+{
+    AZ_CVAR(
+        uint32_t,
+        terrain_tileCacheMaxTiles,
+        512,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of height tiles, and of surface tiles, kept by the terrain tile cache.\n"
+        "The least recently used tiles are evicted first.");
+
+    namespace
+    {
+        //! Heights are quantized to 16 bits over the terrain height range.
+        constexpr float MaxQuantizedHeight = 65535.0f;
+
+        //! Surface weights are quantized to 8 bits.
+        constexpr float MaxQuantizedWeight = 255.0f;
+
+        //! Flags stored above the packed normal of each height tile point.
+        constexpr uint32_t TerrainExistsFlag = 1u << 24;
+        constexpr uint32_t NormalExistsFlag = 1u << 25;
+
+        //! Grid coordinates are clamped far enough from the int32 limits that adding a border or dividing into tiles can't overflow.
+        constexpr float MaxGridCoordinate = static_cast<float>(1 << 30);
+
+        int32_t GetGridCoordinate(float normalizedPosition)
+        {
+            return static_cast<int32_t>(AZStd::clamp(normalizedPosition, -MaxGridCoordinate, MaxGridCoordinate));
+        }
+
+        //! Returns the tile that contains the grid coordinate, rounding towards negative infinity.
+        int32_t GetTileCoordinate(int32_t gridCoordinate)
+        {
+            constexpr int32_t TileSize = TerrainTileCache::TileSize;
+            return (gridCoordinate >= 0) ? (gridCoordinate / TileSize) : -((TileSize - 1 - gridCoordinate) / TileSize);
+        }
+
+        uint64_t GetTileKey(int32_t tileX, int32_t tileY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+        }
+
+        AZStd::pair<int32_t, int32_t> GetTileCoordinates(uint64_t tileKey)
+        {
+            return { static_cast<int32_t>(static_cast<uint32_t>(tileKey >> 32)), static_cast<int32_t>(static_cast<uint32_t>(tileKey)) };
+        }
+
+        uint32_t PackNormal(const AZ::Vector3& normal)
+        {
+            auto packComponent = [](float value) -> uint32_t
+            {
+                const float quantized = AZStd::clamp(AZStd::floor(value * 127.0f + 0.5f), -127.0f, 127.0f);
+                return static_cast<uint8_t>(static_cast<int8_t>(quantized));
+            };
+            return packComponent(normal.GetX()) | (packComponent(normal.GetY()) << 8) | (packComponent(normal.GetZ()) << 16);
+        }
+
+        AZ::Vector3 UnpackNormal(uint32_t packedNormal)
+        {
+            auto unpackComponent = [packedNormal](uint32_t shift) -> float
+            {
+                return static_cast<float>(static_cast<int8_t>((packedNormal >> shift) & 0xFF)) / 127.0f;
+            };
+            return AZ::Vector3(unpackComponent(0), unpackComponent(8), unpackComponent(16)).GetNormalized();
+        }
+    } // namespace
+
+    struct TerrainTileCache::HeightTile
+    {
+        //! The height of each point is m_heightMin + quantized height * m_heightStep.
+        float m_heightMin = 0.0f;
+        float m_heightStep = 0.0f;
+        AZStd::vector<uint16_t> m_heights;
+
+        //! Normal of each point packed into the 3 low bytes, plus the exists flags.
+        AZStd::vector<uint32_t> m_normals;
+
+        mutable AZStd::atomic_uint64_t m_lastUse{ 0 };
+    };
+
+    struct TerrainTileCache::SurfaceTile
+    {
+        struct Point
+        {
+            AZStd::array<AZ::Crc32, MaxSurfaceWeights> m_surfaceTypes;
+            AZStd::array<uint8_t, MaxSurfaceWeights> m_weights;
+            uint8_t m_count = 0;
+        };
+
+        AZStd::vector<Point> m_points;
+
+        mutable AZStd::atomic_uint64_t m_lastUse{ 0 };
+    };
+
+    TerrainTileCache::TerrainTileCache(HeightFillFunction heightFillFunction, SurfaceFillFunction surfaceFillFunction)
+        : m_heightFillFunction(AZStd::move(heightFillFunction))
+        , m_surfaceFillFunction(AZStd::move(surfaceFillFunction))
+    {
+    }
+
+    void TerrainTileCache::SetSettings(
+        float heightQueryResolution, float surfaceDataQueryResolution, const AzFramework::Terrain::FloatRange& heightRange)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        // The surface weights are queried at the bottom of the height range, so both layers are baked against it.
+        const bool heightRangeChanged = (m_heightRange != heightRange);
+        if (heightRangeChanged || (m_heightTiles.m_queryResolution != heightQueryResolution))
+        {
+            m_heightTiles.m_tiles.clear();
+            m_heightTiles.m_queryResolution = heightQueryResolution;
+            ++m_heightTiles.m_generation;
+        }
+        if (heightRangeChanged || (m_surfaceTiles.m_queryResolution != surfaceDataQueryResolution))
+        {
+            m_surfaceTiles.m_tiles.clear();
+            m_surfaceTiles.m_queryResolution = surfaceDataQueryResolution;
+            ++m_surfaceTiles.m_generation;
+        }
+        m_heightRange = heightRange;
+    }
+
+    void TerrainTileCache::GetHeights(
+        AZStd::span<const AZ::Vector3> gridPositions, AZStd::span<float> heights, AZStd::span<bool> terrainExists)
+    {
+        TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::vector<TilePoint> tilePoints;
+        const auto tiles = FindOrFillTiles(m_heightTiles, gridPositions, tilePoints,
+            [this](int32_t tileX, int32_t tileY, float queryResolution, uint64_t use)
+            {
+                return FillHeightTile(tileX, tileY, queryResolution, use);
+            });
+
+        for (size_t index = 0; index < tilePoints.size(); ++index)
+        {
+            const HeightTile& tile = *tiles[tilePoints[index].m_tileIndex];
+            const uint32_t pointIndex = tilePoints[index].m_pointIndex;
+            heights[index] = tile.m_heightMin + tile.m_heights[pointIndex] * tile.m_heightStep;
+            terrainExists[index] = (tile.m_normals[pointIndex] & TerrainExistsFlag) != 0;
+        }
+    }
+
+    void TerrainTileCache::GetNormals(
+        AZStd::span<const AZ::Vector3> gridPositions, AZStd::span<AZ::Vector3> normals, AZStd::span<bool> terrainExists)
+    {
+        TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::vector<TilePoint> tilePoints;
+        const auto tiles = FindOrFillTiles(m_heightTiles, gridPositions, tilePoints,
+            [this](int32_t tileX, int32_t tileY, float queryResolution, uint64_t use)
+            {
+                return FillHeightTile(tileX, tileY, queryResolution, use);
+            });
+
+        for (size_t index = 0; index < tilePoints.size(); ++index)
+        {
+            const HeightTile& tile = *tiles[tilePoints[index].m_tileIndex];
+            const uint32_t packedNormal = tile.m_normals[tilePoints[index].m_pointIndex];
+            normals[index] = (packedNormal & NormalExistsFlag) ? UnpackNormal(packedNormal) : AZ::Vector3::CreateAxisZ();
+            terrainExists[index] = (packedNormal & TerrainExistsFlag) != 0;
+        }
+    }
+
+    void TerrainTileCache::GetSurfaceWeights(
+        AZStd::span<const AZ::Vector3> gridPositions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights)
+    {
+        TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::vector<TilePoint> tilePoints;
+        const auto tiles = FindOrFillTiles(m_surfaceTiles, gridPositions, tilePoints,
+            [this](int32_t tileX, int32_t tileY, float queryResolution, uint64_t use)
+            {
+                return FillSurfaceTile(tileX, tileY, queryResolution, use);
+            });
+
+        for (size_t index = 0; index < tilePoints.size(); ++index)
+        {
+            const SurfaceTile::Point& point = tiles[tilePoints[index].m_tileIndex]->m_points[tilePoints[index].m_pointIndex];
+            surfaceWeights[index].clear();
+            for (uint8_t weightIndex = 0; weightIndex < point.m_count; ++weightIndex)
+            {
+                surfaceWeights[index].emplace_back(
+                    point.m_surfaceTypes[weightIndex], point.m_weights[weightIndex] / MaxQuantizedWeight);
+            }
+        }
+    }
+
+    void TerrainTileCache::Invalidate(
+        const AZ::Aabb& region, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
+    {
+        using ChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if ((changeMask & ChangedMask::HeightData) == ChangedMask::HeightData)
+        {
+            InvalidateTiles(m_heightTiles, region);
+        }
+        if ((changeMask & ChangedMask::SurfaceData) == ChangedMask::SurfaceData)
+        {
+            InvalidateTiles(m_surfaceTiles, region);
+        }
+    }
+
+    void TerrainTileCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_heightTiles.m_tiles.clear();
+        ++m_heightTiles.m_generation;
+        m_surfaceTiles.m_tiles.clear();
+        ++m_surfaceTiles.m_generation;
+    }
+
+    size_t TerrainTileCache::GetHeightTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_heightTiles.m_tiles.size();
+    }
+
+    size_t TerrainTileCache::GetSurfaceTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_surfaceTiles.m_tiles.size();
+    }
+
+    template<typename TileType, typename FillTileFunction>
+    AZStd::vector<AZStd::shared_ptr<const TileType>> TerrainTileCache::FindOrFillTiles(
+        TileLayer<TileType>& layer,
+        AZStd::span<const AZ::Vector3> gridPositions,
+        AZStd::vector<TilePoint>& tilePoints,
+        const FillTileFunction& fillTile)
+    {
+        AZStd::vector<AZStd::shared_ptr<const TileType>> tiles;
+        AZStd::vector<uint64_t> tileKeys;
+        AZStd::vector<size_t> missingTileIndices;
+        tilePoints.resize(gridPositions.size());
+
+        const uint64_t use = ++m_useCounter;
+        float queryResolution = 1.0f;
+        uint64_t generation = 0;
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            queryResolution = layer.m_queryResolution;
+            generation = layer.m_generation;
+
+            // Consecutive positions are usually in the same tile, so the previous tile is checked before the tiles of this query.
+            AZStd::unordered_map<uint64_t, uint32_t> tileIndexByKey;
+            uint64_t previousTileKey = 0;
+            uint32_t previousTileIndex = 0;
+            for (size_t index = 0; index < gridPositions.size(); ++index)
+            {
+                // The positions are on the grid already, rounding only removes the error of the division.
+                const int32_t gridX = GetGridCoordinate(AZStd::floor(gridPositions[index].GetX() / queryResolution + 0.5f));
+                const int32_t gridY = GetGridCoordinate(AZStd::floor(gridPositions[index].GetY() / queryResolution + 0.5f));
+                const int32_t tileX = GetTileCoordinate(gridX);
+                const int32_t tileY = GetTileCoordinate(gridY);
+                const uint64_t tileKey = GetTileKey(tileX, tileY);
+
+                if (tiles.empty() || (tileKey != previousTileKey))
+                {
+                    const auto [tileIndexEntry, inserted] = tileIndexByKey.emplace(tileKey, aznumeric_cast<uint32_t>(tiles.size()));
+                    if (inserted)
+                    {
+                        auto cachedTile = layer.m_tiles.find(tileKey);
+                        if (cachedTile != layer.m_tiles.end())
+                        {
+                            cachedTile->second->m_lastUse = use;
+                            tiles.push_back(cachedTile->second);
+                        }
+                        else
+                        {
+                            missingTileIndices.push_back(tiles.size());
+                            tiles.emplace_back();
+                        }
+                        tileKeys.push_back(tileKey);
+                    }
+                    previousTileKey = tileKey;
+                    previousTileIndex = tileIndexEntry->second;
+                }
+
+                tilePoints[index].m_tileIndex = previousTileIndex;
+                tilePoints[index].m_pointIndex = aznumeric_cast<uint32_t>((gridY - tileY * TileSize) * TileSize + (gridX - tileX * TileSize));
+            }
+        }
+
+        if (missingTileIndices.empty())
+        {
+            return tiles;
+        }
+
+        auto fillMissingTile = [&tiles, &tileKeys, &fillTile, queryResolution, use](size_t tileIndex)
+        {
+            const auto [tileX, tileY] = GetTileCoordinates(tileKeys[tileIndex]);
+            tiles[tileIndex] = fillTile(tileX, tileY, queryResolution, use);
+        };
+
+        if (missingTileIndices.size() == 1)
+        {
+            fillMissingTile(missingTileIndices[0]);
+        }
+        else
+        {
+            AZ_PROFILE_SCOPE(Terrain, "TerrainTileCache: FillTiles");
+
+            // Each tile is evaluated in its own job. Jobs are used rather than the task graph because queries can come from the
+            // terrain async query jobs, and waiting on a job completion from a job assists with the work instead of blocking a worker.
+            AZ::JobCompletion jobCompletion;
+            for (size_t tileIndex : missingTileIndices)
+            {
+                auto jobLambda = [&fillMissingTile, tileIndex]()
+                {
+                    fillMissingTile(tileIndex);
+                };
+                AZ::Job* job = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr); // Auto-deletes
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        // Tiles that were filled while a part of the terrain was refreshed may hold old data. They are still returned, since the query
+        // started before the refresh, but they aren't kept.
+        if (layer.m_generation == generation)
+        {
+            for (size_t tileIndex : missingTileIndices)
+            {
+                layer.m_tiles[tileKeys[tileIndex]] = tiles[tileIndex];
+            }
+            EvictTiles(layer);
+        }
+
+        return tiles;
+    }
+
+    template<typename TileType>
+    void TerrainTileCache::EvictTiles(TileLayer<TileType>& layer)
+    {
+        const size_t maxTileCount = static_cast<uint32_t>(terrain_tileCacheMaxTiles);
+        if (layer.m_tiles.size() <= maxTileCount)
+        {
+            return;
+        }
+
+        AZStd::vector<AZStd::pair<uint64_t, uint64_t>> tilesByLastUse;
+        tilesByLastUse.reserve(layer.m_tiles.size());
+        for (const auto& [tileKey, tile] : layer.m_tiles)
+        {
+            tilesByLastUse.emplace_back(tile->m_lastUse.load(), tileKey);
+        }
+        AZStd::sort(tilesByLastUse.begin(), tilesByLastUse.end());
+
+        const size_t evictedTileCount = layer.m_tiles.size() - maxTileCount;
+        for (size_t index = 0; index < evictedTileCount; ++index)
+        {
+            layer.m_tiles.erase(tilesByLastUse[index].second);
+        }
+    }
+
+    template<typename TileType>
+    void TerrainTileCache::InvalidateTiles(TileLayer<TileType>& layer, const AZ::Aabb& region)
+    {
+        // The region is expanded by one grid point, since the normals of the points around it are computed from the heights in it.
+        const float queryResolution = layer.m_queryResolution;
+        const int32_t tileXMin = GetTileCoordinate(GetGridCoordinate(AZStd::floor(region.GetMin().GetX() / queryResolution)) - 1);
+        const int32_t tileYMin = GetTileCoordinate(GetGridCoordinate(AZStd::floor(region.GetMin().GetY() / queryResolution)) - 1);
+        const int32_t tileXMax = GetTileCoordinate(GetGridCoordinate(AZStd::ceil(region.GetMax().GetX() / queryResolution)) + 1);
+        const int32_t tileYMax = GetTileCoordinate(GetGridCoordinate(AZStd::ceil(region.GetMax().GetY() / queryResolution)) + 1);
+
+        AZStd::erase_if(
+            layer.m_tiles,
+            [tileXMin, tileYMin, tileXMax, tileYMax](const auto& item)
+            {
+                const auto [tileX, tileY] = GetTileCoordinates(item.first);
+                return (tileX >= tileXMin) && (tileX <= tileXMax) && (tileY >= tileYMin) && (tileY <= tileYMax);
+            });
+        ++layer.m_generation;
+    }
+
+    AZStd::shared_ptr<const TerrainTileCache::HeightTile> TerrainTileCache::FillHeightTile(
+        int32_t tileX, int32_t tileY, float queryResolution, uint64_t use) const
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        AzFramework::Terrain::FloatRange heightRange;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            heightRange = m_heightRange;
+        }
+
+        // The heights are evaluated with a border of one grid point, so the points on the edges of the tile get their full + shape.
+        constexpr int32_t BorderedTileSize = TileSize + 2;
+        const int32_t gridXMin = tileX * TileSize - 1;
+        const int32_t gridYMin = tileY * TileSize - 1;
+        const float minHeight = heightRange.IsValid() ? heightRange.m_min : 0.0f;
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(BorderedTileSize * BorderedTileSize);
+        for (int32_t y = 0; y < BorderedTileSize; ++y)
+        {
+            for (int32_t x = 0; x < BorderedTileSize; ++x)
+            {
+                positions.emplace_back((gridXMin + x) * queryResolution, (gridYMin + y) * queryResolution, minHeight);
+            }
+        }
+        AZStd::vector<bool> exists(positions.size(), false);
+        m_heightFillFunction(positions, exists);
+
+        auto tile = AZStd::make_shared<HeightTile>();
+        tile->m_heightMin = minHeight;
+        tile->m_heightStep = heightRange.IsValid() ? (heightRange.m_max - heightRange.m_min) / MaxQuantizedHeight : 0.0f;
+        tile->m_heights.resize(TileSize * TileSize);
+        tile->m_normals.resize(TileSize * TileSize);
+        tile->m_lastUse = use;
+
+        for (int32_t y = 0; y < TileSize; ++y)
+        {
+            for (int32_t x = 0; x < TileSize; ++x)
+            {
+                const size_t center = (y + 1) * BorderedTileSize + (x + 1);
+                const size_t left = center - 1;
+                const size_t right = center + 1;
+                const size_t down = center - BorderedTileSize;
+                const size_t up = center + BorderedTileSize;
+                const size_t pointIndex = y * TileSize + x;
+
+                const float normalizedHeight =
+                    (tile->m_heightStep > 0.0f) ? (positions[center].GetZ() - tile->m_heightMin) / tile->m_heightStep : 0.0f;
+                tile->m_heights[pointIndex] =
+                    static_cast<uint16_t>(AZStd::clamp(AZStd::floor(normalizedHeight + 0.5f), 0.0f, MaxQuantizedHeight));
+
+                // Same as the bilinear normal query, (right - left) x (up - down), and Z-up unless the whole + shape exists.
+                uint32_t packedNormal = exists[center] ? TerrainExistsFlag : 0;
+                if (exists[center] && exists[left] && exists[right] && exists[down] && exists[up])
+                {
+                    const AZ::Vector3 normal =
+                        (positions[right] - positions[left]).Cross(positions[up] - positions[down]).GetNormalized();
+                    packedNormal |= PackNormal(normal) | NormalExistsFlag;
+                }
+                else
+                {
+                    packedNormal |= PackNormal(AZ::Vector3::CreateAxisZ());
+                }
+                tile->m_normals[pointIndex] = packedNormal;
+            }
+        }
+
+        return tile;
+    }
+
+    AZStd::shared_ptr<const TerrainTileCache::SurfaceTile> TerrainTileCache::FillSurfaceTile(
+        int32_t tileX, int32_t tileY, float queryResolution, uint64_t use) const
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        AzFramework::Terrain::FloatRange heightRange;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            heightRange = m_heightRange;
+        }
+
+        const int32_t gridXMin = tileX * TileSize;
+        const int32_t gridYMin = tileY * TileSize;
+        const float minHeight = heightRange.IsValid() ? heightRange.m_min : 0.0f;
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(TileSize * TileSize);
+        for (int32_t y = 0; y < TileSize; ++y)
+        {
+            for (int32_t x = 0; x < TileSize; ++x)
+            {
+                positions.emplace_back((gridXMin + x) * queryResolution, (gridYMin + y) * queryResolution, minHeight);
+            }
+        }
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(positions.size());
+        m_surfaceFillFunction(positions, surfaceWeights);
+
+        auto tile = AZStd::make_shared<SurfaceTile>();
+        tile->m_points.resize(positions.size());
+        tile->m_lastUse = use;
+
+        // The weights are in decreasing order, so the first ones are the ones to keep.
+        for (size_t pointIndex = 0; pointIndex < positions.size(); ++pointIndex)
+        {
+            SurfaceTile::Point& point = tile->m_points[pointIndex];
+            point.m_count = aznumeric_cast<uint8_t>(AZStd::min(surfaceWeights[pointIndex].size(), MaxSurfaceWeights));
+            for (uint8_t weightIndex = 0; weightIndex < point.m_count; ++weightIndex)
+            {
+                const AzFramework::SurfaceData::SurfaceTagWeight& surfaceWeight = surfaceWeights[pointIndex][weightIndex];
+                point.m_surfaceTypes[weightIndex] = surfaceWeight.m_surfaceType;
+                point.m_weights[weightIndex] =
+                    static_cast<uint8_t>(AZStd::clamp(AZStd::floor(surfaceWeight.m_weight * MaxQuantizedWeight + 0.5f), 0.0f, MaxQuantizedWeight));
+            }
+        }
+
+        return tile;
+    }
+} // namespace Terrain
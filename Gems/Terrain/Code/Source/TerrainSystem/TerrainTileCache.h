@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+#include <AzFramework/SurfaceData/SurfaceData.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+
+namespace Terrain
+{
+    //! Cache of terrain data baked into fixed size tiles of query grid points.
+    //! Height tiles hold the quantized height, the normal and the "terrain exists" flag of each point of the height query grid.
+    //! Surface tiles hold the highest surface weights of each point of the surface data query grid.
+    //! Tiles are filled the first time a query touches them by evaluating the terrain areas through the fill functions, and the
+    //! least recently used tiles are evicted once the cache is full. Queries of grid points then become lookups in the tiles.
+    //! All methods are thread safe.
+    class TerrainTileCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TerrainTileCache, AZ::SystemAllocator);
+
+        //! Number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 32;
+
+        //! Number of surface weights kept for each grid point. The lower weights are dropped.
+        static constexpr size_t MaxSurfaceWeights = 4;
+
+        //! Sets the Z of each position to the terrain height there, evaluated directly from the terrain areas.
+        using HeightFillFunction = AZStd::function<void(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists)>;
+
+        //! Gets the surface weights of each position in decreasing weight order, evaluated directly from the terrain areas.
+        using SurfaceFillFunction = AZStd::function<void(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights)>;
+
+        TerrainTileCache(HeightFillFunction heightFillFunction, SurfaceFillFunction surfaceFillFunction);
+
+        //! Sets the grids and the height range the tiles are baked with. Drops all tiles if any of them changed.
+        void SetSettings(
+            float heightQueryResolution, float surfaceDataQueryResolution, const AzFramework::Terrain::FloatRange& heightRange);
+
+        //! Gets the height of each position on the height query grid.
+        void GetHeights(AZStd::span<const AZ::Vector3> gridPositions, AZStd::span<float> heights, AZStd::span<bool> terrainExists);
+
+        //! Gets the normal of each position on the height query grid, which is the cross product of the + shape around the position.
+        //! The normal is Z-up when any point of the + shape doesn't exist. terrainExists is the flag of the position itself.
+        void GetNormals(AZStd::span<const AZ::Vector3> gridPositions, AZStd::span<AZ::Vector3> normals, AZStd::span<bool> terrainExists);
+
+        //! Gets the surface weights of each position on the surface data query grid, in decreasing weight order.
+        void GetSurfaceWeights(
+            AZStd::span<const AZ::Vector3> gridPositions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights);
+
+        //! Drops the tiles of the changed data that overlap the region in XY.
+        void Invalidate(const AZ::Aabb& region, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask);
+
+        //! Drops all tiles.
+        void Clear();
+
+        size_t GetHeightTileCount() const;
+        size_t GetSurfaceTileCount() const;
+
+    private:
+        struct HeightTile;
+        struct SurfaceTile;
+
+        template<typename TileType>
+        struct TileLayer
+        {
+            AZStd::unordered_map<uint64_t, AZStd::shared_ptr<const TileType>> m_tiles;
+
+            //! Distance between the grid points of the tiles.
+            float m_queryResolution = 1.0f;
+
+            //! Incremented whenever tiles are dropped, so tiles that were filled from older data are never added back.
+            uint64_t m_generation = 0;
+        };
+
+        //! Location of a grid point in the tiles returned by FindOrFillTiles.
+        struct TilePoint
+        {
+            uint32_t m_tileIndex = 0;
+            uint32_t m_pointIndex = 0;
+        };
+
+        //! Returns the tiles that contain the grid positions, filling the missing ones in parallel.
+        template<typename TileType, typename FillTileFunction>
+        AZStd::vector<AZStd::shared_ptr<const TileType>> FindOrFillTiles(
+            TileLayer<TileType>& layer,
+            AZStd::span<const AZ::Vector3> gridPositions,
+            AZStd::vector<TilePoint>& tilePoints,
+            const FillTileFunction& fillTile);
+
+        template<typename TileType>
+        void EvictTiles(TileLayer<TileType>& layer);
+
+        template<typename TileType>
+        static void InvalidateTiles(TileLayer<TileType>& layer, const AZ::Aabb& region);
+
+        AZStd::shared_ptr<const HeightTile> FillHeightTile(int32_t tileX, int32_t tileY, float queryResolution, uint64_t use) const;
+        AZStd::shared_ptr<const SurfaceTile> FillSurfaceTile(int32_t tileX, int32_t tileY, float queryResolution, uint64_t use) const;
+
+        HeightFillFunction m_heightFillFunction;
+        SurfaceFillFunction m_surfaceFillFunction;
+
+        mutable AZStd::shared_mutex m_mutex;
+        TileLayer<HeightTile> m_heightTiles;
+        TileLayer<SurfaceTile> m_surfaceTiles;
+        AzFramework::Terrain::FloatRange m_heightRange = AzFramework::Terrain::FloatRange::CreateNull();
+
+        AZStd::atomic_uint64_t m_useCounter{ 0 };
+    };
+} // namespace Terrain
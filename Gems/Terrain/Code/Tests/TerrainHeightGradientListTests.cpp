@@ -10,6 +10,7 @@
 #include <AzTest/AzTest.h>
 
 #include <Components/TerrainHeightGradientListComponent.h>
+#include <GradientSignal/Components/ConstantGradientComponent.h>
 
 #include <MockAxisAlignedBoxShapeComponent.h>
 #include <GradientSignal/Ebuses/MockGradientRequestBus.h>
@@ -197,3 +198,68 @@ TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientListGetHeigh
         ASSERT_EQ(terrainExists, terrainExistsList[index]);
     }
 }
+
+TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientListGetHeightsMatchesGetHeightAfterGradientDeactivates)
+{
+    // Check that a gradient compiled for GetHeights doesn't keep contributing to the heights after its entity is deactivated.
+    // The dependency monitor reports the composition change before the gradient components are deactivated, so the component
+    // must not compile the gradient programs at that point.
+
+    auto gradientEntity = CreateEntity();
+    GradientSignal::ConstantGradientConfig gradientConfig;
+    gradientConfig.m_value = 0.75f;
+    gradientEntity->CreateComponent<GradientSignal::ConstantGradientComponent>(gradientConfig);
+    ActivateEntity(gradientEntity.get());
+
+    auto entity = CreateEntity();
+    Terrain::TerrainHeightGradientListConfig config;
+    config.m_gradientEntities.push_back(gradientEntity->GetId());
+    entity->CreateComponent<Terrain::TerrainHeightGradientListComponent>(config);
+    AddRequiredComponentsToEntity(entity.get());
+
+    // Setup a mock to provide the encompassing Aabb to the HeightGradientListComponent.
+    const float min = 0.0f;
+    const float max = 1000.0f;
+    const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(min), AZ::Vector3(max));
+    NiceMock<UnitTest::MockShapeComponentRequests> mockShapeRequests(entity->GetId());
+    ON_CALL(mockShapeRequests, GetEncompassingAabb).WillByDefault(Return(aabb));
+
+    NiceMock<UnitTest::MockTerrainDataRequests> mockterrainDataRequests;
+    ON_CALL(mockterrainDataRequests, GetTerrainHeightQueryResolution).WillByDefault(Return(1.0f));
+    ON_CALL(mockterrainDataRequests, GetTerrainHeightBounds).WillByDefault(Return(AzFramework::Terrain::FloatRange({ min, max })));
+
+    ActivateEntity(entity.get());
+
+    auto checkHeights = [&entity](float expectedHeight)
+    {
+        AZStd::vector<AZ::Vector3> inOutPositions;
+        AZStd::vector<bool> terrainExistsList;
+        for (float x = 0.0f; x <= 10.0f; x += 0.5f)
+        {
+            inOutPositions.emplace_back(x, x, 0.0f);
+            terrainExistsList.emplace_back(false);
+        }
+
+        Terrain::TerrainAreaHeightRequestBus::Event(
+            entity->GetId(), &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, inOutPositions, terrainExistsList);
+
+        for (size_t index = 0; index < inOutPositions.size(); index++)
+        {
+            AZ::Vector3 inPosition(inOutPositions[index].GetX(), inOutPositions[index].GetY(), 0.0f);
+            AZ::Vector3 outPosition = AZ::Vector3(0.0f);
+            bool terrainExists = false;
+            Terrain::TerrainAreaHeightRequestBus::Event(
+                entity->GetId(), &Terrain::TerrainAreaHeightRequestBus::Events::GetHeight, inPosition, outPosition, terrainExists);
+
+            EXPECT_NEAR(outPosition.GetZ(), expectedHeight, 0.01f);
+            ASSERT_TRUE(inOutPositions[index].IsClose(outPosition));
+            ASSERT_EQ(terrainExists, terrainExistsList[index]);
+        }
+    };
+
+    checkHeights(gradientConfig.m_value * max);
+
+    // Once the gradient is gone both queries sample it as 0.
+    gradientEntity->Deactivate();
+    checkHeights(min);
+}
@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
@@ -33,6 +34,11 @@
 #include <TerrainTestFixtures.h>
 #include <benchmark/benchmark.h>
 
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(bool, terrain_tileCacheEnabled);
+}
+
 namespace UnitTest
 {
     using ::testing::NiceMock;
@@ -195,6 +201,50 @@ namespace UnitTest
         ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsAndNormalsRegionTileCache)(benchmark::State& state)
+    {
+        // state.range(3) turns the tile cache on or off. With the cache on, the first iteration fills the tiles and the
+        // following ones only read them back.
+        Terrain::terrain_tileCacheEnabled = (state.range(3) != 0);
+
+        // Run the benchmark
+        RunTerrainApiBenchmark(
+            state,
+            [](float queryResolution, const AZ::Aabb& worldBounds, AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                auto perPositionCallback = []([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                    const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint.m_position.GetZ());
+                    benchmark::DoNotOptimize(surfacePoint.m_normal.GetZ());
+                };
+
+                AZ::Vector2 stepSize = AZ::Vector2(queryResolution);
+                AzFramework::Terrain::TerrainQueryRegion queryRegion =
+                    AzFramework::Terrain::TerrainQueryRegion::CreateFromAabbAndStepSize(worldBounds, stepSize);
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::QueryRegion, queryRegion,
+                    static_cast<AzFramework::Terrain::TerrainDataRequests::TerrainDataMask>(
+                        AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights |
+                        AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Normals),
+                    perPositionCallback, sampler);
+            }
+        );
+
+        Terrain::terrain_tileCacheEnabled = false;
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsAndNormalsRegionTileCache)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 0 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 0 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 0 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 0 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1 })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsRegionAsync)(benchmark::State& state)
     {
         // Run the benchmark
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/std/parallel/semaphore.h>
 
@@ -35,6 +36,11 @@ using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::SetArgReferee;
 
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(bool, terrain_tileCacheEnabled);
+}
+
 namespace UnitTest
 {
     class TerrainSystemTest
@@ -1549,4 +1555,89 @@ namespace UnitTest
         // Now wait until the async request has completed after being cancelled.
         asyncRequestCompletedEvent.acquire();
     }
+
+    TEST_F(TerrainSystemTest, TerrainTileCacheMatchesUncachedGridQueries)
+    {
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(3.0f * sinf(position.GetX() * 0.4f) + 2.0f * cosf(position.GetY() * 0.3f));
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // The region crosses the origin, so it touches the 4 tiles around it.
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(AZ::Vector3(-4.1f, -4.1f, 0.0f), 24, 24, AZ::Vector2(0.37f));
+        const auto requestedData = static_cast<AzFramework::Terrain::TerrainDataRequests::TerrainDataMask>(
+            AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights |
+            AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Normals);
+
+        for (auto sampler : { AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+                              AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR })
+        {
+            AZStd::vector<AzFramework::SurfaceData::SurfacePoint> points[2];
+            for (bool tileCacheEnabled : { false, true })
+            {
+                Terrain::terrain_tileCacheEnabled = tileCacheEnabled;
+                auto& queriedPoints = points[tileCacheEnabled];
+                terrainSystem->QueryRegion(
+                    queryRegion, requestedData,
+                    [&queriedPoints]([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                        const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                    {
+                        queriedPoints.push_back(surfacePoint);
+                    },
+                    sampler);
+            }
+            Terrain::terrain_tileCacheEnabled = false;
+
+            // The cached heights are quantized to 16 bits over the 256 meter height range, and the normals to 8 bits per component.
+            ASSERT_EQ(points[0].size(), points[1].size());
+            for (size_t index = 0; index < points[0].size(); index++)
+            {
+                EXPECT_NEAR(points[0][index].m_position.GetZ(), points[1][index].m_position.GetZ(), 0.005f);
+                EXPECT_TRUE(points[0][index].m_normal.IsClose(points[1][index].m_normal, 0.02f));
+            }
+        }
+    }
+
+    TEST_F(TerrainSystemTest, TerrainTileCacheIsInvalidatedByRefreshRegion)
+    {
+        float heightOffset = 1.0f;
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+        Terrain::terrain_tileCacheEnabled = true;
+
+        const AZ::Vector3 position(2.5f, 2.5f, 0.0f);
+        constexpr float epsilon = 0.005f;
+        EXPECT_NEAR(terrainSystem->GetHeight(position), 1.0f, epsilon);
+
+        // Until the region is refreshed, the height comes from the baked tile.
+        heightOffset = 2.0f;
+        EXPECT_NEAR(terrainSystem->GetHeight(position), 1.0f, epsilon);
+
+        // Refreshing a region away from the position keeps its tile.
+        terrainSystem->RefreshRegion(
+            AZ::Aabb::CreateFromMinMaxValues(-9.0f, -9.0f, -5.0f, -8.0f, -8.0f, 15.0f),
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        EXPECT_NEAR(terrainSystem->GetHeight(position), 1.0f, epsilon);
+
+        terrainSystem->RefreshRegion(
+            AZ::Aabb::CreateFromMinMaxValues(2.0f, 2.0f, -5.0f, 3.0f, 3.0f, 15.0f),
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        EXPECT_NEAR(terrainSystem->GetHeight(position), 2.0f, epsilon);
+
+        Terrain::terrain_tileCacheEnabled = false;
+    }
 } // namespace UnitTest
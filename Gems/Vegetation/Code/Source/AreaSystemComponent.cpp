@@ -22,7 +22,10 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
@@ -1082,13 +1085,20 @@ namespace Vegetation
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
         return &sectorInfoRef;
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode) const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
@@ -1489,7 +1499,7 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateNextSectors(threadData, vegTasks);
             }
         }
     }
@@ -1754,7 +1764,7 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateNextSectors(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -1776,55 +1786,117 @@ namespace Vegetation
             }
         }
 
-        // Create / update if there's anything to do and we didn't prioritize a delete.
-        if (!m_updateWorkList.empty())
+        if (m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
+            // No sectors left to process, so tell our main loop to stop processing.
+            return false;
+        }
+
+        // A fill only runs the area claims.  Areas connect to their buses for the duration of a claim, so fills can't run in
+        // parallel and are processed one sector at a time.
+        if (m_updateWorkList.back().second == UpdateMode::Fill)
+        {
+            SectorId sectorId = m_updateWorkList.back().first;
             m_updateWorkList.pop_back();
 
-            {
-                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+            auto sectorInfo = vegTasks->GetSector(sectorId);
+            AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+            return true;
+        }
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+        // Creates and rebuilds first need the surface points of the sector, which is usually the most expensive part of the update.
+        // The closest sectors that need surface points are gathered into a batch with one sector per job worker, their points are
+        // generated in parallel outside of the rolling window lock, and then the sectors are filled one at a time.
+        const size_t maxBatchSize = AZStd::max<size_t>(AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads(), 1);
+        AZStd::vector<SectorPointsUpdate> updates;
+        updates.reserve(AZStd::min(maxBatchSize, m_updateWorkList.size()));
+        while (!m_updateWorkList.empty() && (updates.size() < maxBatchSize) && (m_updateWorkList.back().second != UpdateMode::Fill))
+        {
+            SectorPointsUpdate& update = updates.emplace_back();
+            update.m_mode = m_updateWorkList.back().second;
+            update.m_sectorInfo.m_id = m_updateWorkList.back().first;
+            update.m_sectorInfo.m_bounds =
+                VegetationThreadTasks::GetSectorBounds(update.m_sectorInfo.m_id, m_cachedMainThreadData.m_sectorSizeInMeters);
+            m_updateWorkList.pop_back();
+        }
 
-                switch (mode)
-                {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+        GenerateSectorPoints(vegTasks, updates);
 
-                    case UpdateMode::Fill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+        for (size_t updateIndex = 0; updateIndex < updates.size(); ++updateIndex)
+        {
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                    case UpdateMode::Create:
-                    {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+            // Between fills, stop the batch if Run() has work that would have gone ahead of the next sector when updating them
+            // one at a time: an interrupt, main thread state that needs to be synchronized, or deletes that are due because the
+            // rolling window has grown past the view rectangle.  The remaining sectors are put back on the work list, closest last,
+            // and their points are regenerated when they come up again since the synchronized state may have changed them.
+            if ((updateIndex > 0) &&
+                ((threadData->m_vegetationThreadState == PersistentThreadData::VegetationThreadState::InterruptRequested) ||
+                 (threadData->m_vegetationDataSyncState == PersistentThreadData::VegetationDataSyncState::Dirty) ||
+                 (!m_deleteWorkList.empty() && (vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount))))
+            {
+                for (size_t requeueIndex = updates.size(); requeueIndex-- > updateIndex;)
+                {
+                    m_updateWorkList.emplace_back(updates[requeueIndex].m_sectorInfo.m_id, updates[requeueIndex].m_mode);
                 }
+                break;
             }
 
-            return true;
+            SectorPointsUpdate& update = updates[updateIndex];
+
+            SectorInfo* sectorInfo = nullptr;
+            if (update.m_mode == UpdateMode::Create)
+            {
+                AZ_Assert(!vegTasks->GetSector(update.m_sectorInfo.m_id), "Sector update mode is 'Create' but sector already exists");
+                sectorInfo = vegTasks->AddSector(AZStd::move(update.m_sectorInfo));
+            }
+            else
+            {
+                sectorInfo = vegTasks->GetSector(update.m_sectorInfo.m_id);
+                AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+
+                // Only the points are replaced, the sector keeps its claims and callbacks.
+                sectorInfo->m_baseContext.m_availablePoints = AZStd::move(update.m_sectorInfo.m_baseContext.m_availablePoints);
+                sectorInfo->m_baseContext.m_masks = AZStd::move(update.m_sectorInfo.m_baseContext.m_masks);
+            }
+
+            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
         }
 
-        // No sectors left to process, so tell our main loop to stop processing.
-        return false;
+        return true;
+    }
+
+    void AreaSystemComponent::UpdateContext::GenerateSectorPoints(
+        const VegetationThreadTasks* vegTasks, AZStd::vector<SectorPointsUpdate>& updates) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        if (updates.size() == 1)
+        {
+            vegTasks->UpdateSectorPoints(updates[0].m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            return;
+        }
+
+        // The vegetation thread is itself a job, and waiting on a job completion from a job assists with the work instead of
+        // blocking a worker.
+        AZ::JobCompletion jobCompletion;
+        for (SectorPointsUpdate& update : updates)
+        {
+            auto jobLambda = [vegTasks, &update, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+            {
+                vegTasks->UpdateSectorPoints(update.m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            };
+            AZ::Job* job = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr); // Auto-deletes
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
     }
 
 }
@@ -292,7 +292,11 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose points have already been generated to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
+            //! Generates the claimable points of the sector.  This only reads and writes the given sector, so it can run
+            //! for several sectors in parallel, as long as they aren't in the rolling window yet.
+            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode) const;
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
@@ -428,9 +432,6 @@ namespace Vegetation
             const CachedMainThreadData& GetCachedMainThreadData() { return m_cachedMainThreadData; }
 
         private:
-            bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-
             enum class UpdateMode
             {
                 Create,
@@ -438,6 +439,17 @@ namespace Vegetation
                 Fill
             };
 
+            // A sector update that needs new surface points, which are generated into m_sectorInfo before the update is applied.
+            struct SectorPointsUpdate
+            {
+                UpdateMode m_mode = UpdateMode::Create;
+                SectorInfo m_sectorInfo;
+            };
+
+            bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateNextSectors(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void GenerateSectorPoints(const VegetationThreadTasks* vegTasks, AZStd::vector<SectorPointsUpdate>& updates) const;
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
@@ -9,11 +9,9 @@
 #include "InstanceSystemComponent.h"
 
 #include <AzCore/Debug/Profiler.h>
-#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
-#include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Vegetation/Ebuses/AreaInfoBus.h>
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
@@ -241,13 +239,14 @@ namespace Vegetation
     bool InstanceSystemComponent::IsDescriptorValid(DescriptorPtr descriptorPtr) const
     {
         //only support valid, registered descriptors with loaded meshes
-        AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+        AZStd::shared_lock<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
         return descriptorPtr && descriptorPtr->IsSpawnable() && m_uniqueDescriptors.find(descriptorPtr) != m_uniqueDescriptors.end();
     }
 
     void InstanceSystemComponent::GarbageCollectUniqueDescriptors()
     {
         //garbage collect unreferenced descriptors after all other references from all other systems are released
+        AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
         for (auto descItr = m_uniqueDescriptorsToDelete.begin(); descItr != m_uniqueDescriptorsToDelete.end(); )
         {
             DescriptorPtr descriptorPtr = descItr->first;
@@ -284,12 +283,8 @@ namespace Vegetation
         // Doing this here risks a slighly inaccurate count if the Create*Node functions fail, but I need this to happen on the vegetation thread so the events are recorded in order.
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
-        //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
-
+        //queue render node related commands to process on the main thread
+        AddCommand(InstanceCommandType::Create, instanceData);
         m_createTaskCount++;
     }
 
@@ -305,17 +300,10 @@ namespace Vegetation
         // do this here so we retain a correct ordering of events based on the vegetation thread.
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
-        //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
-
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        m_instanceDeletionSet.insert(instanceId);
+        //queue render node related commands to process on the main thread
+        InstanceData instanceData;
+        instanceData.m_instanceId = instanceId;
+        AddCommand(InstanceCommandType::Destroy, instanceData);
         m_destroyTaskCount++;
     }
 
@@ -324,31 +312,23 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteAllInstances));
 
         // make sure to clear out the instance work queue
-        ClearTasks();
+        ClearCommands();
 
         // clear all instances
+        for (InstanceSlot& slot : m_instanceSlots)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            for (auto instancePair : m_instanceMap)
+            if (slot.m_instance)
             {
-                InstanceId instanceId = instancePair.first;
-                DescriptorPtr descriptor = instancePair.second.first;
-                InstancePtr opaqueInstanceData = instancePair.second.second;
-                if (opaqueInstanceData)
-                {
-                    descriptor->DestroyInstance(instanceId, opaqueInstanceData);
-                }
-                ReleaseInstanceId(instanceId);
+                slot.m_descriptorPtr->DestroyInstance(slot.m_instanceId, slot.m_instance);
+                ReleaseInstanceId(slot.m_instanceId);
+                slot.m_descriptorPtr.reset();
+                slot.m_instance = nullptr;
             }
-            m_instanceMap.clear();
-            m_instanceCount = 0;
+            slot.m_queuedDestroyId = InvalidInstanceId;
         }
+        m_instanceCount = 0;
 
-        {
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.clear();
-            m_destroyTaskCount = 0;
-        }
+        FlushReleasedInstanceIds();
     }
 
     void InstanceSystemComponent::Cleanup()
@@ -384,9 +364,10 @@ namespace Vegetation
 
     void InstanceSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        if (HasTasks())
+        MergePendingCommands();
+        if (m_nextCommandIndex < m_commands.size())
         {
-            ProcessMainThreadTasks();
+            ExecuteCommands();
         }
 
         GarbageCollectUniqueDescriptors();
@@ -409,44 +390,92 @@ namespace Vegetation
         //recycle a previously used id from the pool/free-list before generating a new one
         if (!m_instanceIdPool.empty())
         {
-            auto instanceIdItr = m_instanceIdPool.begin();
-            InstanceId instanceId = *instanceIdItr;
-            m_instanceIdPool.erase(instanceIdItr);
+            InstanceId instanceId = m_instanceIdPool.back();
+            m_instanceIdPool.pop_back();
             return instanceId;
         }
 
-        //if all ids have been used, no more can be created until the counter is reset
-        if (m_instanceIdCounter >= MaxInstanceId)
+        //if all slots have been used, no more ids can be created until some are released
+        if (m_instanceSlotCounter == std::numeric_limits<AZ::u32>::max())
         {
             AZ_Error("vegetation", false, "MaxInstanceId reached! No more instance ids can be created until some are released!");
             return InvalidInstanceId;
         }
 
-        return m_instanceIdCounter++;
+        return m_instanceSlotCounter++;
     }
 
     void InstanceSystemComponent::ReleaseInstanceId(InstanceId instanceId)
     {
-        AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+        //ids that never had a create command have no slot and were never handed out, so there is nothing to release
+        InstanceSlot* slot = FindInstanceSlot(instanceId);
+        if (!slot)
+        {
+            return;
+        }
+
+        //ids can be released more than once, for instance when an area destroys an instance that DestroyAllInstances already released
+        if ((slot->m_releasedInstanceId != InvalidInstanceId) &&
+            (GetInstanceGeneration(instanceId) <= GetInstanceGeneration(slot->m_releasedInstanceId)))
+        {
+            return;
+        }
+        slot->m_releasedInstanceId = instanceId;
 
-        //add released ids to the free list for recycling
-        m_instanceIdPool.insert(instanceId);
+        //advance the generation so that the recycled id never matches the released one
+        const AZ::u32 generation = GetInstanceGeneration(instanceId) + 1;
+        if (generation == std::numeric_limits<AZ::u32>::max())
+        {
+            //retire the slot rather than wrapping its generation around, which could match ids that are still held by areas
+            return;
+        }
+        m_releasedInstanceIds.push_back((aznumeric_cast<InstanceId>(generation) << 32) | GetInstanceSlotIndex(instanceId));
     }
 
-    bool InstanceSystemComponent::IsInstanceSkippable(const InstanceData& instanceData) const
+    void InstanceSystemComponent::FlushReleasedInstanceIds()
     {
-        VEGETATION_PROFILE_FUNCTION_VERBOSE
+        if (!m_releasedInstanceIds.empty())
+        {
+            AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+            m_instanceIdPool.insert(m_instanceIdPool.end(), m_releasedInstanceIds.begin(), m_releasedInstanceIds.end());
+            m_releasedInstanceIds.clear();
+        }
+    }
 
-        //if the instance was queued for deletion before its creation task executed then skip it
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
+    AZ::u32 InstanceSystemComponent::GetInstanceSlotIndex(InstanceId instanceId)
+    {
+        return aznumeric_cast<AZ::u32>(instanceId & 0xffffffffull);
+    }
+
+    AZ::u32 InstanceSystemComponent::GetInstanceGeneration(InstanceId instanceId)
+    {
+        return aznumeric_cast<AZ::u32>(instanceId >> 32);
+    }
+
+    InstanceSystemComponent::InstanceSlot& InstanceSystemComponent::ReserveInstanceSlot(InstanceId instanceId)
+    {
+        const AZ::u32 slotIndex = GetInstanceSlotIndex(instanceId);
+        if (slotIndex >= m_instanceSlots.size())
+        {
+            m_instanceSlots.resize(slotIndex + 1);
+        }
+        return m_instanceSlots[slotIndex];
+    }
+
+    InstanceSystemComponent::InstanceSlot* InstanceSystemComponent::FindInstanceSlot(InstanceId instanceId)
+    {
+        const AZ::u32 slotIndex = GetInstanceSlotIndex(instanceId);
+        return (slotIndex < m_instanceSlots.size()) ? &m_instanceSlots[slotIndex] : nullptr;
     }
 
     void InstanceSystemComponent::CreateInstanceNode(const InstanceData& instanceData)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        if (IsInstanceSkippable(instanceData))
+        InstanceSlot& slot = ReserveInstanceSlot(instanceData.m_instanceId);
+
+        //if the instance was queued for deletion before its creation command executed then skip it
+        if (slot.m_queuedDestroyId == instanceData.m_instanceId)
         {
             return;
         }
@@ -461,7 +490,7 @@ namespace Vegetation
         }
 
         {
-            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+            AZStd::shared_lock<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
 
             auto descItr = m_uniqueDescriptors.find(instanceData.m_descriptorPtr);
             if (descItr == m_uniqueDescriptors.end())
@@ -476,10 +505,11 @@ namespace Vegetation
 
         if (opaqueInstanceData)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            AZ_Assert(!slot.m_instance, "InstanceId %llu is already in use!", instanceData.m_instanceId);
+            slot.m_instanceId = instanceData.m_instanceId;
+            slot.m_descriptorPtr = instanceData.m_descriptorPtr;
+            slot.m_instance = opaqueInstanceData;
+            m_instanceCount++;
         }
     }
 
@@ -487,86 +517,127 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
+        InstanceSlot* slot = FindInstanceSlot(instanceId);
+        if (!slot)
+        {
+            return;
+        }
 
+        if (slot->m_queuedDestroyId == instanceId)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
-            {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
-            }
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            slot->m_queuedDestroyId = InvalidInstanceId;
         }
 
-        if (opaqueInstanceData)
+        if (slot->m_instance && (slot->m_instanceId == instanceId))
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            slot->m_descriptorPtr->DestroyInstance(instanceId, slot->m_instance);
+            slot->m_descriptorPtr.reset();
+            slot->m_instance = nullptr;
+            m_instanceCount--;
         }
         ReleaseInstanceId(instanceId);
     }
 
-    bool InstanceSystemComponent::HasTasks() const
-    {
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        return !m_mainThreadTaskQueue.empty();
-    }
-
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddCommand(InstanceCommandType type, const InstanceData& instanceData)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
-        {
-            m_mainThreadTaskQueue.emplace_back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
-        }
-        m_mainThreadTaskQueue.back().emplace_back(task);
+        AZStd::lock_guard<decltype(m_pendingCommandMutex)> pendingCommandLock(m_pendingCommandMutex);
+        InstanceCommand& command = m_pendingCommands.emplace_back();
+        command.m_type = type;
+        command.m_instanceData = instanceData;
     }
 
-    void InstanceSystemComponent::ClearTasks()
+    void InstanceSystemComponent::MergePendingCommands()
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> mainThreadTaskInProgressLock(m_mainThreadTaskInProgressMutex);
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        m_mainThreadTaskQueue.clear();
+        // Drop the commands that have already been executed before appending the new ones.
+        if (m_nextCommandIndex > 0)
+        {
+            m_commands.erase(m_commands.begin(), m_commands.begin() + m_nextCommandIndex);
+            m_nextCommandIndex = 0;
+        }
 
-        m_createTaskCount = 0;
-        m_destroyTaskCount = 0;
+        const size_t firstNewCommand = m_commands.size();
+        {
+            AZStd::lock_guard<decltype(m_pendingCommandMutex)> pendingCommandLock(m_pendingCommandMutex);
+            if (m_commands.empty())
+            {
+                AZStd::swap(m_commands, m_pendingCommands);
+            }
+            else
+            {
+                m_commands.insert(
+                    m_commands.end(), AZStd::make_move_iterator(m_pendingCommands.begin()), AZStd::make_move_iterator(m_pendingCommands.end()));
+                m_pendingCommands.clear();
+            }
+        }
+
+        // Reserve the slots of new instances, and mark the instances that are going to be destroyed so that any of their create
+        // commands that haven't run yet are skipped. A destroy is always queued after its create, so only ids that were never
+        // created are left without a slot, and those are ignored rather than growing the slots to an arbitrary index.
+        for (size_t commandIndex = firstNewCommand; commandIndex < m_commands.size(); ++commandIndex)
+        {
+            const InstanceCommand& command = m_commands[commandIndex];
+            if (command.m_type == InstanceCommandType::Create)
+            {
+                ReserveInstanceSlot(command.m_instanceData.m_instanceId);
+            }
+            else if (InstanceSlot* slot = FindInstanceSlot(command.m_instanceData.m_instanceId))
+            {
+                slot->m_queuedDestroyId = command.m_instanceData.m_instanceId;
+            }
+        }
     }
 
-    bool InstanceSystemComponent::GetTasks(TaskList& removedTasks)
+    void InstanceSystemComponent::ClearCommands()
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        if (!m_mainThreadTaskQueue.empty())
+        MergePendingCommands();
+
+        // The ids of instances that were never created are released here, since their destroy commands are dropped as well.
+        for (size_t commandIndex = m_nextCommandIndex; commandIndex < m_commands.size(); ++commandIndex)
         {
-            removedTasks.splice(removedTasks.end(), m_mainThreadTaskQueue, m_mainThreadTaskQueue.begin());
-            return true;
+            const InstanceCommand& command = m_commands[commandIndex];
+            if (command.m_type == InstanceCommandType::Create)
+            {
+                ReleaseInstanceId(command.m_instanceData.m_instanceId);
+            }
         }
-        return false;
+        m_commands.clear();
+        m_nextCommandIndex = 0;
+
+        m_createTaskCount = 0;
+        m_destroyTaskCount = 0;
     }
 
-    void InstanceSystemComponent::ExecuteTasks()
+    void InstanceSystemComponent::ExecuteCommands()
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> scopedLock(m_mainThreadTaskInProgressMutex);
-
         AZStd::chrono::steady_clock::time_point initialTime = AZStd::chrono::steady_clock::now();
         AZStd::chrono::steady_clock::time_point currentTime = initialTime;
 
-        auto removedTasksPtr = AZStd::make_shared<TaskList>();
-        while (GetTasks(*removedTasksPtr))
+        // The time budget is checked after each batch of commands rather than after every command.
+        const size_t batchSize = aznumeric_cast<size_t>(AZStd::max(m_configuration.m_maxInstanceTaskBatchSize, 1));
+        while (m_nextCommandIndex < m_commands.size())
         {
-            for (const auto& task : (*removedTasksPtr).back())
+            const size_t batchEnd = AZStd::min(m_nextCommandIndex + batchSize, m_commands.size());
+            for (; m_nextCommandIndex < batchEnd; ++m_nextCommandIndex)
             {
-                task();
+                const InstanceCommand& command = m_commands[m_nextCommandIndex];
+                if (command.m_type == InstanceCommandType::Create)
+                {
+                    CreateInstanceNode(command.m_instanceData);
+                    m_createTaskCount--;
+                }
+                else
+                {
+                    ReleaseInstanceNode(command.m_instanceData.m_instanceId);
+                    m_destroyTaskCount--;
+                }
             }
 
             currentTime = AZStd::chrono::steady_clock::now();
@@ -576,16 +647,7 @@ namespace Vegetation
             }
         }
 
-        //offloading garbage collection to job to save time deallocating tasks on main thread
-        auto garbageCollectionJob = AZ::CreateJobFunction([]() mutable {}, true);
-        garbageCollectionJob->Start();
-    }
-
-    void InstanceSystemComponent::ProcessMainThreadTasks()
-    {
-        AZ_PROFILE_FUNCTION(Vegetation);
-
-        ExecuteTasks();
+        FlushReleasedInstanceIds();
     }
 
 }
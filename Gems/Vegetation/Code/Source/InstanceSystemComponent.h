@@ -15,10 +15,10 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
-#include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
-#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
@@ -115,41 +115,75 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance id management
+        // Instance ids are generational slot indices.  The low 32 bits are the index of the instance slot, and the high 32 bits
+        // are the generation of the slot, which changes every time the slot is reused so that stale ids never match a new instance.
         InstanceId CreateInstanceId();
         void ReleaseInstanceId(InstanceId instanceId);
+        void FlushReleasedInstanceIds();
 
-        mutable AZStd::recursive_mutex m_instanceIdMutex;
-        InstanceId m_instanceIdCounter = 0;
-        AZStd::unordered_set<InstanceId> m_instanceIdPool;
+        static AZ::u32 GetInstanceSlotIndex(InstanceId instanceId);
+        static AZ::u32 GetInstanceGeneration(InstanceId instanceId);
+
+        //! Ids that are ready for reuse, with the generation already advanced.  Guarded by m_instanceIdMutex.
+        AZStd::mutex m_instanceIdMutex;
+        AZ::u32 m_instanceSlotCounter = 0;
+        AZStd::vector<InstanceId> m_instanceIdPool;
+
+        //! Ids released on the main thread since the last flush, which are added to the pool together.  Main thread only.
+        AZStd::vector<InstanceId> m_releasedInstanceIds;
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
-        bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateInstanceNode(const InstanceData& instanceData);
+        // Instances are only created and destroyed on the main thread, so the slots are owned by the main thread and need no locks.
+        struct InstanceSlot
+        {
+            InstanceId m_instanceId = InvalidInstanceId;
+            DescriptorPtr m_descriptorPtr;
+            InstancePtr m_instance = nullptr;
 
-        void ReleaseInstanceNode(InstanceId instanceId);
+            //! Id of an instance in this slot that has a destroy command queued, so its create command can be skipped.
+            InstanceId m_queuedDestroyId = InvalidInstanceId;
 
-        mutable AZStd::recursive_mutex m_instanceMapMutex;
-        AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
+            //! Last id of this slot that was released, so that ids that are released twice only go back to the pool once.
+            InstanceId m_releasedInstanceId = InvalidInstanceId;
+        };
+
+        //! Returns the slot of an instance that has a create command, adding slots as needed.
+        InstanceSlot& ReserveInstanceSlot(InstanceId instanceId);
+        //! Returns the slot of an instance, or nullptr if no instance was ever created in that slot.
+        InstanceSlot* FindInstanceSlot(InstanceId instanceId);
+        void CreateInstanceNode(const InstanceData& instanceData);
+        void ReleaseInstanceNode(InstanceId instanceId);
 
-        mutable AZStd::recursive_mutex m_instanceDeletionSetMutex;
-        AZStd::unordered_set<InstanceId> m_instanceDeletionSet;
+        AZStd::vector<InstanceSlot> m_instanceSlots;
 
         ////////////////////////////////////////////////////////////////
-        // Task management
-        using Task = AZStd::function<void(void)>;
-        using TaskBatch = AZStd::vector<Task>;
-        using TaskList = AZStd::list<TaskBatch>;
-        TaskList m_mainThreadTaskQueue;
-        mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
-        mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
-
-        bool HasTasks() const;
-        void AddTask(const Task& task);
-        void ClearTasks();
-        bool GetTasks(TaskList& removedTasks);
-        void ExecuteTasks();
-        void ProcessMainThreadTasks();
+        // Command management
+        // Create and destroy requests can come from any thread.  They're appended to the pending command buffer, which is moved
+        // to the main thread command list once per tick and then processed within the time budget of each tick.
+        enum class InstanceCommandType : AZ::u8
+        {
+            Create,
+            Destroy
+        };
+
+        struct InstanceCommand
+        {
+            InstanceCommandType m_type = InstanceCommandType::Create;
+            InstanceData m_instanceData;
+        };
+
+        void AddCommand(InstanceCommandType type, const InstanceData& instanceData);
+        void MergePendingCommands();
+        void ClearCommands();
+        void ExecuteCommands();
+
+        AZStd::mutex m_pendingCommandMutex;
+        AZStd::vector<InstanceCommand> m_pendingCommands;
+
+        //! Commands that the main thread is working through, starting at m_nextCommandIndex.
+        AZStd::vector<InstanceCommand> m_commands;
+        size_t m_nextCommandIndex = 0;
 
         ////////////////////////////////////////////////////////////////
         // vegetation descriptor management
@@ -157,7 +191,7 @@ namespace Vegetation
         {
             int m_refCount = 1;
         };
-        mutable AZStd::recursive_mutex m_uniqueDescriptorsMutex;
+        mutable AZStd::shared_mutex m_uniqueDescriptorsMutex;
         AZStd::map<DescriptorPtr, DescriptorDetails> m_uniqueDescriptors;
         AZStd::map<DescriptorPtr, DescriptorDetails> m_uniqueDescriptorsToDelete;
 
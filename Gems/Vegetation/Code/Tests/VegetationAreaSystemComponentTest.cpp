@@ -9,18 +9,23 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Components/CameraBus.h>
 
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include "VegetationMocks.h"
 
 namespace UnitTest
 {
@@ -35,6 +40,9 @@ namespace UnitTest
     public:
         AZ_COMPONENT(MockVegetationDependenciesComponent, "{C93FAEE8-E0C3-41E6-BBD1-89023C5ACB28}");
 
+        // Number of job worker threads to start. The vegetation thread batches one sector per worker when generating surface points.
+        static inline int s_workerThreadCount = 1;
+
         static void Reflect(AZ::ReflectContext* context)
         {
             if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -58,10 +66,13 @@ namespace UnitTest
         void Init() override {}
         void Activate() override
         {
-            // Initialize the job manager with 1 thread for the AssetManager to use.
+            // Initialize the job manager for the AssetManager and the vegetation thread to use.
             AZ::JobManagerDesc jobDesc;
             AZ::JobManagerThreadDesc threadDesc;
-            jobDesc.m_workerThreads.push_back(threadDesc);
+            for (int threadIndex = 0; threadIndex < s_workerThreadCount; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
             m_jobManager = aznew AZ::JobManager(jobDesc);
             m_jobContext = aznew AZ::JobContext(*m_jobManager);
             AZ::JobContext::SetGlobalContext(m_jobContext);
@@ -106,19 +117,14 @@ namespace UnitTest
         }
     };
 
-    // Test harness for the vegetation system that starts up / shuts down all the vegetation system components.
-    class VegetationTestApp
-        : public UnitTest::LeakDetectionFixture
+    // Starts up / shuts down all the vegetation system components.
+    class VegetationSystemApplication
     {
     public:
-        VegetationTestApp()
-            : m_application()
-            , m_systemEntity(nullptr)
+        void Create(int workerThreadCount = 1)
         {
-        }
+            MockVegetationDependenciesComponent::s_workerThreadCount = workerThreadCount;
 
-        void SetUp() override
-        {
             AZ::ComponentApplication::Descriptor appDesc;
             appDesc.m_memoryBlocksByteSize = 50 * 1024 * 1024;
             appDesc.m_recordingMode = AZ::Debug::AllocationRecords::Mode::RECORD_FULL;
@@ -136,15 +142,237 @@ namespace UnitTest
             m_systemEntity->Activate();
         }
 
-        void TearDown() override
+        // Deactivating the system components waits for the vegetation thread, so mocks that it calls can be torn down afterwards.
+        void Deactivate()
         {
-            m_systemEntity->Deactivate();
+            if (m_systemEntity->GetState() == AZ::Entity::State::Active)
+            {
+                m_systemEntity->Deactivate();
+            }
+        }
+
+        void Destroy()
+        {
+            Deactivate();
             m_application.Destroy();
+            m_systemEntity = nullptr;
+            MockVegetationDependenciesComponent::s_workerThreadCount = 1;
         }
 
+    private:
         AZ::ComponentApplication m_application;
-        AZ::Entity* m_systemEntity;
+        AZ::Entity* m_systemEntity = nullptr;
+    };
+
+    // Surface that has a single flat point at z = 0 for every position queried in a region.
+    struct MockFlatSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
+        {
+            // Same iteration as the SurfaceData system: inclusive on the min sides of the region, exclusive on the max sides.
+            AZStd::vector<AZ::Vector3> inPositions;
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
+                }
+            }
+
+            surfacePointListPerPosition.Clear();
+            surfacePointListPerPosition.StartListConstruction(AZStd::span<const AZ::Vector3>(inPositions), 1, {});
+            for (const AZ::Vector3& inPosition : inPositions)
+            {
+                surfacePointListPerPosition.AddSurfacePoint(AZ::EntityId(), inPosition,
+                    AZ::Vector3(inPosition.GetX(), inPosition.GetY(), 0.0f), AZ::Vector3::CreateAxisZ(), SurfaceData::SurfaceTagWeights());
+            }
+            surfacePointListPerPosition.EndListConstruction();
+        }
+    };
+
+    // Active camera that the vegetation system centers its view rectangle on.
+    struct MockCameraHandler
+        : public Camera::CameraSystemRequestBus::Handler
+        , public MockTransformBus
+    {
+        MockCameraHandler()
+        {
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+            AZ::TransformBus::Handler::BusConnect(m_cameraId);
+        }
+
+        ~MockCameraHandler() override
+        {
+            AZ::TransformBus::Handler::BusDisconnect();
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+        }
+
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_cameraId;
+        }
+
+        AZ::Vector3 GetWorldTranslation() override
+        {
+            return m_GetWorldTMOutput.GetTranslation();
+        }
+
+        AZ::EntityId m_cameraId = AZ::Entity::MakeId();
+    };
+
+    // Vegetation area that claims every point it's offered, so each surface point becomes exactly one instance.
+    struct MockClaimAllArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+        explicit MockClaimAllArea(AZ::EntityId areaId)
+            : m_areaId(areaId)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_areaId);
+        }
+
+        ~MockClaimAllArea() override
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            for (const Vegetation::ClaimPoint& point : context.m_availablePoints)
+            {
+                Vegetation::InstanceData instanceData;
+                instanceData.m_id = m_areaId;
+                instanceData.m_position = point.m_position;
+                instanceData.m_normal = point.m_normal;
+                if (!context.m_existedCallback(point, instanceData))
+                {
+                    context.m_createdCallback(point, instanceData);
+                }
+            }
+            context.m_availablePoints.clear();
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+        AZ::EntityId m_areaId;
+    };
+
+    // Everything the vegetation system needs to fill the sectors around the camera with instances: a flat surface,
+    // an active camera, and a single area covering the world that claims every point.
+    // This needs to be created after the vegetation system is activated, and destroyed after it's deactivated.
+    class VegetationFillEnvironment
+    {
+    public:
+        static constexpr int SectorSizeInMeters = 8;
+        static constexpr int SectorDensity = 4;
+        static constexpr int ViewRectangleSize = 5;
+        static constexpr size_t InstancesInView = ViewRectangleSize * ViewRectangleSize * SectorDensity * SectorDensity;
+
+        VegetationFillEnvironment()
+            : m_area(AZ::Entity::MakeId())
+        {
+            Vegetation::AreaSystemConfig config;
+            config.m_sectorSizeInMeters = SectorSizeInMeters;
+            config.m_sectorDensity = SectorDensity;
+            config.m_viewRectangleSize = ViewRectangleSize;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+
+            const AZ::Aabb areaBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-AZ::Constants::FloatMax), AZ::Vector3(AZ::Constants::FloatMax));
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::RegisterArea, m_area.m_areaId, 0, 0, areaBounds);
+        }
+
+        // Moves the camera to the given sector so that the view rectangle covers the sectors around it.
+        void SetCameraSector(int sectorX, int sectorY)
+        {
+            m_cameraSectorX = sectorX;
+            m_cameraSectorY = sectorY;
+            m_camera.m_GetWorldTMOutput = AZ::Transform::CreateTranslation(
+                AZ::Vector3(static_cast<float>(sectorX * SectorSizeInMeters), static_cast<float>(sectorY * SectorSizeInMeters), 0.0f));
+        }
+
+        // The bounds of the sectors in the view rectangle around the camera.
+        AZ::Aabb GetViewBounds() const
+        {
+            const int halfViewSize = ViewRectangleSize / 2;
+            const AZ::Vector3 viewMin(
+                static_cast<float>((m_cameraSectorX - halfViewSize) * SectorSizeInMeters),
+                static_cast<float>((m_cameraSectorY - halfViewSize) * SectorSizeInMeters),
+                -1.0f);
+            const float viewSize = static_cast<float>(ViewRectangleSize * SectorSizeInMeters);
+
+            // Stop short of the max edges, which belong to the next sectors over.
+            return AZ::Aabb::CreateFromMinMax(viewMin, viewMin + AZ::Vector3(viewSize - 0.01f, viewSize - 0.01f, 2.0f));
+        }
+
+        // Ticks the vegetation system until every sector in the view rectangle has been filled, or the timeout expires.
+        bool TickUntilViewIsFilled(AZStd::chrono::milliseconds timeout = AZStd::chrono::milliseconds(10000)) const
+        {
+            const AZ::Aabb viewBounds = GetViewBounds();
+            const auto endTime = AZStd::chrono::steady_clock::now() + timeout;
+            do
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.01f, AZ::ScriptTimePoint());
+
+                AZStd::size_t instanceCount = 0;
+                Vegetation::AreaSystemRequestBus::BroadcastResult(
+                    instanceCount, &Vegetation::AreaSystemRequestBus::Events::GetInstanceCountInAabb, viewBounds);
+                if (instanceCount == InstancesInView)
+                {
+                    return true;
+                }
+
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            } while (AZStd::chrono::steady_clock::now() < endTime);
+
+            return false;
+        }
 
+        // The instances in the view rectangle, sorted by position.
+        AZStd::vector<Vegetation::InstanceData> GetInstancesInView() const
+        {
+            AZStd::vector<Vegetation::InstanceData> instances;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(
+                instances, &Vegetation::AreaSystemRequestBus::Events::GetInstancesInAabb, GetViewBounds());
+            AZStd::sort(instances.begin(), instances.end(), [](const Vegetation::InstanceData& lhs, const Vegetation::InstanceData& rhs)
+            {
+                return (lhs.m_position.GetY() < rhs.m_position.GetY()) ||
+                    ((lhs.m_position.GetY() == rhs.m_position.GetY()) && (lhs.m_position.GetX() < rhs.m_position.GetX()));
+            });
+            return instances;
+        }
+
+    private:
+        MockFlatSurfaceHandler m_surface;
+        MockCameraHandler m_camera;
+        MockClaimAllArea m_area;
+        int m_cameraSectorX = 0;
+        int m_cameraSectorY = 0;
+    };
+
+    // Test harness for the vegetation system that starts up / shuts down all the vegetation system components.
+    class VegetationTestApp
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_application.Create();
+        }
+
+        void TearDown() override
+        {
+            m_application.Destroy();
+        }
+
+        VegetationSystemApplication m_application;
     };
 
     TEST_F(VegetationTestApp, Vegetation_AreaComponentTest_SuccessfulActivation)
@@ -152,5 +380,125 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    class VegetationAreaSystemFillTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        // Fills the view rectangle around the origin with the given number of job workers, and returns the claimed instances.
+        static AZStd::vector<Vegetation::InstanceData> FillView(int workerThreadCount)
+        {
+            VegetationSystemApplication application;
+            application.Create(workerThreadCount);
+
+            AZStd::vector<Vegetation::InstanceData> instances;
+            {
+                VegetationFillEnvironment environment;
+                environment.SetCameraSector(0, 0);
+                EXPECT_TRUE(environment.TickUntilViewIsFilled());
+                instances = environment.GetInstancesInView();
+
+                application.Deactivate();
+            }
+
+            application.Destroy();
+            return instances;
+        }
+    };
+
+    TEST_F(VegetationAreaSystemFillTest, Vegetation_AreaSystem_BatchedSectorUpdatesClaimSameInstancesAsSingleSectorUpdates)
+    {
+        // With one job worker, every sector gets its surface points generated and gets filled on its own.
+        // With more workers, the sectors are batched, their surface points are generated in parallel, and then they're filled.
+        // Both must end up with the same claimed instances.
+        const AZStd::vector<Vegetation::InstanceData> singleSectorInstances = FillView(1);
+        const AZStd::vector<Vegetation::InstanceData> batchedInstances = FillView(4);
+
+        ASSERT_EQ(singleSectorInstances.size(), VegetationFillEnvironment::InstancesInView);
+        ASSERT_EQ(batchedInstances.size(), singleSectorInstances.size());
+        for (size_t index = 0; index < singleSectorInstances.size(); ++index)
+        {
+            EXPECT_TRUE(batchedInstances[index].m_position.IsClose(singleSectorInstances[index].m_position));
+            EXPECT_EQ(batchedInstances[index].m_id, singleSectorInstances[index].m_id);
+        }
+    }
+
+#ifdef HAVE_BENCHMARK
+    class VegetationAreaSystemBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_application = AZStd::make_unique<VegetationSystemApplication>();
+            m_application->Create(aznumeric_cast<int>(state.range(0)));
+            m_environment = AZStd::make_unique<VegetationFillEnvironment>();
+        }
+
+        void internalTearDown()
+        {
+            m_application->Deactivate();
+            m_environment.reset();
+            m_application->Destroy();
+            m_application.reset();
+        }
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<VegetationSystemApplication> m_application;
+        AZStd::unique_ptr<VegetationFillEnvironment> m_environment;
+    };
+
+    BENCHMARK_DEFINE_F(VegetationAreaSystemBenchmark, BM_FlyThrough)(benchmark::State& state)
+    {
+        // Start with a filled view, then move the camera one sector per iteration so that every iteration deletes one column of
+        // sectors and creates and fills a new one.
+        int cameraSectorX = 0;
+        m_environment->SetCameraSector(cameraSectorX, 0);
+        if (!m_environment->TickUntilViewIsFilled())
+        {
+            state.SkipWithError("The initial view was never filled.");
+            return;
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_environment->SetCameraSector(++cameraSectorX, 0);
+            if (!m_environment->TickUntilViewIsFilled())
+            {
+                state.SkipWithError("The view was never filled after moving the camera.");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * VegetationFillEnvironment::ViewRectangleSize);
+    }
+
+    BENCHMARK_REGISTER_F(VegetationAreaSystemBenchmark, BM_FlyThrough)
+        ->Arg(1)
+        ->Arg(4)
+        ->ArgName("WorkerThreads")
+        ->Unit(::benchmark::kMillisecond);
+#endif
+}
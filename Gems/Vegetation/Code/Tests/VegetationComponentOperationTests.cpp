@@ -395,6 +395,84 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    TEST_F(VegetationComponentOperationTests, InstanceSystemComponentRecyclesInstanceIds)
+    {
+        Vegetation::InstanceSystemConfig instanceSystemConfig;
+        Vegetation::InstanceSystemComponent* instanceSystemComponent = nullptr;
+        auto instanceSystemEntity = CreateEntity(instanceSystemConfig, &instanceSystemComponent, [](AZ::Entity* e)
+        {
+            e->CreateComponent<Vegetation::DebugSystemComponent>();
+        });
+
+        auto tick = []()
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+        };
+
+        auto getInstanceCount = []()
+        {
+            AZ::u32 instanceCount = 0;
+            Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(
+                instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+            return instanceCount;
+        };
+
+        //empty instance spawners create instances without needing any assets or renderer
+        Vegetation::Descriptor descriptor;
+        descriptor.SetInstanceSpawner(AZStd::make_shared<Vegetation::EmptyInstanceSpawner>());
+        Vegetation::DescriptorPtr descriptorPtr;
+        Vegetation::InstanceSystemRequestBus::BroadcastResult(
+            descriptorPtr, &Vegetation::InstanceSystemRequestBus::Events::RegisterUniqueDescriptor, descriptor);
+
+        auto createInstance = [descriptorPtr]()
+        {
+            Vegetation::InstanceData instanceData;
+            instanceData.m_descriptorPtr = descriptorPtr;
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstance, instanceData);
+            return instanceData.m_instanceId;
+        };
+
+        constexpr AZ::u32 numInstances = 8;
+        AZStd::vector<Vegetation::InstanceId> instanceIds;
+        for (AZ::u32 i = 0; i < numInstances; ++i)
+        {
+            instanceIds.push_back(createInstance());
+            EXPECT_NE(instanceIds.back(), Vegetation::InvalidInstanceId);
+        }
+
+        //destroying an instance before its creation has been processed skips the creation
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceIds[0]);
+        tick();
+        EXPECT_EQ(getInstanceCount(), numInstances - 1);
+
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceIds[1]);
+        tick();
+        EXPECT_EQ(getInstanceCount(), numInstances - 2);
+
+        //recycled ids never match the ids of destroyed instances
+        const Vegetation::InstanceId recycledId = createInstance();
+        EXPECT_EQ(AZStd::find(instanceIds.begin(), instanceIds.end(), recycledId), instanceIds.end());
+        tick();
+        EXPECT_EQ(getInstanceCount(), numInstances - 1);
+
+        //destroying a stale id leaves the instance that reused its slot alone
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceIds[1]);
+        tick();
+        EXPECT_EQ(getInstanceCount(), numInstances - 1);
+
+        //destroying an id that was never handed out is ignored rather than allocating slots up to its index
+        const Vegetation::InstanceId unknownId = 0x7fffffffull;
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, unknownId);
+        tick();
+        EXPECT_EQ(getInstanceCount(), numInstances - 1);
+        EXPECT_NE(createInstance(), unknownId);
+
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+        EXPECT_EQ(getInstanceCount(), 0);
+
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::ReleaseUniqueDescriptor, descriptorPtr);
+    }
+
     TEST_F(VegetationComponentOperationTests, AreaBlenderComponent)
     {
         auto entityBlocker = CreateEntity<Vegetation::BlockerComponent>(Vegetation::BlockerConfig(), nullptr, [](AZ::Entity* e)